@@ -54,6 +54,8 @@ class TrainCfg {
   std::vector<std::string> loss_name_; /**< Set part of the name that identify a loss kernel */
   MixPrecisionCfg mix_precision_cfg_;  /**< Mix precision configuration */
   bool accumulate_gradients_ = false;
+  size_t recompute_memory_budget_ = 0;       /**< Memory budget of the activations in bytes, 0 means no budget */
+  std::vector<std::string> recompute_names_; /**< Set part of the name that identify a forward kernel to recompute */
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_INCLUDE_API_CFG_H
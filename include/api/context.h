@@ -208,7 +208,8 @@ class MS_API CPUDeviceInfo : public DeviceInfoContext {
   /// \return Type of this DeviceInfoContext.
   enum DeviceType GetDeviceType() const override { return DeviceType::kCPU; };
 
-  /// \brief Set enables to perform the float16 inference
+  /// \brief Set enables to perform the float16 inference, on x86 cpus supporting avx512-bf16 the matmul is computed
+  /// in bfloat16 instead.
   ///
   /// \param[in] is_fp16 Enable float16 inference or not.
   void SetEnableFP16(bool is_fp16);
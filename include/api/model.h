@@ -269,6 +269,12 @@ class MS_API Model {
   /// \return learning rate. 0.0 if no optimizer was found
   float GetLearningRate();
 
+  /// \brief Gets the memory size which the tensors of the current mode are planned to take, the activations which
+  /// are recomputed in training are not kept in it.
+  ///
+  /// \return size in bytes. 0 if the tensors are not planned by the static allocator
+  size_t GetPlannedTensorsSize();
+
   Status InitMetrics(std::vector<Metrics *> metrics);
   std::vector<Metrics *> GetMetrics();
 
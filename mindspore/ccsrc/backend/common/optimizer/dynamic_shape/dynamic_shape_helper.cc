@@ -16,6 +16,7 @@
 
 #include "backend/common/optimizer/dynamic_shape/dynamic_shape_helper.h"
 
+#include <algorithm>
 #include <memory>
 #include <stack>
 #include <set>
@@ -36,6 +37,36 @@ namespace mindspore {
 namespace opt::dynamic_shape {
 namespace {
 constexpr int64_t kInvalidShape = -2;
+// The input shapes of a dynamic shape node in serving usually cycle among a few ones.
+constexpr size_t kInferShapeCacheSize = 8;
+
+void AppendInputKey(const void *data, size_t size, std::string *input_key) {
+  MS_EXCEPTION_IF_NULL(input_key);
+  (void)input_key->append(static_cast<const char *>(data), size);
+}
+
+// Resize of these kernel mods only works out the sizes from the inputs, so it can be skipped for the same inputs. The
+// others may rebuild their state in Resize, e.g. the ext info of the aicpu kernels, and have to resize every step.
+bool IsResizeIdempotent(const kernel::KernelModPtr &kernel_mod) {
+  MS_EXCEPTION_IF_NULL(kernel_mod);
+  static const std::set<kernel::KernelModType> idempotent_resize_kernel_mods = {
+    kernel::KernelModType::NativeCpuKernelMod, kernel::KernelModType::NativeGpuKernelMod};
+  if (idempotent_resize_kernel_mods.count(kernel_mod->GetKernelModType()) == 0) {
+    return false;
+  }
+  // The output shapes of the compute depend kernels are retrieved after launch, which needs Resize before it.
+  return !kernel_mod->IsNeedRetrieveOutputShape();
+}
+
+std::shared_ptr<InferShapeCache> GetInferShapeCache(const CNodePtr &cnode) {
+  MS_EXCEPTION_IF_NULL(cnode);
+  auto cache = cnode->user_data<InferShapeCache>();
+  if (cache == nullptr) {
+    cache = std::make_shared<InferShapeCache>();
+    cnode->set_user_data<InferShapeCache>(cache);
+  }
+  return cache;
+}
 
 void InferShapeForNopNode(const AnfNodePtr &input_node) {
   MS_EXCEPTION_IF_NULL(input_node);
@@ -95,13 +126,16 @@ bool InferShapeForDefiniteOutputNode(const CNodePtr &cnode) {
   return true;
 }
 
-void InferShape(const CNodePtr &cnode, std::map<uint32_t, tensor::TensorPtr> *depend_tensor_map) {
+void InferShape(const CNodePtr &cnode, std::map<uint32_t, tensor::TensorPtr> *depend_tensor_map,
+                const std::shared_ptr<InferShapeCache> &cache) {
   MS_EXCEPTION_IF_NULL(cnode);
   MS_EXCEPTION_IF_NULL(depend_tensor_map);
+  MS_EXCEPTION_IF_NULL(cache);
   MS_LOG(INFO) << "InferShape start, node:" << cnode->fullname_with_scope();
   std::set<int64_t> depend_list = abstract::GetDependsFormMap(cnode);
   auto ret = InferShapeForDefiniteOutputNode(cnode);
   if (ret) {
+    cache->set_current_key("");
     return;
   }
 
@@ -116,6 +150,7 @@ void InferShape(const CNodePtr &cnode, std::map<uint32_t, tensor::TensorPtr> *de
   auto primitive = GetValueNode<PrimitivePtr>(inputs[0]);
   auto input_size = common::AnfAlgo::GetInputTensorNum(cnode);
   bool skip_nop_node = !context->get_param<bool>(MS_CTX_ENABLE_MINDRT);
+  std::string input_key;
   for (size_t i = 0; i < input_size; i++) {
     auto input_node_with_index = common::AnfAlgo::GetPrevNodeOutput(cnode, i, false);
     auto real_input = input_node_with_index.first;
@@ -124,6 +159,12 @@ void InferShape(const CNodePtr &cnode, std::map<uint32_t, tensor::TensorPtr> *de
     if (skip_nop_node) {
       InferShapeForNopNode(real_input);
     }
+    auto input_shape = common::AnfAlgo::GetOutputInferShape(real_input, real_input_index);
+    auto input_type = common::AnfAlgo::GetOutputInferDataType(real_input, real_input_index);
+    auto input_rank = input_shape.size();
+    AppendInputKey(&input_rank, sizeof(input_rank), &input_key);
+    AppendInputKey(input_shape.data(), input_rank * sizeof(size_t), &input_key);
+    AppendInputKey(&input_type, sizeof(input_type), &input_key);
     if (depend_list.find(i) != depend_list.end()) {
       auto output_addr = AnfAlgo::GetMutableOutputAddr(real_input, real_input_index, skip_nop_node);
       auto shapes = trans::GetRuntimePaddingShape(real_input, real_input_index);
@@ -138,6 +179,7 @@ void InferShape(const CNodePtr &cnode, std::map<uint32_t, tensor::TensorPtr> *de
         MS_LOG(EXCEPTION) << "Insert map failed.";
       }
       out_tensor->data_sync();
+      AppendInputKey(out_tensor->data_c(), out_tensor->Size(), &input_key);
 
       // cppcheck-suppress unreadVariable
       auto lock = AnfUtils::GetAbstractLock(real_input.get());
@@ -154,7 +196,14 @@ void InferShape(const CNodePtr &cnode, std::map<uint32_t, tensor::TensorPtr> *de
     }
     common::AnfAlgo::AddArgList(&args_spec_list, real_input, real_input_index);
   }
+  cache->set_current_key(input_key);
+  auto cached_result = cache->Find(input_key);
+  if (cached_result != nullptr) {
+    cnode->set_abstract(cached_result);
+    return;
+  }
   auto eval_result = opt::CppInferShape(primitive, args_spec_list);
+  cache->Insert(input_key, eval_result);
   cnode->set_abstract(eval_result);
 }
 }  // namespace
@@ -183,6 +232,9 @@ AnfNodePtr GenInitNode(const AnfNodePtr &node) {
   auto kernel_mod = AnfAlgo::GetKernelMod(cnode);
   MS_EXCEPTION_IF_NULL(kernel_mod);
   AnfUtils::CustomActorCallback actor_func = [kernel_mod, cnode](void *) {
+    if (IsKernelModResized(cnode)) {
+      return;
+    }
     auto args = cnode->user_data<kernel::KernelArgs>();
     if (args == nullptr) {
       args = std::make_shared<kernel::KernelArgs>();
@@ -190,6 +242,7 @@ AnfNodePtr GenInitNode(const AnfNodePtr &node) {
     if (!kernel_mod->Resize(args->op, args->inputs, args->outputs, args->depend_tensor_map)) {
       MS_LOG(EXCEPTION) << "Node " << cnode->fullname_with_scope() << " Resize failed.";
     }
+    SetKernelModResized(cnode);
   };
 
   auto init_node = AnfUtils::NewInitActorNode(actor_func, cnode);
@@ -206,11 +259,20 @@ void InferOp(const CNodePtr &cnode) {
     return;
   }
   kernel::KernelArgs args;
+  auto cache = GetInferShapeCache(cnode);
   if (AnfAlgo::IsDynamicShapeSkipExecute(cnode)) {
     std::vector<TypeId> dtypes{common::AnfAlgo::GetOutputInferDataType(cnode, 0)};
     common::AnfAlgo::SetOutputInferTypeAndShape(dtypes, {AnfAlgo::GetInputDeviceShape(cnode, 0)}, cnode.get());
+    cache->set_current_key("");
   } else {
-    InferShape(cnode, &args.depend_tensor_map);
+    InferShape(cnode, &args.depend_tensor_map, cache);
+  }
+
+  // The kernel args of the same inputs are kept, only the depend tensors of this step are updated.
+  auto last_args = kernel::GetArgsFromCNode(cnode);
+  if (IsResizeIdempotent(kernel_mod) && cache->is_resized(kernel_mod.get()) && last_args != nullptr) {
+    last_args->depend_tensor_map = std::move(args.depend_tensor_map);
+    return;
   }
 
   if (kernel_mod->GetKernelModType() == kernel::KernelModType::NativeGpuKernelMod ||
@@ -223,6 +285,40 @@ void InferOp(const CNodePtr &cnode) {
   }
 }
 
+bool IsKernelModResized(const CNodePtr &node) {
+  MS_EXCEPTION_IF_NULL(node);
+  auto cache = node->user_data<InferShapeCache>();
+  if (cache == nullptr) {
+    return false;
+  }
+  auto kernel_mod = AnfAlgo::GetKernelMod(node);
+  return IsResizeIdempotent(kernel_mod) && cache->is_resized(kernel_mod.get());
+}
+
+void SetKernelModResized(const CNodePtr &node) {
+  MS_EXCEPTION_IF_NULL(node);
+  GetInferShapeCache(node)->set_resized(AnfAlgo::GetKernelMod(node).get());
+}
+
+AbstractBasePtr InferShapeCache::Find(const std::string &input_key) {
+  auto iter = std::find_if(results_.begin(), results_.end(),
+                           [&input_key](const auto &result) { return result.first == input_key; });
+  if (iter == results_.end()) {
+    ++miss_count_;
+    return nullptr;
+  }
+  ++hit_count_;
+  results_.splice(results_.begin(), results_, iter);
+  return results_.front().second;
+}
+
+void InferShapeCache::Insert(const std::string &input_key, const AbstractBasePtr &abstract) {
+  if (results_.size() >= kInferShapeCacheSize) {
+    results_.pop_back();
+  }
+  (void)results_.emplace_front(input_key, abstract);
+}
+
 CustomActorNodeManager &CustomActorNodeManager::Instance() {
   static CustomActorNodeManager instance{};
   return instance;
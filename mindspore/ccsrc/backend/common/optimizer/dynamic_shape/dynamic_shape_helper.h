@@ -18,6 +18,8 @@
 #define MINDSPORE_CCSRC_BACKEND_COMMON_OPTIMIZER_DYNAMIC_SHAPE_DYNAMIC_SHAPE_HELPER_H
 
 #include <string>
+#include <list>
+#include <utility>
 #include "ir/anf.h"
 #include "utils/ms_utils.h"
 #include "backend/common/optimizer/optimizer.h"
@@ -25,9 +27,52 @@
 namespace mindspore::opt::dynamic_shape {
 bool IsRealCNode(const BaseRef &n);
 void InferOp(const CNodePtr &node);
+// Whether the kernel mod of the node has been resized with the inputs of the last InferOp, then Resize is skipped.
+// Only the kernel mods whose Resize just works out the sizes from the inputs are skipped.
+bool IsKernelModResized(const CNodePtr &node);
+// Record that the kernel mod of the node has been resized with the inputs of the last InferOp.
+void SetKernelModResized(const CNodePtr &node);
 AnfNodePtr GenInferNode(const AnfNodePtr &node);
 AnfNodePtr GenInitNode(const AnfNodePtr &node);
 
+// The infer results of a dynamic shape node, keyed by the shapes and types of the inputs and the values of the
+// value-depend inputs, which are reused when the inputs of a step are the same as a previous one.
+class InferShapeCache {
+ public:
+  InferShapeCache() = default;
+  ~InferShapeCache() = default;
+  // The most recently used result is moved to the front, nullptr if not cached.
+  AbstractBasePtr Find(const std::string &input_key);
+  void Insert(const std::string &input_key, const AbstractBasePtr &abstract);
+
+  void set_current_key(std::string current_key) { current_key_ = std::move(current_key); }
+  bool is_resized(const void *kernel_mod) const {
+    return !current_key_.empty() && current_key_ == resized_key_ && kernel_mod == resized_kernel_mod_;
+  }
+  void set_resized(const void *kernel_mod) {
+    resized_key_ = current_key_;
+    resized_kernel_mod_ = kernel_mod;
+    ++resize_count_;
+  }
+
+  size_t hit_count() const { return hit_count_; }
+  size_t miss_count() const { return miss_count_; }
+  size_t resize_count() const { return resize_count_; }
+
+  // cppcheck-suppress unusedStructMember
+  constexpr static char key[] = "InferShapeCache";
+
+ private:
+  std::list<std::pair<std::string, AbstractBasePtr>> results_;
+  // The input key of the last InferOp, and the one which the kernel mod is resized with.
+  std::string current_key_;
+  std::string resized_key_;
+  const void *resized_kernel_mod_{nullptr};
+  size_t hit_count_{0};
+  size_t miss_count_{0};
+  size_t resize_count_{0};
+};
+
 struct RelatedCustomActorNode {
   AnfNodePtr infer_node;
   AnfNodePtr init_node;
@@ -20,6 +20,8 @@
 #include "utils/log_adapter.h"
 #include "utils/convert_utils_base.h"
 #include "utils/ms_exception.h"
+#include "utils/ms_utils.h"
+#include "actor/actormgr.h"
 
 namespace mindspore {
 namespace common {
@@ -28,6 +30,7 @@ constexpr size_t kDeviceNum = 8;
 #endif
 constexpr size_t kMaxThreadNum = 23;
 constexpr size_t kYieldThreshold = 1000;
+constexpr char kSharedThreadPoolEnv[] = "MS_DEV_SHARED_THREAD_POOL";
 
 ThreadPool::ThreadPool() {
   size_t process_core_num = std::thread::hardware_concurrency() - 1;
@@ -45,6 +48,54 @@ ThreadPool::ThreadPool() {
   if (max_thread_num_ > kMaxThreadNum) {
     max_thread_num_ = kMaxThreadNum;
   }
+  use_shared_pool_ = common::GetEnv(kSharedThreadPoolEnv) != "0";
+}
+
+ActorThreadPool *ThreadPool::GetSharedPool() const {
+  if (!use_shared_pool_) {
+    return nullptr;
+  }
+  auto actor_manager = ActorMgr::GetActorMgrRef();
+  if (actor_manager == nullptr) {
+    return nullptr;
+  }
+  auto pool = actor_manager->GetActorThreadPool();
+  if (pool == nullptr || pool->GetKernelThreadNum() == 0) {
+    return nullptr;
+  }
+  return pool;
+}
+
+size_t ThreadPool::GetSyncRunThreadNum() const {
+  auto pool = GetSharedPool();
+  if (pool != nullptr) {
+    return std::min(pool->GetKernelThreadNum(), kMaxThreadNum);
+  }
+  return max_thread_num_;
+}
+
+bool ThreadPool::SyncRunOnSharedPool(ActorThreadPool *pool, const std::vector<Task> &tasks) const {
+  // The tasks are pulled by the launched jobs one by one, so that the tasks of unequal cost are balanced as before.
+  // A SyncRun called inside an actor or a kernel task only takes the idle workers and runs the rest by itself.
+  size_t task_num = tasks.size();
+  size_t job_num = std::min(task_num, GetSyncRunThreadNum());
+  std::atomic_size_t next_task{0};
+  std::atomic_bool success{true};
+  auto func = [&tasks, &next_task, &success, task_num](void *, int, float, float) {
+    for (size_t i = next_task++; i < task_num; i = next_task++) {
+      try {
+        if (tasks[i]() != SUCCESS) {
+          success = false;
+        }
+      } catch (std::exception &e) {
+        MsException::Instance().SetException();
+        success = false;
+      }
+    }
+    return 0;
+  };
+  (void)pool->ParallelLaunch(func, nullptr, SizeToInt(job_num));
+  return success;
 }
 
 void ThreadPool::SyncRunLoop(const std::shared_ptr<ThreadContext> &context) {
@@ -92,6 +143,12 @@ bool ThreadPool::SyncRun(const std::vector<Task> &tasks) {
     auto ret = tasks[0]();
     return ret == SUCCESS;
   }
+  auto shared_pool = GetSharedPool();
+  if (shared_pool != nullptr) {
+    // The threads created before the actor runtime just sleep on their condition variables, they are joined by
+    // ClearThreadPool at shutdown rather than taking pool_mtx_ here on every call.
+    return SyncRunOnSharedPool(shared_pool, tasks);
+  }
   std::unique_lock<std::mutex> lock(pool_mtx_);
   exit_run_ = false;
   size_t task_num = tasks.size();
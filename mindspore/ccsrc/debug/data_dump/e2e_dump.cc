@@ -534,6 +534,10 @@ void E2eDump::UpdateIterOldRTDump(const session::KernelGraph *graph) {
  * dataset_sink_mode = True is not supported for GPU.
  */
 void E2eDump::UpdateIterMindRTDump() {
+  if (DumpJsonParser::GetInstance().IsStatisticDump()) {
+    // the statistics of the kernels of this step are complete once the step ends, the writer thread closes the file.
+    TensorStatDump::CloseStatisticsFile();
+  }
   auto debugger = Debugger::GetInstance();
   // Dataset graph is always the first graph in the list when dataset_sink_mode is true.
   auto graph = (debugger->GetStepGraphPtrList())[0];
@@ -624,7 +628,7 @@ void E2eDump::DumpData(const session::KernelGraph *graph, uint32_t rank_id, cons
     MS_LOG(INFO) << "Current graph id is " << graph_id;
     std::string dump_path = GenerateDumpPath(graph_id, rank_id);
     if (dump_json_parser.IsStatisticDump()) {
-      (void)TensorStatDump::OpenStatisticsFile(dump_path);
+      TensorStatDump::OpenStatisticsFile(dump_path);
     }
     DumpInput(graph, dump_path, debugger);
     DumpOutput(graph, dump_path, debugger);
@@ -635,7 +639,7 @@ void E2eDump::DumpData(const session::KernelGraph *graph, uint32_t rank_id, cons
       DumpConstantData(graph, rank_id, debugger);
     }
     if (dump_json_parser.IsStatisticDump()) {
-      CsvWriter::GetInstance().CloseFile();
+      TensorStatDump::CloseStatisticsFile();
     }
     success = true;
   }
@@ -18,6 +18,8 @@
 
 #include <memory>
 #include <map>
+#include <future>
+#include <utility>
 #include "utils/file_utils.h"
 #include "include/common/debug/common.h"
 #include "debug/debug_services.h"
@@ -28,17 +30,129 @@ constexpr auto kInput = "input";
 constexpr auto kOutput = "output";
 constexpr auto kCsvHeader =
   "Op Type,Op Name,Task ID,Stream ID,Timestamp,IO,Slot,Data Size,Data Type,Shape,Max Value,Min Value,Avg Value,"
-  "Count,Negative Zero Count,Positive Zero Count,NaN Count,Negative Inf Count,Positive Inf Count,Zero Count\n";
+  "Count,Negative Zero Count,Positive Zero Count,NaN Count,Negative Inf Count,Positive Inf Count,Zero Count,"
+  "L2Norm Value\n";
+constexpr auto kSeparator = ",";
 constexpr auto kCsvFileName = "statistic.csv";
 }  // namespace
 
 namespace mindspore {
-bool CsvWriter::OpenFile(const std::string &path, const std::string &header) {
+CsvWriter::CsvWriter(size_t max_pending_tasks) : max_pending_tasks_(max_pending_tasks) {
+  worker_ = std::thread(&CsvWriter::WorkerLoop, this);
+}
+
+bool CsvWriter::PushTask(std::function<void()> &&task) {
+  std::unique_lock<std::mutex> lock(task_mutex_);
+  // Only wait when the writer thread falls far behind, so that memory held by pending rows stays bounded.
+  space_cond_var_.wait(lock, [this]() { return tasks_.size() < max_pending_tasks_ || stop_; });
+  if (stop_) {
+    MS_LOG(WARNING) << "Statistics writer has been stopped, skipping current statistics";
+    return false;
+  }
+  tasks_.push(std::move(task));
+  task_cond_var_.notify_one();
+  return true;
+}
+
+bool CsvWriter::RunTask(std::function<bool()> &&task) {
+  auto result = std::make_shared<std::promise<bool>>();
+  auto future = result->get_future();
+  if (!PushTask([result, task = std::move(task)]() { result->set_value(task()); })) {
+    return false;
+  }
+  return future.get();
+}
+
+void CsvWriter::WorkerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(task_mutex_);
+      task_cond_var_.wait(lock, [this]() { return !tasks_.empty() || stop_; });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    space_cond_var_.notify_all();
+    task();
+  }
+}
+
+void CsvWriter::OpenFileAsync(const std::string &path, const std::string &header) {
+  (void)PushTask([this, path, header]() {
+    // try twice before skipping the statistics.
+    if (!DoOpenFile(path, header) && !DoOpenFile(path, header)) {
+      MS_LOG(WARNING) << "Open statistic dump file failed, skipping current statistics";
+      write_failed_ = true;
+    }
+  });
+}
+
+void CsvWriter::WriteRowAsync(const std::string &path, const std::string &header, std::string &&row) {
+  (void)PushTask([this, path, header, row = std::move(row)]() {
+    if (!DoOpenFile(path, header)) {
+      MS_LOG(WARNING) << "Open statistic dump file failed, skipping current statistics";
+      write_failed_ = true;
+      return;
+    }
+    file_ << row << kEndLine;
+    if (!file_.good()) {
+      MS_LOG(WARNING) << "Write statistic dump file " << file_path_str_ << " failed." << ErrnoToString(errno);
+      write_failed_ = true;
+    }
+  });
+}
+
+void CsvWriter::FlushAsync() {
+  (void)PushTask([this]() {
+    if (!CheckWriteStatus()) {
+      MS_LOG(ERROR) << "Some statistics failed to be written to the statistic dump file " << file_path_str_;
+    }
+  });
+}
+
+void CsvWriter::CloseFileAsync() {
+  (void)PushTask([this]() {
+    if (!CheckWriteStatus()) {
+      MS_LOG(ERROR) << "Some statistics failed to be written to the statistic dump file " << file_path_str_;
+    }
+    DoCloseFile();
+  });
+}
+
+bool CsvWriter::Flush() { return RunTask([this]() { return CheckWriteStatus(); }); }
+
+bool CsvWriter::CloseFile() {
+  return RunTask([this]() {
+    bool ret = CheckWriteStatus();
+    DoCloseFile();
+    return ret;
+  });
+}
+
+size_t CsvWriter::pending_tasks() {
+  std::lock_guard<std::mutex> lock(task_mutex_);
+  return tasks_.size();
+}
+
+bool CsvWriter::CheckWriteStatus() {
+  if (file_.is_open() && !file_.flush().good()) {
+    MS_LOG(WARNING) << "Flush statistic dump file " << file_path_str_ << " failed." << ErrnoToString(errno);
+    write_failed_ = true;
+  }
+  bool ret = !write_failed_;
+  write_failed_ = false;
+  return ret;
+}
+
+bool CsvWriter::DoOpenFile(const std::string &path, const std::string &header) {
   if (file_.is_open() && path == file_path_str_) {
     return true;
   }
   if (file_.is_open()) {
-    CloseFile();
+    DoCloseFile();
   }
   auto file_path = Common::CreatePrefixPath(path);
   if (!file_path.has_value()) {
@@ -61,14 +175,13 @@ bool CsvWriter::OpenFile(const std::string &path, const std::string &header) {
   }
   if (first_time_opening) {
     file_ << header;
-    (void)file_.flush();
     file_path_str_ = path;
   }
   MS_LOG(INFO) << "Opened file: " << file_path_value;
   return true;
 }
 
-void CsvWriter::CloseFile() noexcept {
+void CsvWriter::DoCloseFile() noexcept {
   if (file_.is_open()) {
     file_.close();
     ChangeFileMode(file_path_str_, S_IRUSR);
@@ -76,19 +189,20 @@ void CsvWriter::CloseFile() noexcept {
   }
 }
 
-template <typename T>
-void CsvWriter::WriteToCsv(const T &val, bool end_line) {
-  file_ << val;
-  if (end_line) {
-    file_ << kEndLine;
-    (void)file_.flush();
-  } else {
-    file_ << kSeparator;
+CsvWriter::~CsvWriter() {
+  {
+    std::lock_guard<std::mutex> lock(task_mutex_);
+    stop_ = true;
+  }
+  // the writer thread runs the queued tasks before it exits.
+  task_cond_var_.notify_all();
+  space_cond_var_.notify_all();
+  if (worker_.joinable()) {
+    worker_.join();
   }
+  DoCloseFile();
 }
 
-CsvWriter::~CsvWriter() { CloseFile(); }
-
 TensorStatDump::TensorStatDump(const std::string &op_type, const std::string &op_name, uint32_t task_id,
                                uint32_t stream_id, uint64_t timestamp, bool input, size_t slot,
                                size_t tensor_loader_slot)
@@ -122,19 +236,16 @@ TensorStatDump::TensorStatDump(const std::string &op_type, const std::string &op
   }
 }
 
-bool TensorStatDump::OpenStatisticsFile(const std::string &dump_path) {
+void TensorStatDump::OpenStatisticsFile(const std::string &dump_path) {
   std::string filename = dump_path + "/" + kCsvFileName;
-  // try to open file
-  CsvWriter &csv = CsvWriter::GetInstance();
-  int retry = 2;
-  while (retry > 0) {
-    if (csv.OpenFile(filename, kCsvHeader)) {
-      break;
-    }
-    retry--;
-  }
-  if (!retry) {
-    MS_LOG(WARNING) << "Open statistic dump file failed, skipping current statistics";
+  CsvWriter::GetInstance().OpenFileAsync(filename, kCsvHeader);
+}
+
+void TensorStatDump::CloseStatisticsFile() { CsvWriter::GetInstance().CloseFileAsync(); }
+
+bool TensorStatDump::FinalizeStatisticsFile() {
+  if (!CsvWriter::GetInstance().CloseFile()) {
+    MS_LOG(ERROR) << "Some statistics failed to be written to the statistic dump file.";
     return false;
   }
   return true;
@@ -162,44 +273,26 @@ bool TensorStatDump::DumpTensorStatsToFile(const std::string &dump_path, const s
     type = "unsupported(" + std::to_string(data->GetType()) + ")";
     MS_LOG(INFO) << "Unsupported tensor data_type " << type << " for tensor " << data->GetName();
   }
-  if (!OpenStatisticsFile(dump_path)) {
-    return false;
-  }
   const DebugServices::TensorStat &stat = DebugServices::GetTensorStatistics(data);
-  // write tensor statistics to csv file
-  std::ostringstream shape;
-  shape << "\"(";
+  // format the csv row here and leave the file writing to the background writer thread
+  std::ostringstream row;
+  row << op_type_ << kSeparator << op_name_ << kSeparator << task_id_ << kSeparator << stream_id_ << kSeparator
+      << timestamp_ << kSeparator << io_ << kSeparator << slot_ << kSeparator << stat.data_size << kSeparator << type
+      << kSeparator << "\"(";
   for (size_t i = 0; i < stat.shape.size(); i++) {
-    shape << (i ? "," : "") << stat.shape[i];
-  }
-  shape << ")\"";
-  CsvWriter &csv = CsvWriter::GetInstance();
-  csv.WriteToCsv(op_type_);
-  csv.WriteToCsv(op_name_);
-  csv.WriteToCsv(task_id_);
-  csv.WriteToCsv(stream_id_);
-  csv.WriteToCsv(timestamp_);
-  csv.WriteToCsv(io_);
-  csv.WriteToCsv(slot_);
-  csv.WriteToCsv(stat.data_size);
-  csv.WriteToCsv(type);
-  csv.WriteToCsv(shape.str());
+    row << (i ? "," : "") << stat.shape[i];
+  }
+  row << ")\"" << kSeparator;
   if (stat.count == stat.nan_count + stat.neg_inf_count + stat.pos_inf_count) {
-    csv.WriteToCsv("null");
-    csv.WriteToCsv("null");
-    csv.WriteToCsv("null");
+    row << "null" << kSeparator << "null" << kSeparator << "null" << kSeparator;
   } else {
-    csv.WriteToCsv(stat.max_value);
-    csv.WriteToCsv(stat.min_value);
-    csv.WriteToCsv(stat.avg_value);
-  }
-  csv.WriteToCsv(stat.count);
-  csv.WriteToCsv(stat.neg_zero_count);
-  csv.WriteToCsv(stat.pos_zero_count);
-  csv.WriteToCsv(stat.nan_count);
-  csv.WriteToCsv(stat.neg_inf_count);
-  csv.WriteToCsv(stat.pos_inf_count);
-  csv.WriteToCsv(stat.zero_count, true);
+    row << stat.max_value << kSeparator << stat.min_value << kSeparator << stat.avg_value << kSeparator;
+  }
+  row << stat.count << kSeparator << stat.neg_zero_count << kSeparator << stat.pos_zero_count << kSeparator
+      << stat.nan_count << kSeparator << stat.neg_inf_count << kSeparator << stat.pos_inf_count << kSeparator
+      << stat.zero_count << kSeparator << stat.l2_norm_value;
+  std::string filename = dump_path + "/" + kCsvFileName;
+  CsvWriter::GetInstance().WriteRowAsync(filename, kCsvHeader, row.str());
   return true;
 }
 }  // namespace mindspore
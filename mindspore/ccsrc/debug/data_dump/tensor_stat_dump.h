@@ -21,12 +21,19 @@
 #include <string>
 #include <fstream>
 #include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <queue>
+#include <thread>
 
 #include "utils/ms_utils.h"
 
 namespace mindspore {
 class Debugger;
 class TensorData;
+// Statistics are written by a background thread, so the execution thread only formats rows and hands them over
+// through a bounded queue. All file operations are queued in order and run on the writer thread. Only Flush and
+// CloseFile wait for the writer thread, which is meant for the shutdown; the steps use the async ones.
 class CsvWriter {
  public:
   static CsvWriter &GetInstance() {
@@ -34,24 +41,50 @@ class CsvWriter {
     return instance;
   }
 
-  CsvWriter() = default;
+  explicit CsvWriter(size_t max_pending_tasks = kMaxPendingTasks);
   ~CsvWriter();
   DISABLE_COPY_AND_ASSIGN(CsvWriter)
-  bool OpenFile(const std::string &path, const std::string &header = "");
-  void CloseFile() noexcept;
-  template <typename T>
-  void WriteToCsv(const T &val, bool end_line = false);
+  void OpenFileAsync(const std::string &path, const std::string &header = "");
+  void WriteRowAsync(const std::string &path, const std::string &header, std::string &&row);
+  // Flushes or closes the file after the queued rows, and logs an error if any of them failed since the last check.
+  void FlushAsync();
+  void CloseFileAsync();
+  // Waits until the queued rows are written to disk. Returns false if any of them failed since the last check.
+  bool Flush();
+  // Same as Flush, and closes the file afterwards.
+  bool CloseFile();
+  size_t pending_tasks();
 
  private:
-  const std::string kSeparator = ",";
+  bool DoOpenFile(const std::string &path, const std::string &header);
+  void DoCloseFile() noexcept;
+  bool CheckWriteStatus();
+  bool PushTask(std::function<void()> &&task);
+  bool RunTask(std::function<bool()> &&task);
+  void WorkerLoop();
+
   const std::string kEndLine = "\n";
+  static constexpr size_t kMaxPendingTasks = 4096;
+  const size_t max_pending_tasks_;
+  // only accessed by the writer thread.
   std::ofstream file_;
   std::string file_path_str_ = "";
+  bool write_failed_{false};
+  std::queue<std::function<void()>> tasks_;
+  std::mutex task_mutex_;
+  std::condition_variable task_cond_var_;
+  std::condition_variable space_cond_var_;
+  bool stop_{false};
+  std::thread worker_;
 };
 
 class TensorStatDump {
  public:
-  static bool OpenStatisticsFile(const std::string &dump_path);
+  // The file operations of a step are queued after its statistics, failures are logged by the writer thread.
+  static void OpenStatisticsFile(const std::string &dump_path);
+  static void CloseStatisticsFile();
+  // Waits until all the statistics are in the file and closes it, returns false if any of them failed to be written.
+  static bool FinalizeStatisticsFile();
 
   TensorStatDump(const std::string &op_type, const std::string &op_name, uint32_t task_id, uint32_t stream_id,
                  uint64_t timestamp, bool input, size_t slot, size_t tensor_loader_slot_);
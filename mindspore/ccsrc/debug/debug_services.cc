@@ -216,7 +216,7 @@ DebugServices::TensorStat DebugServices::GetTensorStatistics(const std::shared_p
                               base_summary_ptr->neg_zero_count(), base_summary_ptr->pos_zero_count(),
                               base_summary_ptr->nan_count(), base_summary_ptr->neg_inf_count(),
                               base_summary_ptr->pos_inf_count(), base_summary_ptr->zero_count());
-
+  tensor_stat_data.l2_norm_value = base_summary_ptr->l2_norm_value();
   return tensor_stat_data;
 }
 
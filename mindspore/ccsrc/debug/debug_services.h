@@ -265,6 +265,7 @@ class DebugServices {
     uint64_t neg_inf_count = 0;
     uint64_t pos_inf_count = 0;
     uint64_t zero_count = 0;
+    double l2_norm_value = 0.0;
   };
 
   struct ChunkData {
@@ -33,6 +33,7 @@
 #include "runtime/device/kernel_runtime_manager.h"
 #include "runtime/device/kernel_runtime.h"
 #include "debug/data_dump/e2e_dump.h"
+#include "debug/data_dump/tensor_stat_dump.h"
 #include "include/common/utils/config_manager.h"
 #include "include/common/debug/env_config_parser.h"
 #include "include/common/utils/comm_manager.h"
@@ -280,6 +281,10 @@ void Debugger::Reset() {
     MS_LOG(INFO) << "Join Heartbeat thread.";
   }
   heartbeat_thread_ = nullptr;
+  if (DumpJsonParser::GetInstance().IsStatisticDump()) {
+    // the steps only queue their statistics, wait for all of them before the process exits.
+    (void)TensorStatDump::FinalizeStatisticsFile();
+  }
   device_id_ = 0;
   device_target_ = "";
   num_step_ = 0;
@@ -106,6 +106,7 @@ TensorSummary<T>::TensorSummary(const void *current_tensor_ptr, const void *cons
       inf_count_(0),
       nan_count_(0),
       zero_count_(0),
+      square_sum_(0.0),
       epsilon_(1.0e-9),
       mean_sd_cal_enabled_(false) {}
 
@@ -219,6 +220,7 @@ void TensorSummary<T>::TensorStatistics(DbgDataType dtype_value) {
     inf_count_ += cur_summary.inf_count_;
     nan_count_ += cur_summary.nan_count_;
     zero_count_ += cur_summary.zero_count_;
+    square_sum_ += cur_summary.square_sum_;
   }
 }
 
@@ -230,35 +232,50 @@ void TensorSummary<T>::TensorStatistics(DbgDataType dtype_value) {
  */
 template <typename T>
 void TensorSummary<T>::TensorStatisticsSingleThread() {
-  MeanCalculator mean_calc = MeanCalculator();
+  // Keep all accumulators in locals and update them without data-dependent branches, so that the compiler can
+  // vectorize the loop.
+  uint64_t pos_inf_count = 0;
+  uint64_t neg_inf_count = 0;
+  uint64_t nan_count = 0;
+  uint64_t zero_count = 0;
+  uint64_t neg_count = 0;
+  uint64_t pos_count = 0;
+  uint64_t valid_count = 0;
+  double max_value = max_;
+  double min_value = min_;
+  double sum = 0.0;
+  double square_sum = 0.0;
   for (size_t i = 0; i < num_elements_; ++i) {
     auto current_value = static_cast<double>(current_tensor_ptr_[i]);
-    if (std::isinf(current_value)) {
-      if (current_value > 0) {
-        pos_inf_count_ += 1;
-      } else {
-        neg_inf_count_ += 1;
-      }
-    }
-    if (current_value == 0) {
-      zero_count_ += 1;
-    }
-    if (std::isnan(current_value)) {
-      nan_count_ += 1;
-    }
-    if (!(std::isnan(current_value) || std::isinf(current_value))) {
-      // only considering tensor elements with value
-      if (std::signbit(current_value) && !(current_value == 0)) {
-        neg_zero_count_ += 1;
-      } else if (!(current_value == 0)) {
-        pos_zero_count_ += 1;
-      }
-      max_ = std::max(max_, current_value);
-      min_ = std::min(min_, current_value);
-      mean_calc.ProcessElement(current_value);
-    }
+    bool is_nan = std::isnan(current_value);
+    bool is_inf = std::isinf(current_value);
+    bool is_valid = !(is_nan || is_inf);
+    bool is_zero = current_value == 0;
+    bool is_neg = current_value < 0;
+    pos_inf_count += static_cast<uint64_t>(is_inf && !is_neg);
+    neg_inf_count += static_cast<uint64_t>(is_inf && is_neg);
+    nan_count += static_cast<uint64_t>(is_nan);
+    zero_count += static_cast<uint64_t>(is_zero);
+    // only considering tensor elements with value
+    neg_count += static_cast<uint64_t>(is_valid && is_neg);
+    pos_count += static_cast<uint64_t>(is_valid && !is_neg && !is_zero);
+    valid_count += static_cast<uint64_t>(is_valid);
+    double valid_value = is_valid ? current_value : 0.0;
+    max_value = (is_valid && current_value > max_value) ? current_value : max_value;
+    min_value = (is_valid && current_value < min_value) ? current_value : min_value;
+    sum += valid_value;
+    square_sum += valid_value * valid_value;
   }
-  avg_ = mean_calc.GetMean();
+  pos_inf_count_ += pos_inf_count;
+  neg_inf_count_ += neg_inf_count;
+  nan_count_ += nan_count;
+  zero_count_ += zero_count;
+  neg_zero_count_ += neg_count;
+  pos_zero_count_ += pos_count;
+  max_ = max_value;
+  min_ = min_value;
+  avg_ = valid_count == 0 ? 0.0 : sum / static_cast<double>(valid_count);
+  square_sum_ += square_sum;
 }
 
 /*
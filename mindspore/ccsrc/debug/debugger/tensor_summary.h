@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_TENSOR_SUMMARY_H
 #define MINDSPORE_TENSOR_SUMMARY_H
 
+#include <cmath>
 #include <vector>
 #include <tuple>
 #include <memory>
@@ -110,6 +111,7 @@ class ITensorSummary {
   virtual const uint64_t neg_inf_count() const = 0;
   virtual const uint64_t pos_inf_count() const = 0;
   virtual const uint64_t zero_count() const = 0;
+  virtual const double l2_norm_value() const = 0;
 };
 
 template <typename T>
@@ -133,6 +135,7 @@ class TensorSummary : public ITensorSummary {
   const uint64_t neg_inf_count() const override { return neg_inf_count_; }
   const uint64_t pos_inf_count() const override { return pos_inf_count_; }
   const uint64_t zero_count() const override { return zero_count_; }
+  const double l2_norm_value() const override { return std::sqrt(square_sum_); }
 
  private:
   const T *current_tensor_ptr_;
@@ -150,6 +153,7 @@ class TensorSummary : public ITensorSummary {
   uint64_t inf_count_;
   uint64_t nan_count_;
   uint64_t zero_count_;
+  double square_sum_;
   double epsilon_;
   bool mean_sd_cal_enabled_;
   VarianceAndMeanCalculator current_mean_variance_;
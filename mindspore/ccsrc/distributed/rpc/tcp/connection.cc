@@ -340,17 +340,19 @@ void Connection::FillSendMessage(MessageBase *msg, const std::string &advertiseU
       send_io_vec[index].iov_base = const_cast<char *>(send_from.data());
       send_io_vec[index].iov_len = send_from.size();
       ++index;
-      send_io_vec[index].iov_base = const_cast<char *>(msg->body.data());
-      send_io_vec[index].iov_len = msg->body.size();
+      // The external buffer is sent directly by scatter-gather io without being copied into the body string.
+      size_t body_size = GetMessageBodySize(*msg);
+      send_io_vec[index].iov_base = GetMessageBodyData(*msg);
+      send_io_vec[index].iov_len = body_size;
       ++index;
       send_kernel_msg.msg_iov = send_io_vec;
       send_kernel_msg.msg_iovlen = index;
       total_send_len =
-        UlongToUint(sizeof(send_msg_header)) + msg->name.size() + send_to.size() + send_from.size() + msg->body.size();
+        UlongToUint(sizeof(send_msg_header)) + msg->name.size() + send_to.size() + send_from.size() + body_size;
       send_message = msg;
 
       // update metrics
-      send_metrics->UpdateMax(msg->body.size());
+      send_metrics->UpdateMax(body_size);
       send_metrics->last_send_msg_name = msg->name;
       return;
     } else {
@@ -362,6 +364,14 @@ void Connection::FillSendMessage(MessageBase *msg, const std::string &advertiseU
           advertise_addr_ = advertiseUrl.substr(idx + sizeof(URL_PROTOCOL_IP_SEPARATOR) - 1);
         }
       }
+      // Http messages are generated as a whole string, so the external buffer is copied and released here.
+      if (msg->HasExternalData()) {
+        (void)msg->body.assign(static_cast<char *>(msg->external_data), msg->external_size);
+        if (msg->external_data_release != nullptr) {
+          msg->external_data_release(msg->external_data, msg->external_size);
+        }
+        msg->SetExternalData(nullptr, 0, nullptr);
+      }
       msg->body = GenerateHttpMessage(msg);
     }
 
@@ -398,7 +408,16 @@ void Connection::FillRecvMessage() {
   msg->name.resize(recvNameLen);
   recv_to.resize(recvToLen);
   recv_from.resize(recvFromLen);
-  msg->body.resize(recvBodyLen);
+  // Read the body into the buffer registered by the receiver if any, which saves allocating and copying the body.
+  void *recv_body_buf = nullptr;
+  if (recv_allocate_callback != nullptr && recvBodyLen > 0) {
+    recv_body_buf = recv_allocate_callback(recvBodyLen);
+  }
+  if (recv_body_buf != nullptr) {
+    msg->SetExternalData(recv_body_buf, recvBodyLen, recv_free_callback);
+  } else {
+    msg->body.resize(recvBodyLen);
+  }
 
   recv_io_vec[i].iov_base = const_cast<char *>(msg->name.data());
   recv_io_vec[i].iov_len = msg->name.size();
@@ -409,13 +428,13 @@ void Connection::FillRecvMessage() {
   recv_io_vec[i].iov_base = const_cast<char *>(recv_from.data());
   recv_io_vec[i].iov_len = recv_from.size();
   ++i;
-  recv_io_vec[i].iov_base = const_cast<char *>(msg->body.data());
-  recv_io_vec[i].iov_len = msg->body.size();
+  recv_io_vec[i].iov_base = GetMessageBodyData(*msg);
+  recv_io_vec[i].iov_len = recvBodyLen;
   ++i;
 
   recv_kernel_msg.msg_iov = recv_io_vec;
   recv_kernel_msg.msg_iovlen = IntToSize(i);
-  total_recv_len = msg->name.size() + recv_to.size() + recv_from.size() + msg->body.size();
+  total_recv_len = msg->name.size() + recv_to.size() + recv_from.size() + recvBodyLen;
 
   // There is no need to delete recv_message first because the recv_message has already been returned to the caller and
   // it's the caller's responsibility to release the received message after using it.
@@ -437,8 +456,8 @@ int Connection::Flush() {
         // update metrics
         send_metrics->UpdateError(false);
 
-        output_buffer_size -= send_message->body.size();
-        total_send_bytes += send_message->body.size();
+        output_buffer_size -= GetMessageBodySize(*send_message);
+        total_send_bytes += GetMessageBodySize(*send_message);
         delete send_message;
         send_message = nullptr;
         break;
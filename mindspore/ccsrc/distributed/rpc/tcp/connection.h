@@ -189,6 +189,10 @@ struct Connection {
   // Function for handling received messages.
   MessageHandler message_handler;
 
+  // Functions for allocating and releasing the buffer which the received message body is read into.
+  MemAllocateCallback recv_allocate_callback;
+  MemFreeCallback recv_free_callback;
+
   // Buffer for messages to be sent.
   std::queue<MessageBase *> send_message_queue;
 
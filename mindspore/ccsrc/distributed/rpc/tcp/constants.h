@@ -33,6 +33,11 @@ namespace rpc {
 using MessageHandler = std::function<MessageBase *const(MessageBase *const)>;
 using DeleteCallBack = void (*)(const std::string &from, const std::string &to);
 using ConnectionCallBack = void (*)(void *conn);
+// Allocate the buffer which the received message body is read into directly. Returning nullptr means the body is read
+// into the `body` string of the message.
+using MemAllocateCallback = std::function<void *(size_t size)>;
+// Release the buffer allocated by MemAllocateCallback once the received message is destroyed.
+using MemFreeCallback = std::function<void(void *data, size_t size)>;
 
 constexpr int SEND_MSG_IO_VEC_LEN = 5;
 constexpr int RECV_MSG_IO_VEC_LEN = 4;
@@ -115,6 +120,16 @@ struct MessageHeader {
   uint32_t body_len{0};
 };
 
+// Return the byte size of the message body, which is either the external buffer or the body string.
+__attribute__((unused)) static size_t GetMessageBodySize(const MessageBase &message) {
+  return message.HasExternalData() ? message.external_size : message.body.size();
+}
+
+// Return the address of the message body, which is either the external buffer or the body string.
+__attribute__((unused)) static void *GetMessageBodyData(const MessageBase &message) {
+  return message.HasExternalData() ? message.external_data : const_cast<char *>(message.body.data());
+}
+
 // Fill the message header using the given message.
 __attribute__((unused)) static void FillMessageHeader(const MessageBase &message, MessageHeader *header) {
   std::string send_to = message.to;
@@ -122,14 +137,15 @@ __attribute__((unused)) static void FillMessageHeader(const MessageBase &message
   header->name_len = htonl(static_cast<uint32_t>(message.name.size()));
   header->to_len = htonl(static_cast<uint32_t>(send_to.size()));
   header->from_len = htonl(static_cast<uint32_t>(send_from.size()));
-  header->body_len = htonl(static_cast<uint32_t>(message.body.size()));
+  header->body_len = htonl(static_cast<uint32_t>(GetMessageBodySize(message)));
 }
 
 // Compute and return the byte size of the whole message.
 __attribute__((unused)) static size_t GetMessageSize(const MessageBase &message) {
   std::string send_to = message.to;
   std::string send_from = message.from;
-  size_t size = message.name.size() + send_to.size() + send_from.size() + message.body.size() + sizeof(MessageHeader);
+  size_t size =
+    message.name.size() + send_to.size() + send_from.size() + GetMessageBodySize(message) + sizeof(MessageHeader);
   return size;
 }
 
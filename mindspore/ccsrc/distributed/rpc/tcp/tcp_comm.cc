@@ -112,6 +112,8 @@ void OnAccept(int server, uint32_t events, void *arg) {
 
   conn->conn_mutex = tcpmgr->conn_mutex_;
   conn->message_handler = tcpmgr->message_handler_;
+  conn->recv_allocate_callback = tcpmgr->allocate_callback_;
+  conn->recv_free_callback = tcpmgr->free_callback_;
 
   conn->event_callback = TCPComm::EventCallBack;
   conn->write_callback = TCPComm::WriteCallBack;
@@ -134,6 +136,12 @@ void OnAccept(int server, uint32_t events, void *arg) {
 
 void TCPComm::SetMessageHandler(const MessageHandler &handler) { message_handler_ = handler; }
 
+void TCPComm::SetRecvBufferCallback(const MemAllocateCallback &allocate_callback,
+                                    const MemFreeCallback &free_callback) {
+  allocate_callback_ = allocate_callback;
+  free_callback_ = free_callback;
+}
+
 bool TCPComm::Initialize() {
   conn_pool_ = std::make_shared<ConnectionPool>();
   MS_EXCEPTION_IF_NULL(conn_pool_);
@@ -362,6 +370,8 @@ bool TCPComm::Connect(const std::string &dst_url) {
     conn->send_event_loop = this->send_event_loop_;
     conn->conn_mutex = conn_mutex_;
     conn->message_handler = message_handler_;
+    conn->recv_allocate_callback = allocate_callback_;
+    conn->recv_free_callback = free_callback_;
     conn->InitSocketOperation();
 
     // Create the client socket.
@@ -447,6 +457,8 @@ Connection *TCPComm::CreateDefaultConn(const std::string &to) {
   conn->send_event_loop = this->send_event_loop_;
   conn->conn_mutex = conn_mutex_;
   conn->message_handler = message_handler_;
+  conn->recv_allocate_callback = allocate_callback_;
+  conn->recv_free_callback = free_callback_;
   conn->InitSocketOperation();
   return conn;
 }
@@ -68,6 +68,9 @@ class TCPComm {
   // Set the message processing handler.
   void SetMessageHandler(const MessageHandler &handler);
 
+  // Set the callbacks for the buffer which received message bodies are read into directly.
+  void SetRecvBufferCallback(const MemAllocateCallback &allocate_callback, const MemFreeCallback &free_callback);
+
   // Get the file descriptor of server socket.
   int GetServerFd() const;
 
@@ -102,6 +105,10 @@ class TCPComm {
   // User defined handler for Handling received messages.
   MessageHandler message_handler_;
 
+  // User defined callbacks for the receiving buffer of message bodies.
+  MemAllocateCallback allocate_callback_;
+  MemFreeCallback free_callback_;
+
   // All the connections share the same read and write event loop objects.
   EventLoop *recv_event_loop_;
   EventLoop *send_event_loop_;
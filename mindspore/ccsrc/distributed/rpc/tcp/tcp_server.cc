@@ -33,6 +33,11 @@ void TCPServer::Finalize() {
 
 void TCPServer::SetMessageHandler(const MessageHandler &handler) { tcp_comm_->SetMessageHandler(handler); }
 
+void TCPServer::SetRecvBufferCallback(const MemAllocateCallback &allocate_callback,
+                                      const MemFreeCallback &free_callback) {
+  tcp_comm_->SetRecvBufferCallback(allocate_callback, free_callback);
+}
+
 std::string TCPServer::GetIP() const { return ip_; }
 
 uint32_t TCPServer::GetPort() const { return port_; }
@@ -43,6 +43,9 @@ class TCPServer {
   // Set the message processing handler.
   void SetMessageHandler(const MessageHandler &handler);
 
+  // Set the callbacks for the buffer which received message bodies are read into directly.
+  void SetRecvBufferCallback(const MemAllocateCallback &allocate_callback, const MemFreeCallback &free_callback);
+
   // Return the IP and port binded by this server.
   std::string GetIP() const;
   uint32_t GetPort() const;
@@ -17,12 +17,17 @@
 #ifndef MINDSPORE_CCSRC_FL_SERVER_KERNEL_FED_AVG_KERNEL_H_
 #define MINDSPORE_CCSRC_FL_SERVER_KERNEL_FED_AVG_KERNEL_H_
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 #include <functional>
 #include "plugin/device/cpu/kernel/cpu_kernel.h"
+#include "plugin/device/cpu/kernel/nnacl/fp32/add_fp32.h"
 #include "fl/server/common.h"
 #include "fl/server/collective_ops_impl.h"
 #include "fl/server/distributed_count_service.h"
@@ -35,6 +40,75 @@ namespace fl {
 namespace server {
 namespace kernel {
 constexpr size_t kFedAvgInputsNum = 4;
+// The element number of each weight shard which is accumulated under its own lock.
+constexpr size_t kFedAvgShardElemNum = 16384;
+
+template <typename T>
+inline void AccumulateWeightShard(T *weight_addr, const T *new_weight_addr, size_t elem_num) {
+  for (size_t i = 0; i < elem_num; i++) {
+    weight_addr[i] += new_weight_addr[i];
+  }
+}
+
+template <>
+inline void AccumulateWeightShard<float>(float *weight_addr, const float *new_weight_addr, size_t elem_num) {
+  (void)ElementAdd(weight_addr, new_weight_addr, weight_addr, SizeToInt(elem_num));
+}
+
+// Accumulates the uploaded weights into the weight shard by shard, so that concurrent uploads mostly work on disjoint
+// shards. Each upload starts from a different shard and skips the shards which are being accumulated by other uploads,
+// then it waits for the skipped ones at last.
+template <typename T>
+class WeightShardAccumulator {
+ public:
+  WeightShardAccumulator() = default;
+  ~WeightShardAccumulator() = default;
+
+  void Init(size_t weight_elem_num) {
+    shard_num_ = (weight_elem_num + kFedAvgShardElemNum - 1) / kFedAvgShardElemNum;
+    shard_mutexes_ = std::make_unique<std::mutex[]>(shard_num_);
+  }
+
+  bool Accumulate(T *weight_addr, const T *new_weight_addr, size_t elem_num) {
+    size_t shard_num = (elem_num + kFedAvgShardElemNum - 1) / kFedAvgShardElemNum;
+    if (shard_num > shard_num_) {
+      MS_LOG(ERROR) << "The new weight element number " << elem_num << " exceeds the weight.";
+      return false;
+    }
+    if (shard_num == 0) {
+      return true;
+    }
+    auto accumulate_shard = [&](size_t shard) {
+      size_t offset = shard * kFedAvgShardElemNum;
+      size_t shard_elem_num = std::min(kFedAvgShardElemNum, elem_num - offset);
+      AccumulateWeightShard<T>(weight_addr + offset, new_weight_addr + offset, shard_elem_num);
+    };
+
+    size_t start_shard = next_start_shard_.fetch_add(1) % shard_num;
+    std::vector<size_t> busy_shards;
+    for (size_t i = 0; i < shard_num; i++) {
+      size_t shard = (start_shard + i) % shard_num;
+      std::unique_lock<std::mutex> shard_lock(shard_mutexes_[shard], std::try_to_lock);
+      if (!shard_lock.owns_lock()) {
+        busy_shards.push_back(shard);
+        continue;
+      }
+      accumulate_shard(shard);
+    }
+    for (size_t shard : busy_shards) {
+      std::unique_lock<std::mutex> shard_lock(shard_mutexes_[shard]);
+      accumulate_shard(shard);
+    }
+    return true;
+  }
+
+ private:
+  // The weight is split into shards of kFedAvgShardElemNum elements, each of which is guarded by its own mutex.
+  size_t shard_num_{0};
+  std::unique_ptr<std::mutex[]> shard_mutexes_{nullptr};
+  std::atomic<size_t> next_start_shard_{0};
+};
+
 // The implementation for the federated average. We do weighted average for the weights. The uploaded weights from
 // FL-clients is already multiplied by its data size so only sum and division are done in this kernel.
 
@@ -75,6 +149,8 @@ class FedAvgKernel : public AggregationKernelMod {
     input_size_list_.push_back(new_weight_size);
     input_size_list_.push_back(sizeof(size_t));
 
+    weight_accumulator_.Init(weight_size / sizeof(T));
+
     auto weight_node =
       common::AnfAlgo::VisitKernelWithReturnType(common::AnfAlgo::GetInputNode(kernel_node, cnode_weight_idx_), 0)
         .first;
@@ -89,7 +165,7 @@ class FedAvgKernel : public AggregationKernelMod {
   }
 
   bool AllReduce() override {
-    std::unique_lock<std::mutex> lock(weight_mutex_);
+    std::unique_lock<std::shared_mutex> lock(weight_mutex_);
     MS_ERROR_IF_NULL_W_RET_VAL(weight_addr_, false);
     MS_ERROR_IF_NULL_W_RET_VAL(data_size_addr_, false);
     MS_ERROR_IF_NULL_W_RET_VAL(weight_addr_->addr, false);
@@ -127,7 +203,8 @@ class FedAvgKernel : public AggregationKernelMod {
       MS_ERROR_IF_NULL_W_RET_VAL(inputs[i]->addr, false);
     }
 
-    std::unique_lock<std::mutex> lock(weight_mutex_);
+    // The uploads of different clients hold the weight in shared mode and only exclude each other on the same shard.
+    std::shared_lock<std::shared_mutex> lock(weight_mutex_);
     if (done_) {
       MS_LOG(INFO) << "AllReduce for " << name_ << " has finished";
       return true;
@@ -142,10 +219,14 @@ class FedAvgKernel : public AggregationKernelMod {
     MS_LOG(DEBUG) << "Iteration: " << LocalMetaStore::GetInstance().curr_iter_num() << " launching FedAvgKernel for "
                   << name_ << " new data size is " << new_data_size_addr[0] << ", current total data size is "
                   << data_size_addr[0];
-    for (size_t i = 0; i < inputs[2]->size / sizeof(T); i++) {
-      weight_addr[i] += new_weight_addr[i];
+    if (!weight_accumulator_.Accumulate(weight_addr, new_weight_addr, inputs[2]->size / sizeof(T))) {
+      MS_LOG(ERROR) << "Accumulating the new weight of " << name_ << " failed.";
+      return false;
+    }
+    {
+      std::unique_lock<std::mutex> data_size_lock(data_size_mutex_);
+      data_size_addr[0] += new_data_size_addr[0];
     }
-    data_size_addr[0] += new_data_size_addr[0];
     lock.unlock();
 
     accum_count_++;
@@ -208,8 +289,12 @@ class FedAvgKernel : public AggregationKernelMod {
   AddressPtr data_size_addr_;
   AddressPtr new_weight_addr_;
   AddressPtr new_data_size_addr_;
-  // The kernel could be called concurrently so we need lock to ensure threadsafe.
-  std::mutex weight_mutex_;
+  // The kernel could be called concurrently so we need lock to ensure threadsafe. Launch holds it in shared mode and
+  // AllReduce holds it exclusively.
+  std::shared_mutex weight_mutex_;
+  std::mutex data_size_mutex_;
+
+  WeightShardAccumulator<T> weight_accumulator_;
 };
 }  // namespace kernel
 }  // namespace server
@@ -33,7 +33,9 @@ namespace opt {
 SubstitutionPtr MakeSubstitution(const OptimizerCallerPtr &transform, const std::string &name, const PrimitivePtr &prim,
                                  const RenormAction &renorm_action, bool has_priority_pattern) {
   auto fn = [prim](const AnfNodePtr &node) -> bool { return IsPrimitiveCNode(node, prim); };
-  return std::make_shared<Substitution>(transform, name, fn, renorm_action, has_priority_pattern);
+  auto substitution = std::make_shared<Substitution>(transform, name, fn, renorm_action, has_priority_pattern);
+  substitution->prims_ = {prim};
+  return substitution;
 }
 
 SubstitutionPtr MakeSubstitution(const OptimizerCallerPtr &transform, const std::string &name,
@@ -61,7 +63,9 @@ SubstitutionPtr MakeSubstitution(const OptimizerCallerPtr &transform, const std:
     return false;
   };
 
-  return std::make_shared<Substitution>(transform, name, fn, renorm_action, has_priority_pattern);
+  auto substitution = std::make_shared<Substitution>(transform, name, fn, renorm_action, has_priority_pattern);
+  substitution->prims_ = prims;
+  return substitution;
 }
 
 SubstitutionPtr MakeSubstitution(const OptimizerCallerPtr &transform, const std::string &name,
@@ -187,6 +191,42 @@ static void UpdateTransformingListWithUserNodes(const OptimizerPtr &optimizer, c
   }
 }
 
+void SubstitutionList::BuildSubstitutionIndex() {
+  for (const auto &substitution : list_) {
+    MS_EXCEPTION_IF_NULL(substitution);
+    if (substitution->prims_.empty()) {
+      generic_list_.push_back(substitution);
+      continue;
+    }
+    for (const auto &prim : substitution->prims_) {
+      MS_EXCEPTION_IF_NULL(prim);
+      (void)prim_to_list_.emplace(prim->name(), std::vector<SubstitutionPtr>());
+    }
+  }
+  // Keep the order of list_, since the former substitution takes priority over the latter one.
+  for (auto &iter : prim_to_list_) {
+    const auto &prim_name = iter.first;
+    for (const auto &substitution : list_) {
+      const auto &prims = substitution->prims_;
+      if (prims.empty() || std::any_of(prims.begin(), prims.end(),
+                                       [&prim_name](const PrimitivePtr &prim) { return prim->name() == prim_name; })) {
+        iter.second.push_back(substitution);
+      }
+    }
+  }
+}
+
+const std::vector<SubstitutionPtr> &SubstitutionList::GetCandidateSubstitutions(const AnfNodePtr &node) const {
+  auto prim = GetCNodePrimitive(node);
+  if (prim != nullptr) {
+    auto iter = prim_to_list_.find(prim->name());
+    if (iter != prim_to_list_.end()) {
+      return iter->second;
+    }
+  }
+  return generic_list_;
+}
+
 bool SubstitutionList::ApplyIRToSubstitutions(const OptimizerPtr &optimizer, const FuncGraphPtr &func_graph) const {
 #ifdef ENABLE_PROFILE
   double start = GetTime();
@@ -208,7 +248,8 @@ bool SubstitutionList::ApplyIRToSubstitutions(const OptimizerPtr &optimizer, con
     node->seen_ = seen;
 
     bool change = false;
-    for (auto &substitution : list_) {
+    // Only try the substitutions which declare the primitive of the node or declare no primitive.
+    for (auto &substitution : GetCandidateSubstitutions(node)) {
       auto res = DoTransform(optimizer, node, substitution);
       if (res != nullptr) {
         change = true;
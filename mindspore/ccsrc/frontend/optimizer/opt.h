@@ -48,6 +48,8 @@ class Substitution {
   RenormAction renorm_action_;
   // Determine whether it is a priority substitution, that is, some patterns need to be matched prior to others.
   bool has_priority_pattern_{false};
+  // The primitives of the cnodes which the substitution can match, empty means it may match any node.
+  std::vector<PrimitivePtr> prims_;
 
   Substitution(const OptimizerCallerPtr &transform, const std::string &name, const PredicateFuncType &predicate,
                const RenormAction &renorm_action, bool has_priority_pattern)
@@ -77,12 +79,17 @@ class SubstitutionList {
  public:
   explicit SubstitutionList(const std::vector<SubstitutionPtr> &patterns, bool is_once = false,
                             bool global_sensitive = false)
-      : list_(patterns), is_once_(is_once), global_sensitive_(global_sensitive) {}
+      : list_(patterns), is_once_(is_once), global_sensitive_(global_sensitive) {
+    BuildSubstitutionIndex();
+  }
   ~SubstitutionList() = default;
 
   bool operator()(const FuncGraphPtr &func_graph, const OptimizerPtr &optimizer) const;
 
  private:
+  void BuildSubstitutionIndex();
+  // Get the substitutions which may match the node, in the same order as list_.
+  const std::vector<SubstitutionPtr> &GetCandidateSubstitutions(const AnfNodePtr &node) const;
   bool ApplyIRToSubstitutions(const OptimizerPtr &optimizer, const FuncGraphPtr &func_graph) const;
   bool ApplySubstitutionToIR(const OptimizerPtr &optimizer, const FuncGraphPtr &func_graph,
                              const SubstitutionPtr &sub) const;
@@ -91,6 +98,10 @@ class SubstitutionList {
                                    const OptimizerPtr &optimizer, size_t space) const;
 
   std::vector<SubstitutionPtr> list_;
+  // The substitutions which declare no primitive, they are tried on every node.
+  std::vector<SubstitutionPtr> generic_list_;
+  // Primitive name to the substitutions which may match the cnodes of this primitive, including the generic ones.
+  mindspore::HashMap<std::string, std::vector<SubstitutionPtr>> prim_to_list_;
   // a flag to mark this list of Substitution can only be executed only once
   bool is_once_{false};
   bool global_sensitive_{false};
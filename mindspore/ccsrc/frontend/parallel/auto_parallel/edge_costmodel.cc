@@ -24,9 +24,25 @@
 #include "frontend/parallel/auto_parallel/graph_costmodel.h"
 #include "frontend/parallel/tensor_layout/tensor_redistribution.h"
 #include "frontend/parallel/ops_info/reshape_info.h"
+#include "include/common/thread_pool.h"
+#include "utils/ms_exception.h"
 
 namespace mindspore {
 namespace parallel {
+namespace {
+// Deduplicate the tensor layouts, 'layout_ids' records the index of each layout in 'unique_layouts'.
+void UniqueTensorLayouts(const std::vector<TensorLayout> &layouts, std::vector<TensorLayout> *unique_layouts,
+                         std::vector<size_t> *layout_ids) {
+  for (const auto &layout : layouts) {
+    auto iter = std::find(unique_layouts->begin(), unique_layouts->end(), layout);
+    (void)layout_ids->emplace_back(static_cast<size_t>(std::distance(unique_layouts->begin(), iter)));
+    if (iter == unique_layouts->end()) {
+      (void)unique_layouts->emplace_back(layout);
+    }
+  }
+}
+}  // namespace
+
 Status Edge::InitEdgeCost() {
   bool has_available_cost = false;
   pre_op_output_.clear();
@@ -64,33 +80,7 @@ Status Edge::InitEdgeCost() {
       }
     }
   } else {
-    for (auto &target_output : pre_op_output_) {
-      auto target_output_lyt = target_output.second[prev_op_output_index_].tensor_layout();
-      auto target_output_str = target_output.first;
-      auto type_length = prev_op_->GetOutputTypeLengths()[prev_op_output_index_];
-      auto type = prev_op_->outputs_type()[prev_op_output_index_];
-      for (auto &target_input : next_op_input_) {
-        auto target_input_lyt = target_input.second[next_op_input_index_].tensor_layout();
-        auto target_input_str = target_input.first;
-        CostPtr cost;
-        if (GetRedistributionCost(target_output_lyt, target_input_lyt, type_length, type, &cost) != SUCCESS) {
-          MS_LOG(EXCEPTION) << "Failure: redistribution cost calculation failed";
-        }
-        MS_EXCEPTION_IF_NULL(cost);
-        MS_LOG(DEBUG) << "The redistribution cost: computation_cost: " << cost->computation_cost_
-                      << ", communication_cost: " << cost->communication_cost_
-                      << ", communication_without_parameter_: " << cost->communication_without_parameter_
-                      << ", communication_with_partial_para_: " << cost->communication_with_partial_para_ << ".";
-        // refine communication cost calculation for practice
-        RefineForPracticalCost(cost, true);
-        cost->communication_forward_ = cost->communication_redis_forward_;
-        CostPtrKey ck = {target_output_str, target_input_str};
-        CostPtrList cl;
-        cl.push_back(cost);
-        (void)cost_map_.emplace(std::make_pair(ck, cl));
-        has_available_cost = true;
-      }
-    }
+    has_available_cost = InitRedistributionEdgeCost();
   }
   if (!has_available_cost) {
     const auto fully_use = CostModelContext::GetInstance()->fully_use_device();
@@ -114,6 +104,83 @@ Status Edge::InitEdgeCost() {
   return Status::SUCCESS;
 }
 
+bool Edge::InitRedistributionEdgeCost() {
+  if (pre_op_output_.empty() || next_op_input_.empty()) {
+    return false;
+  }
+  auto type_length = prev_op_->GetOutputTypeLengths()[prev_op_output_index_];
+  auto type = prev_op_->outputs_type()[prev_op_output_index_];
+
+  // Different strategies often lead to the same tensor layout, so the redistribution cost is computed only once for
+  // each distinct pair of layouts.
+  std::vector<TensorLayout> output_layouts;
+  std::vector<TensorLayout> input_layouts;
+  std::transform(pre_op_output_.begin(), pre_op_output_.end(), std::back_inserter(output_layouts),
+                 [this](const auto &output) { return output.second[prev_op_output_index_].tensor_layout(); });
+  std::transform(next_op_input_.begin(), next_op_input_.end(), std::back_inserter(input_layouts),
+                 [this](const auto &input) { return input.second[next_op_input_index_].tensor_layout(); });
+  std::vector<TensorLayout> unique_output_layouts;
+  std::vector<TensorLayout> unique_input_layouts;
+  std::vector<size_t> output_layout_ids;
+  std::vector<size_t> input_layout_ids;
+  UniqueTensorLayouts(output_layouts, &unique_output_layouts, &output_layout_ids);
+  UniqueTensorLayouts(input_layouts, &unique_input_layouts, &input_layout_ids);
+
+  size_t input_layout_num = unique_input_layouts.size();
+  std::vector<CostPtr> layout_costs(unique_output_layouts.size() * input_layout_num, nullptr);
+  auto compute_costs = [&, this](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      for (size_t j = 0; j < input_layout_num; ++j) {
+        CostPtr cost;
+        if (GetRedistributionCost(unique_output_layouts[i], unique_input_layouts[j], type_length, type, &cost) !=
+            SUCCESS) {
+          MS_LOG(EXCEPTION) << "Failure: redistribution cost calculation failed";
+        }
+        MS_EXCEPTION_IF_NULL(cost);
+        MS_LOG(DEBUG) << "The redistribution cost: computation_cost: " << cost->computation_cost_
+                      << ", communication_cost: " << cost->communication_cost_
+                      << ", communication_without_parameter_: " << cost->communication_without_parameter_
+                      << ", communication_with_partial_para_: " << cost->communication_with_partial_para_ << ".";
+        // refine communication cost calculation for practice
+        RefineForPracticalCost(cost, true);
+        cost->communication_forward_ = cost->communication_redis_forward_;
+        layout_costs[i * input_layout_num + j] = cost;
+      }
+    }
+  };
+
+  size_t output_layout_num = unique_output_layouts.size();
+  size_t thread_num = common::ThreadPool::GetInstance().GetSyncRunThreadNum();
+  if (layout_costs.size() < parallel_cost_threshold_ || thread_num <= 1) {
+    compute_costs(0, output_layout_num);
+  } else {
+    size_t job_size = (output_layout_num + thread_num - 1) / thread_num;
+    std::vector<common::Task> tasks;
+    for (size_t begin = 0; begin < output_layout_num; begin += job_size) {
+      size_t end = std::min(begin + job_size, output_layout_num);
+      (void)tasks.emplace_back([&compute_costs, begin, end]() {
+        compute_costs(begin, end);
+        return common::SUCCESS;
+      });
+    }
+    (void)common::ThreadPool::GetInstance().SyncRun(tasks);
+    MsException::Instance().CheckException();
+  }
+
+  // Each strategy pair owns its cost, since the costs may be modified later.
+  for (size_t i = 0; i < pre_op_output_.size(); ++i) {
+    for (size_t j = 0; j < next_op_input_.size(); ++j) {
+      const auto &layout_cost = layout_costs[output_layout_ids[i] * input_layout_num + input_layout_ids[j]];
+      MS_EXCEPTION_IF_NULL(layout_cost);
+      CostPtrKey ck = {pre_op_output_[i].first, next_op_input_[j].first};
+      CostPtrList cl;
+      cl.push_back(std::make_shared<Cost>(*layout_cost));
+      (void)cost_map_.emplace(std::make_pair(ck, cl));
+    }
+  }
+  return true;
+}
+
 Status Edge::GetRedistributionCost(const TensorLayout &prev_op_output_layout, const TensorLayout &next_op_input_layout,
                                    size_t type_length, const TypePtr &type, CostPtr *cost) {
   MS_EXCEPTION_IF_NULL(prev_op_);
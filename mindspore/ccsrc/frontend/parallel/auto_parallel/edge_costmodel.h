@@ -33,6 +33,8 @@ namespace parallel {
 using CostPtrKey = std::pair<StrategyPtr, StrategyPtr>;
 using OperatorInfoPtr = std::shared_ptr<mindspore::parallel::OperatorInfo>;
 using EdgePtr = std::shared_ptr<mindspore::parallel::Edge>;
+// Compute the redistribution costs of an edge in parallel only if there are enough distinct layout pairs.
+constexpr size_t kParallelRedistributionCostThreshold = 64;
 
 struct OpsPtrCompare {
   bool operator()(const OperatorInfoPtr &a, const OperatorInfoPtr &b) const { return a->name().compare(b->name()) < 0; }
@@ -154,10 +156,14 @@ class Edge {
   // In the inference phase,
   Status CalculateMemoryCostForInference();
   void mark_output_critical() { is_output_critical_ = 1; }
+  void set_parallel_cost_threshold(size_t threshold) { parallel_cost_threshold_ = threshold; }
   // Whether there exists any available strategy in 'cost_map_'
   bool CheckStrategyCostPossibility() const;
 
  private:
+  // Compute the redistribution costs of all the strategy pairs into 'cost_map_', return whether any cost is created.
+  bool InitRedistributionEdgeCost();
+
   std::string edge_name_;
   std::shared_ptr<OperatorInfo> prev_op_, next_op_;
   std::map<CostPtrKey, CostPtrList> cost_map_;
@@ -183,6 +189,8 @@ class Edge {
   int64_t is_output_parameter_involve_ = -1;  // -1: unset; 0: not parameter_involved; 1: parameter_involved
   // In the inference phase, this is used to mark whether the output of the previous operator is critical.
   int64_t is_output_critical_ = 0;
+  // The minimum number of distinct layout pairs for which the redistribution costs are computed on the thread pool.
+  size_t parallel_cost_threshold_ = kParallelRedistributionCostThreshold;
 
   // Returns whether two double variable are equal.
   bool IsDoubleEqual(double x, double y) const { return std::abs(x - y) < EPS; }
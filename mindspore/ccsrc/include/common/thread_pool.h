@@ -32,6 +32,7 @@
 #include "include/common/visible.h"
 
 namespace mindspore {
+class ActorThreadPool;
 namespace common {
 enum Status { FAIL = -1, SUCCESS = 0 };
 using Task = std::function<Status()>;
@@ -49,14 +50,19 @@ class COMMON_EXPORT ThreadPool {
   ThreadPool &operator=(const ThreadPool &) = delete;
   static ThreadPool &GetInstance();
   bool SyncRun(const std::vector<Task> &tasks);
-  size_t GetSyncRunThreadNum() const { return max_thread_num_; }
+  size_t GetSyncRunThreadNum() const;
   void ClearThreadPool();
 
  private:
   ThreadPool();
   void SyncRunLoop(const std::shared_ptr<ThreadContext> &context);
+  // Once the actor runtime creates its thread pool, the tasks run on it instead of the threads of this pool, so that
+  // the actors, the kernels and SyncRun share one set of threads rather than oversubscribing the cores.
+  ActorThreadPool *GetSharedPool() const;
+  bool SyncRunOnSharedPool(ActorThreadPool *pool, const std::vector<Task> &tasks) const;
 
   size_t max_thread_num_{1};
+  bool use_shared_pool_{true};
   std::mutex pool_mtx_;
   std::atomic_bool exit_run_ = {false};
   std::vector<std::thread> sync_run_threads_{};
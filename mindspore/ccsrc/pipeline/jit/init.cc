@@ -551,7 +551,17 @@ PYBIND11_MODULE(_c_expression, m) {
     .def("set_download_compress_type", &PSContext::set_download_compress_type, "Set download compress type.")
     .def("download_compress_type", &PSContext::download_compress_type, "Get download compress type.")
     .def("set_checkpoint_dir", &PSContext::set_checkpoint_dir, "Set server checkpoint directory.")
-    .def("checkpoint_dir", &PSContext::checkpoint_dir, "Server checkpoint directory.");
+    .def("checkpoint_dir", &PSContext::checkpoint_dir, "Server checkpoint directory.")
+    .def("set_consistency_mode", &PSContext::set_consistency_mode, "Set consistency mode of parameter server.")
+    .def("consistency_mode", &PSContext::consistency_mode, "Get consistency mode of parameter server.")
+    .def("set_staleness_threshold", &PSContext::set_staleness_threshold,
+         "Set max step gap between workers in stale synchronous mode.")
+    .def("staleness_threshold", &PSContext::staleness_threshold,
+         "Get max step gap between workers in stale synchronous mode.")
+    .def("set_push_compress_type", &PSContext::set_push_compress_type, "Set compress type of pushed gradients.")
+    .def("push_compress_type", &PSContext::push_compress_type, "Get compress type of pushed gradients.")
+    .def("set_push_topk_ratio", &PSContext::set_push_topk_ratio, "Set ratio of pushed gradients in top-k mode.")
+    .def("push_topk_ratio", &PSContext::push_topk_ratio, "Get ratio of pushed gradients in top-k mode.");
   (void)m.def("_encrypt", &mindspore::pipeline::PyEncrypt, "Encrypt the data.");
   (void)m.def("_decrypt", &mindspore::pipeline::PyDecrypt, "Decrypt the data.");
   (void)m.def("_is_cipher_file", &mindspore::pipeline::PyIsCipherFile, "Determine whether the file is encrypted");
@@ -751,10 +751,14 @@ void AscendDeviceContext::UpdateDynamicShape(const CNodePtr &kernel) const {
     auto kernel_mod = AnfAlgo::GetKernelMod(kernel);
     MS_EXCEPTION_IF_NULL(kernel_mod);
     opt::dynamic_shape::InferOp(kernel);
+    if (opt::dynamic_shape::IsKernelModResized(kernel)) {
+      return;
+    }
     auto args = kernel->user_data<kernel::KernelArgs>();
     if (!kernel_mod->Resize(args->op, args->inputs, args->outputs, args->depend_tensor_map)) {
       MS_LOG(EXCEPTION) << "Node " << kernel->fullname_with_scope() << " Resize failed.";
     }
+    opt::dynamic_shape::SetKernelModResized(kernel);
   }
 }
 
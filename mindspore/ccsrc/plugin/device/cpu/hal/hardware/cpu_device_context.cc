@@ -309,6 +309,9 @@ void CPUDeviceContext::UpdateDynamicShape(const CNodePtr &kernel) const {
   MS_EXCEPTION_IF_NULL(func_graph);
   if (!(func_graph->has_attr(kAttrHasCustomOp) && GetValue<bool>(func_graph->get_attr(kAttrHasCustomOp)))) {
     opt::dynamic_shape::InferOp(kernel);
+    if (opt::dynamic_shape::IsKernelModResized(kernel)) {
+      return;
+    }
     auto args = kernel::GetArgsFromCNode(kernel);
     if (kernel_mod->GetKernelModType() == kernel::KernelModType::NativeCpuKernelMod) {
       auto update = kernel::AbstractArgsFromCNode(kernel);
@@ -322,6 +325,7 @@ void CPUDeviceContext::UpdateDynamicShape(const CNodePtr &kernel) const {
     if (!kernel_mod->Resize(args->op, args->inputs, args->outputs, args->depend_tensor_map)) {
       MS_LOG(EXCEPTION) << "Node " << kernel->fullname_with_scope() << " Resize failed.";
     }
+    opt::dynamic_shape::SetKernelModResized(kernel);
   }
 }
 
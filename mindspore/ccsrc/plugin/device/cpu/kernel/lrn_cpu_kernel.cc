@@ -75,8 +75,7 @@ void LrnCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   const auto dnnl_alpha = static_cast<float>(local_size) * alpha_;
   auto desc = CreateDesc<dnnl::lrn_forward::desc>(dnnl::prop_kind::forward_training, dnnl_algorithm_, src_desc,
                                                   local_size, dnnl_alpha, beta_, bias_);
-  auto prim_desc = CreateDesc<dnnl::lrn_forward::primitive_desc>(desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::lrn_forward>(prim_desc);
+  (void)CreateCachedPrimitive<dnnl::lrn_forward>(desc, &primitive_);
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_DST, src_desc);
 }
@@ -63,12 +63,12 @@ void LrnGradCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   const auto dnnl_alpha = static_cast<float>(local_size) * alpha_;
   auto desc = CreateDesc<dnnl::lrn_forward::desc>(dnnl::prop_kind::forward_training, dnnl_algorithm_, src_desc,
                                                   local_size, dnnl_alpha, beta_, bias_);
-  auto prim_desc = CreateDesc<dnnl::lrn_forward::primitive_desc>(desc, engine_);
+  std::shared_ptr<dnnl::primitive> forward_primitive{nullptr};
+  auto prim_desc = CreateCachedPrimitive<dnnl::lrn_forward>(desc, &forward_primitive);
   // Backward description
   auto backward_desc =
     CreateDesc<dnnl::lrn_backward::desc>(dnnl_algorithm_, src_desc, src_desc, local_size, dnnl_alpha, beta_, bias_);
-  auto backward_prim_desc = CreateDesc<dnnl::lrn_backward::primitive_desc>(backward_desc, engine_, prim_desc);
-  primitive_ = CreatePrimitive<dnnl::lrn_backward>(backward_prim_desc);
+  (void)CreateCachedPrimitive<dnnl::lrn_backward>(backward_desc, desc, prim_desc, &primitive_);
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_DST, src_desc);
   AddArgument(DNNL_ARG_DIFF_SRC, src_desc);
@@ -60,8 +60,7 @@ void AddNCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   dnnl::memory::desc src1_mem_desc = GetDefaultMemDesc(src1_shape);
   dnnl::memory::desc dst_mem_desc = GetDefaultMemDesc(dst_shape);
   auto desc = CreateDesc<dnnl::binary::desc>(dnnl::algorithm::binary_add, src0_mem_desc, src1_mem_desc, dst_mem_desc);
-  auto prim_desc = CreateDesc<dnnl::binary::primitive_desc>(desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::binary>(prim_desc);
+  (void)CreateCachedPrimitive<dnnl::binary>(desc, &primitive_);
   AddArgument(DNNL_ARG_SRC_0, src0_mem_desc);
   AddArgument(DNNL_ARG_SRC_1, src1_mem_desc);
   AddArgument(DNNL_ARG_DST, dst_mem_desc);
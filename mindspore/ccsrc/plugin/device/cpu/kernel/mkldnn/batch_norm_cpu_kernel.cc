@@ -60,11 +60,10 @@ void BatchNormCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
     normalization_flags = dnnl::normalization_flags::use_scale_shift;
   }
   auto desc = CreateDesc<dnnl::batch_normalization_forward::desc>(prop_kind, x_desc, epsilon, normalization_flags);
-  auto prim_desc = CreateDesc<dnnl::batch_normalization_forward::primitive_desc>(desc, engine_);
+  auto prim_desc = CreateCachedPrimitive<dnnl::batch_normalization_forward>(desc, &primitive_);
   auto wksp_desc = GetWorkspaceDesc(prim_desc);
   auto mean = GetMeanDesc(prim_desc);
   auto variance = GetVarianceDesc(prim_desc);
-  primitive_ = CreatePrimitive<dnnl::batch_normalization_forward>(prim_desc);
   AddArgument(DNNL_ARG_SRC, x_desc);
   AddArgument(DNNL_ARG_MEAN, mean);
   AddArgument(DNNL_ARG_VARIANCE, variance);
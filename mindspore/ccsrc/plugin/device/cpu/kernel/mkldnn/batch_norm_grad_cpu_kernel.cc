@@ -66,17 +66,17 @@ void BatchNormGradCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
 
   // fused Batch Normalization forward description
   auto desc = CreateDesc<dnnl::batch_normalization_forward::desc>(prop_kind, x_desc, epsilon, normalization_flags);
-  auto forward_prim_desc = CreateDesc<dnnl::batch_normalization_forward::primitive_desc>(desc, engine_);
+  std::shared_ptr<dnnl::primitive> forward_primitive{nullptr};
+  auto forward_prim_desc = CreateCachedPrimitive<dnnl::batch_normalization_forward>(desc, &forward_primitive);
 
   // fused Batch Normalization backward description
   auto backward_desc = CreateDesc<dnnl::batch_normalization_backward::desc>(dnnl::prop_kind::backward, x_desc, x_desc,
                                                                             epsilon, normalization_flags);
-  auto backward_prim_desc =
-    CreateDesc<dnnl::batch_normalization_backward::primitive_desc>(backward_desc, engine_, forward_prim_desc);
+  (void)CreateCachedPrimitive<dnnl::batch_normalization_backward>(backward_desc, desc, forward_prim_desc,
+                                                                  &primitive_);
   auto wksp_desc = GetWorkspaceDesc(forward_prim_desc);
   auto mean = GetMeanDesc(forward_prim_desc);
   auto variance = GetVarianceDesc(forward_prim_desc);
-  primitive_ = CreatePrimitive<dnnl::batch_normalization_backward>(backward_prim_desc);
   AddArgument(DNNL_ARG_SRC, x_desc);
   AddArgument(DNNL_ARG_MEAN, mean);
   AddArgument(DNNL_ARG_VARIANCE, variance);
@@ -85,8 +85,7 @@ void ConvCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   const auto desc = CreateDesc<dnnl::convolution_forward::desc>(
     dnnl::prop_kind::forward_training, dnnl::algorithm::convolution_auto, src_desc, weights_desc, dst_desc, strides,
     dilates, padding_l, padding_r);
-  const auto prim_desc = CreateDesc<dnnl::convolution_forward::primitive_desc>(desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::convolution_forward>(prim_desc);
+  (void)CreateCachedPrimitive<dnnl::convolution_forward>(desc, &primitive_);
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_WEIGHTS, weights_desc);
   AddArgument(DNNL_ARG_DST, dst_desc);
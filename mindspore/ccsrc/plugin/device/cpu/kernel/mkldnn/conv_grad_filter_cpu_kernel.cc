@@ -91,12 +91,12 @@ void ConvGradFilterCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   const auto forward_desc = CreateDesc<dnnl::convolution_forward::desc>(
     dnnl::prop_kind::forward_training, dnnl::algorithm::convolution_auto, src_desc, weights_desc, dst_desc, strides,
     dilates, padding_l, padding_r);
-  const auto forward_prim_desc = CreateDesc<dnnl::convolution_forward::primitive_desc>(forward_desc, engine_);
+  std::shared_ptr<dnnl::primitive> forward_primitive{nullptr};
+  const auto forward_prim_desc = CreateCachedPrimitive<dnnl::convolution_forward>(forward_desc, &forward_primitive);
   const auto backward_desc = CreateDesc<dnnl::convolution_backward_weights::desc>(
     dnnl::algorithm::convolution_auto, src_desc, weights_desc, dst_desc, strides, dilates, padding_l, padding_r);
-  const auto backward_prim_desc =
-    CreateDesc<dnnl::convolution_backward_weights::primitive_desc>(backward_desc, engine_, forward_prim_desc);
-  primitive_ = CreatePrimitive<dnnl::convolution_backward_weights>(backward_prim_desc);
+  (void)CreateCachedPrimitive<dnnl::convolution_backward_weights>(backward_desc, forward_desc, forward_prim_desc,
+                                                                  &primitive_);
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_DIFF_DST, dst_desc);
   AddArgument(DNNL_ARG_DIFF_WEIGHTS, weights_desc);
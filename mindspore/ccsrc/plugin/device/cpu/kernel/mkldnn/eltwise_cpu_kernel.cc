@@ -66,8 +66,7 @@ void EltWiseCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   dnnl::memory::desc src_desc = GetDefaultMemDesc(src_shape);
 
   auto desc = GetForwardEltwiseDesc(src_desc);
-  auto prim_desc = CreateDesc<dnnl::eltwise_forward::primitive_desc>(desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::eltwise_forward>(prim_desc);
+  (void)CreateCachedPrimitive<dnnl::eltwise_forward>(desc, &primitive_);
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_DST, src_desc);
 }
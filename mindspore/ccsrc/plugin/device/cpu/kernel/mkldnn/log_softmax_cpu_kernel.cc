@@ -39,8 +39,7 @@ void LogSoftmaxCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   }
   dnnl::memory::desc src_desc = GetDefaultMemDesc(src_shape);
   auto desc = CreateDesc<dnnl::logsoftmax_forward::desc>(dnnl::prop_kind::forward_training, src_desc, axis);
-  auto prim_desc = CreateDesc<dnnl::logsoftmax_forward::primitive_desc>(desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::logsoftmax_forward>(prim_desc);
+  (void)CreateCachedPrimitive<dnnl::logsoftmax_forward>(desc, &primitive_);
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_DST, src_desc);
 }
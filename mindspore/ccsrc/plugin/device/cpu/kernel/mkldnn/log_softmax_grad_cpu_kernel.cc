@@ -39,11 +39,11 @@ void LogSoftmaxGradCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   }
   dnnl::memory::desc src_desc = GetDefaultMemDesc(src_shape);
   auto desc = CreateDesc<dnnl::logsoftmax_forward::desc>(dnnl::prop_kind::forward_training, src_desc, axis);
-  auto prim_desc = CreateDesc<dnnl::logsoftmax_forward::primitive_desc>(desc, engine_);
+  std::shared_ptr<dnnl::primitive> forward_primitive{nullptr};
+  auto prim_desc = CreateCachedPrimitive<dnnl::logsoftmax_forward>(desc, &forward_primitive);
   // backward description
   auto backward_desc = CreateDesc<dnnl::logsoftmax_backward::desc>(src_desc, src_desc, axis);
-  auto backward_prim_desc = CreateDesc<dnnl::logsoftmax_backward::primitive_desc>(backward_desc, engine_, prim_desc);
-  primitive_ = CreatePrimitive<dnnl::logsoftmax_backward>(backward_prim_desc);
+  (void)CreateCachedPrimitive<dnnl::logsoftmax_backward>(backward_desc, desc, prim_desc, &primitive_);
   AddArgument(DNNL_ARG_DST, src_desc);
   AddArgument(DNNL_ARG_DIFF_SRC, src_desc);
   AddArgument(DNNL_ARG_DIFF_DST, src_desc);
@@ -89,8 +89,7 @@ void LstmCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   auto desc =
     CreatePrimitive<dnnl::lstm_forward::desc>(prop_kind, direction, src_desc, src_h_desc, src_c_desc, weights_desc,
                                               weights_h_desc, bias_desc, dst_desc, dst_h_desc, dst_c_desc);
-  prim_desc_ = CreateDesc<dnnl::lstm_forward::primitive_desc>(*desc, eng);
-  primitive_ = CreatePrimitive<dnnl::lstm_forward>(prim_desc_);
+  prim_desc_ = CreateCachedPrimitive<dnnl::lstm_forward>(*desc, &primitive_);
   if (is_training) {
     auto wksp_desc = GetWorkspaceDesc(prim_desc_);
     reserve_size_ = GetSize(wksp_desc);
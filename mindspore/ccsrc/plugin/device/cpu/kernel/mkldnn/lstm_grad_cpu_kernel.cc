@@ -82,13 +82,14 @@ void LSTMGradCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   auto forward_desc = CreatePrimitive<dnnl::lstm_forward::desc>(dnnl::prop_kind::forward_training, direction, src_desc,
                                                                 src_h_desc, src_c_desc, weights_desc, weights_h_desc,
                                                                 bias_desc, dst_desc, dst_h_desc, dst_c_desc);
-  auto prim_forward_desc = CreateDesc<dnnl::lstm_forward::primitive_desc>(*forward_desc, eng);
+  std::shared_ptr<dnnl::primitive> forward_primitive{nullptr};
+  auto prim_forward_desc = CreateCachedPrimitive<dnnl::lstm_forward>(*forward_desc, &forward_primitive);
   auto backward_desc = CreatePrimitive<dnnl::lstm_backward::desc>(
     dnnl::prop_kind::backward, direction, src_desc, src_h_desc, src_c_desc, weights_desc, weights_h_desc, bias_desc,
     dst_desc, dst_h_desc, dst_c_desc, src_desc, src_h_desc, src_c_desc, weights_desc, weights_h_desc, bias_desc,
     dst_desc, dst_h_desc, dst_c_desc);
-  prim_backward_desc_ = CreateDesc<dnnl::lstm_backward::primitive_desc>(*backward_desc, eng, prim_forward_desc);
-  primitive_ = CreatePrimitive<dnnl::lstm_backward>(prim_backward_desc_);
+  prim_backward_desc_ =
+    CreateCachedPrimitive<dnnl::lstm_backward>(*backward_desc, *forward_desc, prim_forward_desc, &primitive_);
   auto wksp_desc = GetWorkspaceDesc(prim_forward_desc);
   reserve_size_ = GetSize(wksp_desc);
   AddArgument(DNNL_ARG_WORKSPACE, wksp_desc);
@@ -80,8 +80,7 @@ void MatMulCpuKernelFunc::InitFunc(const CNodePtr &kernel_node) {
   auto weights_md = CreateDesc<dnnl::memory::desc>(weights_dims, dnnl::memory::data_type::f32, b_strides);
   auto dst_md = CreateDesc<dnnl::memory::desc>(dst_dims, dnnl::memory::data_type::f32, o_strides);
   auto matmul_desc = CreateDesc<dnnl::matmul::desc>(src_md, weights_md, dst_md);
-  auto prim_desc = CreateDesc<dnnl::matmul::primitive_desc>(matmul_desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::matmul>(prim_desc);
+  (void)CreateCachedPrimitive<dnnl::matmul>(matmul_desc, &primitive_);
 
   AddArgument(DNNL_ARG_SRC, src_md);
   AddArgument(DNNL_ARG_WEIGHTS, weights_md);
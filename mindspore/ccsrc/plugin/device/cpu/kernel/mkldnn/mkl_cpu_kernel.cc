@@ -24,6 +24,9 @@
 namespace mindspore {
 namespace kernel {
 namespace {
+constexpr size_t kDefaultPrimitiveCacheCapacity = 1024;
+constexpr auto kPrimitiveCacheCapacityEnv = "MS_DNNL_PRIMITIVE_CACHE_CAPACITY";
+
 void GeneratePaddingForPadMode(const PaddingInfo &padding_info, std::vector<int64_t> shape_exclude_nc,
                                std::vector<int64_t> pad) {
   if (padding_info.ceil_mode) {
@@ -56,6 +59,112 @@ void GeneratePaddingForPadMode(const PaddingInfo &padding_info, std::vector<int6
 }
 }  // namespace
 
+MKLPrimitiveCache &MKLPrimitiveCache::GetInstance() {
+  static MKLPrimitiveCache instance;
+  return instance;
+}
+
+MKLPrimitiveCache::MKLPrimitiveCache()
+    : engine_(dnnl::engine::kind::cpu, 0), capacity_(kDefaultPrimitiveCacheCapacity) {
+  auto capacity = common::GetEnv(kPrimitiveCacheCapacityEnv);
+  if (!capacity.empty()) {
+    try {
+      capacity_ = std::stoul(capacity);
+    } catch (const std::exception &e) {
+      MS_LOG(WARNING) << "Invalid " << kPrimitiveCacheCapacityEnv << ": " << capacity << ", use the default capacity "
+                      << kDefaultPrimitiveCacheCapacity;
+    }
+  }
+}
+
+bool MKLPrimitiveCache::Get(const std::string &key, Entry *entry) {
+  MS_EXCEPTION_IF_NULL(entry);
+  std::lock_guard<std::mutex> lock(lock_);
+  auto iter = index_.find(key);
+  if (iter == index_.end()) {
+    return false;
+  }
+  // move the hit one to the front, the back is the least recently used one.
+  entries_.splice(entries_.begin(), entries_, iter->second);
+  *entry = iter->second->second;
+  return true;
+}
+
+void MKLPrimitiveCache::Put(const std::string &key, const Entry &entry) {
+  std::lock_guard<std::mutex> lock(lock_);
+  if (capacity_ == 0) {
+    return;
+  }
+  auto iter = index_.find(key);
+  if (iter != index_.end()) {
+    iter->second->second = entry;
+    entries_.splice(entries_.begin(), entries_, iter->second);
+    return;
+  }
+  if (entries_.size() >= capacity_) {
+    // the evicted primitive is still alive while a kernel holds it.
+    (void)index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+  (void)entries_.emplace_front(key, entry);
+  index_[key] = entries_.begin();
+}
+
+void MKLPrimitiveCache::Clear() {
+  std::lock_guard<std::mutex> lock(lock_);
+  index_.clear();
+  entries_.clear();
+}
+
+size_t MKLPrimitiveCache::size() {
+  std::lock_guard<std::mutex> lock(lock_);
+  return entries_.size();
+}
+
+bool AppendAttrCacheKey(std::string *key, const dnnl::primitive_attr &attr) {
+  MS_EXCEPTION_IF_NULL(key);
+  auto append_value = [key](const auto &value) {
+    (void)key->append(reinterpret_cast<const char *>(&value), sizeof(value));
+  };
+  append_value(attr.get_scratchpad_mode());
+  int scales_mask = 0;
+  std::vector<float> scales;
+  attr.get_output_scales(scales_mask, scales);
+  append_value(scales_mask);
+  append_value(scales.size());
+  (void)key->append(reinterpret_cast<const char *>(scales.data()), scales.size() * sizeof(float));
+  auto post_ops = attr.get_post_ops();
+  append_value(post_ops.len());
+  for (int i = 0; i < post_ops.len(); ++i) {
+    auto kind = post_ops.kind(i);
+    append_value(kind);
+    if (kind == dnnl::primitive::kind::sum) {
+      float scale = 0;
+      post_ops.get_params_sum(i, scale);
+      append_value(scale);
+    } else if (kind == dnnl::primitive::kind::eltwise) {
+      float scale = 0;
+      float alpha = 0;
+      float beta = 0;
+      auto algorithm = dnnl::algorithm::undef;
+      post_ops.get_params_eltwise(i, scale, algorithm, alpha, beta);
+      append_value(scale);
+      append_value(algorithm);
+      append_value(alpha);
+      append_value(beta);
+    } else if (kind == dnnl::primitive::kind::binary) {
+      auto algorithm = dnnl::algorithm::undef;
+      dnnl::memory::desc src1_desc;
+      post_ops.get_params_binary(i, algorithm, src1_desc);
+      append_value(algorithm);
+      append_value(src1_desc.data);
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
 void MKLCpuKernelMod::GetPadding(const CNodePtr &kernel_node, const std::vector<size_t> &src_shape,
                                  const PaddingInfo &padding_info) const {
   MS_EXCEPTION_IF_NULL(kernel_node);
@@ -245,12 +354,21 @@ size_t MKLCpuKernelMod::GetSize(const dnnl::memory::desc &desc) const {
 }
 
 void MKLCpuKernelMod::Reorder(dnnl::memory *src_mem, dnnl::memory *dst_mem) {
-  MS_LOG(DEBUG) << "begin to invoke constructor of dnnl::reorder";
-  auto desc = dnnl::reorder(*src_mem, *dst_mem);
-  MS_LOG(DEBUG) << "end to invoke constructor of dnnl::reorder";
-  MS_LOG(DEBUG) << "begin to invoke primitive::execute";
-  desc.execute(stream_, *src_mem, *dst_mem);
+  MS_EXCEPTION_IF_NULL(src_mem);
+  MS_EXCEPTION_IF_NULL(dst_mem);
+  // the reorder of a weight runs at every launch, so its primitive is cached by the layouts of both sides.
+  auto src_desc = GetMemDesc(*src_mem);
+  auto dst_desc = GetMemDesc(*dst_mem);
+  std::shared_ptr<dnnl::primitive> reorder{nullptr};
+  (void)GetCachedPrimitive<dnnl::reorder>(
+    PrimitiveCacheKey(src_desc, dst_desc),
+    [this, &src_desc, &dst_desc]() {
+      return CreateDesc<dnnl::reorder::primitive_desc>(engine_, src_desc, engine_, dst_desc);
+    },
+    &reorder);
   MS_LOG(DEBUG) << "begin to invoke primitive::execute";
+  reorder->execute(stream_, {{DNNL_ARG_FROM, *src_mem}, {DNNL_ARG_TO, *dst_mem}});
+  MS_LOG(DEBUG) << "end to invoke primitive::execute";
 }
 }  // namespace kernel
 }  // namespace mindspore
@@ -20,7 +20,9 @@
 #include <string>
 #include <unordered_map>
 #include <algorithm>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <utility>
 #include "dnnl.hpp"
@@ -164,10 +166,95 @@ struct PaddingInfo {
   bool ceil_mode{false};
 };
 
+// Process-wide LRU cache of the dnnl primitives and their primitive descriptors. Creating a primitive selects the
+// implementation and jit-compiles it, which costs milliseconds, so the kernels of the same op and shapes share one
+// primitive, and a dynamic shape kernel does not rebuild it when a seen shape comes back. The primitives are safe to be
+// executed concurrently as onednn is built with DNNL_ENABLE_CONCURRENT_EXEC. All the kernels create their primitives
+// and streams on the engine of the cache, so a cached primitive always runs on the engine it was created on.
+class MKLPrimitiveCache {
+ public:
+  struct Entry {
+    std::shared_ptr<void> prim_desc{nullptr};
+    std::shared_ptr<dnnl::primitive> primitive{nullptr};
+  };
+
+  static MKLPrimitiveCache &GetInstance();
+  const dnnl::engine &engine() const { return engine_; }
+  bool Get(const std::string &key, Entry *entry);
+  void Put(const std::string &key, const Entry &entry);
+  void Clear();
+  size_t size();
+
+ private:
+  MKLPrimitiveCache();
+  ~MKLPrimitiveCache() = default;
+
+  dnnl::engine engine_;
+  size_t capacity_;
+  std::list<std::pair<std::string, Entry>> entries_;
+  std::unordered_map<std::string, std::list<std::pair<std::string, Entry>>::iterator> index_;
+  std::mutex lock_;
+};
+
+// append the scratchpad mode, the output scales and the post ops of the attr, return false if a post op is not known.
+bool AppendAttrCacheKey(std::string *key, const dnnl::primitive_attr &attr);
+
+inline void AppendPrimitiveCacheKey(std::string *) {}
+
+template <class T, class... Others>
+void AppendPrimitiveCacheKey(std::string *key, const T &desc, const Others &... others);
+
+// the attr is not a part of the op descriptor, the key is cleared if the attr can not be keyed, so it is not cached.
+template <class... Others>
+void AppendPrimitiveCacheKey(std::string *key, const dnnl::primitive_attr &attr, const Others &... others) {
+  (void)key->append("attr:");
+  if (!AppendAttrCacheKey(key, attr)) {
+    key->clear();
+    return;
+  }
+  AppendPrimitiveCacheKey(key, others...);
+}
+
+// the op descriptors of onednn are plain c structs in the data member, which hold all shapes, formats and flags.
+template <class T, class... Others>
+void AppendPrimitiveCacheKey(std::string *key, const T &desc, const Others &... others) {
+  (void)key->append(typeid(T).name()).append(1, ':');
+  (void)key->append(reinterpret_cast<const char *>(&desc.data), sizeof(desc.data));
+  AppendPrimitiveCacheKey(key, others...);
+}
+
+// the key of the primitive created by the op descriptors, the backward ops also take the forward descriptor of the
+// hint. An empty key means the primitive can not be cached.
+template <class... Descs>
+std::string PrimitiveCacheKey(const Descs &... descs) {
+  std::string key;
+  AppendPrimitiveCacheKey(&key, descs...);
+  return key;
+}
+
+// get the primitive descriptor of Prim from the cache, or create it by create_prim_desc along with the primitive.
+template <class Prim, class Creator>
+typename Prim::primitive_desc GetCachedPrimitive(const std::string &key, const Creator &create_prim_desc,
+                                                 std::shared_ptr<dnnl::primitive> *primitive) {
+  MS_EXCEPTION_IF_NULL(primitive);
+  auto &cache = MKLPrimitiveCache::GetInstance();
+  MKLPrimitiveCache::Entry entry;
+  if (!key.empty() && cache.Get(key, &entry)) {
+    *primitive = entry.primitive;
+    return *std::static_pointer_cast<typename Prim::primitive_desc>(entry.prim_desc);
+  }
+  auto prim_desc = std::make_shared<typename Prim::primitive_desc>(create_prim_desc());
+  *primitive = CreatePrimitive<Prim>(*prim_desc);
+  if (!key.empty()) {
+    cache.Put(key, {prim_desc, *primitive});
+  }
+  return *prim_desc;
+}
+
 class MKLCpuKernelMod : public DeprecatedNativeCpuKernelMod {
  public:
 #ifdef USE_MS_THREADPOOL_FOR_DNNL
-  MKLCpuKernelMod() : engine_(dnnl::engine::kind::cpu, 0) {
+  MKLCpuKernelMod() : engine_(MKLPrimitiveCache::GetInstance().engine()) {
     auto thread_pool = GetActorMgrInnerThreadPool();
     mkl_threadpool_ = std::make_shared<mkl_threadpool>(thread_pool);
     MS_LOG(DEBUG) << "begin to invoke dnnl::threadpool_interop::make_stream";
@@ -175,7 +262,7 @@ class MKLCpuKernelMod : public DeprecatedNativeCpuKernelMod {
     MS_LOG(DEBUG) << "end to invoke dnnl::threadpool_interop::make_stream";
   }
 #else
-  MKLCpuKernelMod() : engine_(dnnl::engine::kind::cpu, 0), stream_(engine_) {}
+  MKLCpuKernelMod() : engine_(MKLPrimitiveCache::GetInstance().engine()), stream_(engine_) {}
 #endif
   ~MKLCpuKernelMod() override = default;
 
@@ -197,6 +284,33 @@ class MKLCpuKernelMod : public DeprecatedNativeCpuKernelMod {
   }
   void Reorder(dnnl::memory *src_mem, dnnl::memory *dst_mem);
 
+  // create the primitive of the op descriptor through the process-wide cache, and return its primitive descriptor.
+  template <class Prim, class Desc>
+  typename Prim::primitive_desc CreateCachedPrimitive(const Desc &desc, std::shared_ptr<dnnl::primitive> *primitive) {
+    return GetCachedPrimitive<Prim>(
+      PrimitiveCacheKey(desc), [this, &desc]() { return CreateDesc<typename Prim::primitive_desc>(desc, engine_); },
+      primitive);
+  }
+
+  // the op with post ops or scales, the attr is keyed along with the op descriptor.
+  template <class Prim, class Desc>
+  typename Prim::primitive_desc CreateCachedPrimitive(const Desc &desc, const dnnl::primitive_attr &attr,
+                                                      std::shared_ptr<dnnl::primitive> *primitive) {
+    return GetCachedPrimitive<Prim>(
+      PrimitiveCacheKey(desc, attr),
+      [this, &desc, &attr]() { return CreateDesc<typename Prim::primitive_desc>(desc, attr, engine_); }, primitive);
+  }
+
+  // the backward ops take the primitive descriptor of the forward op as a hint, whose op descriptor is in the key.
+  template <class Prim, class Desc, class HintDesc, class HintPrimDesc>
+  typename Prim::primitive_desc CreateCachedPrimitive(const Desc &desc, const HintDesc &hint_desc,
+                                                      const HintPrimDesc &hint,
+                                                      std::shared_ptr<dnnl::primitive> *primitive) {
+    return GetCachedPrimitive<Prim>(
+      PrimitiveCacheKey(desc, hint_desc),
+      [this, &desc, &hint]() { return CreateDesc<typename Prim::primitive_desc>(desc, engine_, hint); }, primitive);
+  }
+
   size_t GetSize(const dnnl::memory::desc &desc) const;
   void SetDataHandle(dnnl::memory mem, void *ptr);
   void *GetDataHandle(const dnnl::memory &mem) const;
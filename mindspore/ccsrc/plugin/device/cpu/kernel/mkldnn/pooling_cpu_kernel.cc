@@ -88,8 +88,7 @@ void PoolingCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
 
   const auto desc = CreateDesc<dnnl::pooling_forward::desc>(dnnl::prop_kind::forward_inference, algorithm_, src_desc,
                                                             dst_desc, strides, kernel, padding_l, padding_r);
-  const auto prim_desc = CreateDesc<dnnl::pooling_forward::primitive_desc>(desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::pooling_forward>(prim_desc);
+  (void)CreateCachedPrimitive<dnnl::pooling_forward>(desc, &primitive_);
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_DST, dst_desc);
 }
@@ -106,20 +106,19 @@ void PoolingGradCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   // Pooling_avg forward description
   const auto desc = CreateDesc<dnnl::pooling_forward::desc>(dnnl::prop_kind::forward_training, algorithm_, src_desc_,
                                                             dst_desc_, strides, kernel, padding_l, padding_r);
-  auto forward_prim_desc = CreateDesc<dnnl::pooling_forward::primitive_desc>(desc, engine_);
+  std::shared_ptr<dnnl::primitive> forward_primitive{nullptr};
+  auto forward_prim_desc = CreateCachedPrimitive<dnnl::pooling_forward>(desc, &forward_primitive);
 
   // Pooling_avg backward description
   const auto backward_desc =
     CreateDesc<dnnl::pooling_backward::desc>(algorithm_, src_desc_, dst_desc_, strides, kernel, padding_l, padding_r);
-  const auto backward_prim_desc =
-    CreateDesc<dnnl::pooling_backward::primitive_desc>(backward_desc, engine_, forward_prim_desc);
-  primitive_ = CreatePrimitive<dnnl::pooling_backward>(backward_prim_desc);
+  (void)CreateCachedPrimitive<dnnl::pooling_backward>(backward_desc, desc, forward_prim_desc, &primitive_);
   AddArgument(DNNL_ARG_DIFF_SRC, src_desc_);
   AddArgument(DNNL_ARG_DIFF_DST, dst_desc_);
 
   // For pooling_max, need a workspace that generated in forward and stored the max value indexes to compute grad.
   if (algorithm_ == dnnl::algorithm::pooling_max) {
-    primitive_forward_ = CreatePrimitive<dnnl::pooling_forward>(forward_prim_desc);
+    primitive_forward_ = forward_primitive;
     workspace_desc_ = GetWorkspaceDesc(forward_prim_desc);
     AddArgument(DNNL_ARG_WORKSPACE, workspace_desc_);
   }
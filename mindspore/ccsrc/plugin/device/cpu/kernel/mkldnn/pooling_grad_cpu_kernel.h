@@ -85,7 +85,7 @@ class PoolingGradCpuKernelMod : public PoolingCpuKernelMod {
   dnnl::memory::desc src_desc_{};
   dnnl::memory::desc dst_desc_{};
   dnnl::memory::desc workspace_desc_{};
-  std::shared_ptr<dnnl::pooling_forward> primitive_forward_{nullptr};
+  std::shared_ptr<dnnl::primitive> primitive_forward_{nullptr};
   ParallelSearchInfo forward_parallel_info_{};
   std::string kernel_type_{kUnknown};
 };
@@ -77,8 +77,7 @@ void ReductionCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   dnnl::memory::desc src_desc = GetDefaultMemDesc(input_shape);
   dnnl::memory::desc dst_desc = GetDefaultMemDesc(output_shape);
   auto desc = GetReductionDesc(src_desc, dst_desc);
-  auto prim_desc = CreateDesc<dnnl::reduction::primitive_desc>(desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::reduction>(prim_desc);
+  (void)CreateCachedPrimitive<dnnl::reduction>(desc, &primitive_);
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_DST, dst_desc);
 }
@@ -46,8 +46,7 @@ void SoftmaxCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   }
   dnnl::memory::desc src_desc = GetDefaultMemDesc(src_shape);
   auto desc = CreateDesc<dnnl::softmax_forward::desc>(dnnl::prop_kind::forward_training, src_desc, axis);
-  auto prim_desc = CreateDesc<dnnl::softmax_forward::primitive_desc>(desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::softmax_forward>(prim_desc);
+  (void)CreateCachedPrimitive<dnnl::softmax_forward>(desc, &primitive_);
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_DST, src_desc);
 }
@@ -61,8 +61,7 @@ void SparseSoftmaxCrossEntropyWithLogitsCpuKernelMod::InitKernel(const CNodePtr
   auto mem_desc = CreateDesc<dnnl::memory::desc>(mem_dims, dnnl::memory::data_type::f32, dnnl::memory::format_tag::nc);
 
   auto desc = CreateDesc<dnnl::softmax_forward::desc>(dnnl::prop_kind::forward_training, mem_desc, 1);
-  auto prim_desc = CreateDesc<dnnl::softmax_forward::primitive_desc>(desc, engine_);
-  primitive_ = CreatePrimitive<dnnl::softmax_forward>(prim_desc);
+  (void)CreateCachedPrimitive<dnnl::softmax_forward>(desc, &primitive_);
 
   AddArgument(DNNL_ARG_SRC, mem_desc);
   AddArgument(DNNL_ARG_DST, mem_desc);
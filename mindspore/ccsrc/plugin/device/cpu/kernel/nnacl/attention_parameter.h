@@ -37,4 +37,15 @@ typedef struct RelativePositionAttentionParameter {
   int bias_tile_;  // tile for bias pack
 } RelativePositionAttentionParameter;
 
+typedef struct ScaledDotProductAttentionParameter {
+  // Primitive parameter
+  OpParameter op_parameter_;
+  float scale_;     // scale of q * k^T, 1 / sqrt(head_size) if it's not positive
+  bool is_causal_;  // if the query only attends to the keys up to its position
+  // args for compute
+  int q_seq_;      // length of sequence of query
+  int kv_seq_;     // length of sequence of key/value, the past keys/values of kv-cache come first
+  int head_size_;  // size of each head of query/key/value
+} ScaledDotProductAttentionParameter;
+
 #endif  // MINDSPORE_NNACL_ATTENTION_PARAMETER_H_
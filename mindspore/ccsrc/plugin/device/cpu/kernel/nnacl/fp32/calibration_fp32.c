@@ -0,0 +1,90 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nnacl/fp32/calibration_fp32.h"
+#include <math.h>
+#include "nnacl/intrinsics/ms_simd_instructions.h"
+
+// the bin indexes of a tile of values are calculated together, then added to the histogram one by one.
+#define CALIBRATION_HISTOGRAM_TILE 256
+
+// 32 bits, block_size : (512/256/128/32), block_num : (16/8/4/1)
+#define SimdCalibrationMinMaxCoreCalc(block_size, block_num, data, count, real_min, real_max, index) \
+  do {                                                                                               \
+    if (count - index < block_num) {                                                                 \
+      break;                                                                                         \
+    }                                                                                                \
+    MS_FLOAT_32xN(block_num) min##block_num = MS_LD_F32(block_size, data + index);                   \
+    MS_FLOAT_32xN(block_num) max##block_num = min##block_num;                                        \
+    for (int block_max_size = count - block_num + 1; index < block_max_size; index += block_num) {   \
+      MS_FLOAT_32xN(block_num) value = MS_LD_F32(block_size, data + index);                          \
+      min##block_num = MS_MIN_F32(block_size, min##block_num, value);                                \
+      max##block_num = MS_MAX_F32(block_size, max##block_num, value);                                \
+    }                                                                                                \
+    float min_values[block_num];                                                                     \
+    float max_values[block_num];                                                                     \
+    MS_ST_F32(block_size, min_values, min##block_num);                                               \
+    MS_ST_F32(block_size, max_values, max##block_num);                                               \
+    for (int i = 0; i < block_num; ++i) {                                                            \
+      real_min = MSMIN(real_min, min_values[i]);                                                     \
+      real_max = MSMAX(real_max, max_values[i]);                                                     \
+    }                                                                                                \
+  } while (0)
+
+#define SimdCalibrationBinCoreCalc(block_size, block_num, data, count, interval, max_bin, bins, index)        \
+  do {                                                                                                        \
+    MS_FLOAT_32xN(block_num) zero##block_num = MS_MOVN_F32(block_size, 0.0f);                                 \
+    MS_FLOAT_32xN(block_num) interval##block_num = MS_MOVN_F32(block_size, interval);                         \
+    MS_FLOAT_32xN(block_num) max_bin##block_num = MS_MOVN_F32(block_size, max_bin);                           \
+    for (int block_max_size = count - block_num + 1; index < block_max_size; index += block_num) {            \
+      MS_FLOAT_32xN(block_num) value = MS_LD_F32(block_size, data + index);                                   \
+      value = MS_MAX_F32(block_size, value, MS_SUB_F32(block_size, zero##block_num, value));                  \
+      value = MS_MIN_F32(block_size, MS_DIV_F32(block_size, value, interval##block_num), max_bin##block_num); \
+      MS_ST_EPI32(block_size, bins + index, MS_FLOAT32_TO_INT32(block_size, value));                          \
+    }                                                                                                         \
+  } while (0)
+
+void CalibrationMinMaxFp32(const float *data, int count, float *real_min, float *real_max) {
+  float min_value = *real_min;
+  float max_value = *real_max;
+  int index = 0;
+  MS_SIMD_RUN_NO_SCALAR(SimdCalibrationMinMaxCoreCalc, data, count, min_value, max_value, index);
+  for (; index < count; ++index) {
+    min_value = MSMIN(min_value, data[index]);
+    max_value = MSMAX(max_value, data[index]);
+  }
+  *real_min = min_value;
+  *real_max = max_value;
+}
+
+void CalibrationHistogramFp32(const float *data, int count, float interval, float *histogram, int bin_num) {
+  int bins[CALIBRATION_HISTOGRAM_TILE];
+  // the bin index is clamped as float, which also keeps the huge values from overflowing int.
+  float max_bin = (float)(bin_num - 1);
+  for (int start = 0; start < count; start += CALIBRATION_HISTOGRAM_TILE) {
+    const float *tile = data + start;
+    int tile_size = MSMIN(CALIBRATION_HISTOGRAM_TILE, count - start);
+    int index = 0;
+    MS_SIMD_RUN_NO_SCALAR(SimdCalibrationBinCoreCalc, tile, tile_size, interval, max_bin, bins, index);
+    for (; index < tile_size; ++index) {
+      bins[index] = (int)MSMIN(fabsf(tile[index]) / interval, max_bin);
+    }
+    for (int i = 0; i < tile_size; ++i) {
+      if (tile[i] != 0) {
+        histogram[bins[i]]++;
+      }
+    }
+  }
+}
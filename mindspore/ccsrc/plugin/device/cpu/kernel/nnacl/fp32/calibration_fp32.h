@@ -0,0 +1,33 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_NNACL_FP32_CALIBRATION_FP32_H_
+#define MINDSPORE_NNACL_FP32_CALIBRATION_FP32_H_
+
+#include "nnacl/op_base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// update real_min and real_max with the min and max of data.
+void CalibrationMinMaxFp32(const float *data, int count, float *real_min, float *real_max);
+
+// add the non-zero values of data to the histogram of abs values, whose bin i is [i * interval, (i + 1) * interval),
+// and the values beyond the last bin go to the last bin.
+void CalibrationHistogramFp32(const float *data, int count, float interval, float *histogram, int bin_num);
+#ifdef __cplusplus
+}
+#endif
+#endif  // MINDSPORE_NNACL_FP32_CALIBRATION_FP32_H_
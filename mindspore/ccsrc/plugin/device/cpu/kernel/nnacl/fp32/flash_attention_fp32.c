@@ -0,0 +1,156 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nnacl/fp32/flash_attention_fp32.h"
+#include <math.h>
+#include <string.h>
+#include "nnacl/fp32/exp_fp32.h"
+
+// 32 bits, block_size : (512/256/128/32), block_num : (16/8/4/1)
+#define SimdAttentionDotCoreCalc(block_size, block_num, a, b, size, sum, index)                   \
+  do {                                                                                            \
+    MS_FLOAT_32xN(block_num) sum##block_num = MS_MOVN_F32(block_size, 0.0f);                      \
+    for (int block_max_size = size - block_num + 1; index < block_max_size; index += block_num) { \
+      MS_FLOAT_32xN(block_num) a##block_num = MS_LD_F32(block_size, a + index);                   \
+      MS_FLOAT_32xN(block_num) b##block_num = MS_LD_F32(block_size, b + index);                   \
+      sum##block_num = MS_FMADD_F32(block_size, a##block_num, b##block_num, sum##block_num);      \
+    }                                                                                             \
+    sum += MS_GET_SUM_F32(block_size, sum##block_num);                                            \
+  } while (0)
+
+#define SimdAttentionScaleAddCoreCalc(block_size, block_num, dst, src, alpha, size, index)         \
+  do {                                                                                             \
+    MS_FLOAT_32xN(block_num) alpha##block_num = MS_MOVN_F32(block_size, alpha);                    \
+    for (int block_max_size = size - block_num + 1; index < block_max_size; index += block_num) {  \
+      MS_FLOAT_32xN(block_num) dst##block_num = MS_LD_F32(block_size, dst + index);                \
+      MS_FLOAT_32xN(block_num) src##block_num = MS_LD_F32(block_size, src + index);                \
+      dst##block_num = MS_FMADD_F32(block_size, src##block_num, alpha##block_num, dst##block_num); \
+      MS_ST_F32(block_size, dst + index, dst##block_num);                                          \
+    }                                                                                              \
+  } while (0)
+
+#define SimdAttentionScaleCoreCalc(block_size, block_num, dst, alpha, size, index)                  \
+  do {                                                                                              \
+    MS_FLOAT_32xN(block_num) alpha##block_num = MS_MOVN_F32(block_size, alpha);                     \
+    for (int block_max_size = size - block_num + 1; index < block_max_size; index += block_num) {   \
+      MS_FLOAT_32xN(block_num) dst##block_num = MS_LD_F32(block_size, dst + index);                 \
+      MS_ST_F32(block_size, dst + index, MS_MUL_F32(block_size, dst##block_num, alpha##block_num)); \
+    }                                                                                               \
+  } while (0)
+
+#define SimdAttentionExpCoreCalc(block_size, block_num, logits, max, sum, size, index)                          \
+  do {                                                                                                          \
+    MS_FLOAT_32xN(block_num) max##block_num = MS_MOVN_F32(block_size, max);                                     \
+    MS_FLOAT_32xN(block_num) sum##block_num = MS_MOVN_F32(block_size, 0.0f);                                    \
+    for (int block_max_size = size - block_num + 1; index < block_max_size; index += block_num) {               \
+      MS_FLOAT_32xN(block_num) input = MS_LD_F32(block_size, logits + index);                                   \
+      MS_FLOAT_32xN(block_num) exp_out = MS_EXP_F32(block_size, MS_SUB_F32(block_size, input, max##block_num)); \
+      sum##block_num = MS_ADD_F32(block_size, sum##block_num, exp_out);                                         \
+      MS_ST_F32(block_size, logits + index, exp_out);                                                           \
+    }                                                                                                           \
+    sum += MS_GET_SUM_F32(block_size, sum##block_num);                                                          \
+  } while (0)
+
+static inline float AttentionDot(const float *a, const float *b, int size) {
+  float sum = 0.0f;
+  int index = 0;
+  MS_SIMD_RUN_NO_SCALAR(SimdAttentionDotCoreCalc, a, b, size, sum, index);
+  for (; index < size; ++index) {
+    sum += a[index] * b[index];
+  }
+  return sum;
+}
+
+// dst += src * alpha
+static inline void AttentionScaleAdd(float *dst, const float *src, float alpha, int size) {
+  int index = 0;
+  MS_SIMD_RUN_NO_SCALAR(SimdAttentionScaleAddCoreCalc, dst, src, alpha, size, index);
+  for (; index < size; ++index) {
+    dst[index] += src[index] * alpha;
+  }
+}
+
+static inline void AttentionScale(float *dst, float alpha, int size) {
+  int index = 0;
+  MS_SIMD_RUN_NO_SCALAR(SimdAttentionScaleCoreCalc, dst, alpha, size, index);
+  for (; index < size; ++index) {
+    dst[index] *= alpha;
+  }
+}
+
+int FlashAttentionBufferSize(const ScaledDotProductAttentionParameter *param) {
+  // the logits of one block of keys and the accumulator of the output.
+  return FLASH_ATTENTION_KV_TILE + param->head_size_;
+}
+
+void FlashAttentionFp32(const float *q, const float *k, const float *v, const float *mask, float *out, float *lse,
+                        float *buffer, const ScaledDotProductAttentionParameter *param, int q_start, int q_end) {
+  int head_size = param->head_size_;
+  int kv_seq = param->kv_seq_;
+  int past_seq = kv_seq - param->q_seq_;
+  float scale = param->scale_ > 0.0f ? param->scale_ : 1.0f / sqrtf((float)head_size);
+  float *logits = buffer;
+  float *acc = buffer + FLASH_ATTENTION_KV_TILE;
+  for (int i = q_start; i < q_end; ++i) {
+    const float *q_row = q + i * head_size;
+    const float *mask_row = mask == NULL ? NULL : mask + i * kv_seq;
+    int kv_end = param->is_causal_ ? MSMIN(kv_seq, past_seq + i + 1) : kv_seq;
+    float max = -INFINITY;
+    float sum = 0.0f;
+    memset(acc, 0, head_size * sizeof(float));
+    for (int j_start = 0; j_start < kv_end; j_start += FLASH_ATTENTION_KV_TILE) {
+      int block = MSMIN(FLASH_ATTENTION_KV_TILE, kv_end - j_start);
+      float block_max = -INFINITY;
+      for (int j = 0; j < block; ++j) {
+        float logit = AttentionDot(q_row, k + (j_start + j) * head_size, head_size) * scale;
+        if (mask_row != NULL) {
+          logit += mask_row[j_start + j];
+        }
+        logits[j] = logit;
+        block_max = MSMAX(block_max, logit);
+      }
+      if (block_max == -INFINITY) {
+        continue;
+      }
+      // rescale the accumulated sum and output to the new max.
+      if (block_max > max) {
+        float correction = simd_exp32_f32(max - block_max);
+        sum *= correction;
+        AttentionScale(acc, correction, head_size);
+        max = block_max;
+      }
+      int index = 0;
+      MS_SIMD_RUN_NO_SCALAR(SimdAttentionExpCoreCalc, logits, max, sum, block, index);
+      for (; index < block; ++index) {
+        logits[index] = simd_exp32_f32(logits[index] - max);
+        sum += logits[index];
+      }
+      for (int j = 0; j < block; ++j) {
+        AttentionScaleAdd(acc, v + (j_start + j) * head_size, logits[j], head_size);
+      }
+    }
+    float *out_row = out + i * head_size;
+    if (sum == 0.0f) {
+      // all keys are masked out.
+      memset(out_row, 0, head_size * sizeof(float));
+    } else {
+      memcpy(out_row, acc, head_size * sizeof(float));
+      AttentionScale(out_row, 1.0f / sum, head_size);
+    }
+    if (lse != NULL) {
+      lse[i] = sum == 0.0f ? -INFINITY : max + logf(sum);
+    }
+  }
+}
@@ -0,0 +1,41 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
+#define MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
+
+#include "nnacl/attention_parameter.h"
+
+// the keys/values are visited in blocks of FLASH_ATTENTION_KV_TILE, so the logits are never materialized.
+#define FLASH_ATTENTION_KV_TILE 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// the size of buffer needed by each thread, in floats.
+int FlashAttentionBufferSize(const ScaledDotProductAttentionParameter *param);
+
+// softmax(q * k^T * scale + mask) * v of one head, with the online softmax.
+// q: [q_seq, head_size], k and v: [kv_seq, head_size], out: [q_seq, head_size].
+// mask: [q_seq, kv_seq] added to the logits, can be NULL.
+// lse: [q_seq] the log-sum-exp of the logits of each query, which the backward of training needs, can be NULL.
+// With is_causal_, the query i attends to the keys up to kv_seq - q_seq + i, as the past keys of kv-cache come first.
+// Only the queries [q_start, q_end) are calculated.
+void FlashAttentionFp32(const float *q, const float *k, const float *v, const float *mask, float *out, float *lse,
+                        float *buffer, const ScaledDotProductAttentionParameter *param, int q_start, int q_end);
+#ifdef __cplusplus
+}
+#endif
+#endif  // MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
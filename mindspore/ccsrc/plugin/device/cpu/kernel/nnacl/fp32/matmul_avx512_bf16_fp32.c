@@ -0,0 +1,299 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nnacl/fp32/matmul_avx512_bf16_fp32.h"
+#ifdef ENABLE_AVX512_BF16
+#include <string.h>
+#include <x86intrin.h>
+#include "nnacl/op_base.h"
+#ifdef ENABLE_AMX_BF16
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
+
+#define BF16_TARGET __attribute__((target("avx512f,avx512bf16")))
+#define BF16_ROW_TILE 8
+
+static inline uint16_t Fp32ToBf16Scalar(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+    return (uint16_t)((bits >> C16NUM) | 0x40);
+  }
+  // round to nearest even
+  bits += 0x7FFF + ((bits >> C16NUM) & 1);
+  return (uint16_t)(bits >> C16NUM);
+}
+
+BF16_TARGET void RowMajorFp32ToBf16(const float *src, uint16_t *dst, int row, int deep) {
+  int deep_align = UP_ROUND(deep, MATMUL_BF16_DEEP_TILE);
+  for (int r = 0; r < row; ++r) {
+    const float *src_row = src + r * deep;
+    uint16_t *dst_row = dst + r * deep_align;
+    int d = 0;
+    for (; d <= deep - C16NUM; d += C16NUM) {
+      __m256bh value = _mm512_cvtneps_pbh(_mm512_loadu_ps(src_row + d));
+      _mm256_storeu_si256((__m256i *)(dst_row + d), (__m256i)value);
+    }
+    for (; d < deep; ++d) {
+      dst_row[d] = Fp32ToBf16Scalar(src_row[d]);
+    }
+    for (; d < deep_align; ++d) {
+      dst_row[d] = 0;
+    }
+  }
+}
+
+void Row64MajorFp32ToBf16(const float *src, uint16_t *dst, int deep, int col_align) {
+  int deep_align = UP_ROUND(deep, MATMUL_BF16_DEEP_TILE);
+  for (int col_index = 0; col_index < col_align; col_index += C64NUM) {
+    int col_block = MSMIN(C64NUM, col_align - col_index);
+    const float *src_block = src + col_index * deep;
+    uint16_t *dst_block = dst + col_index * deep_align;
+    for (int k = 0; k < deep_align; k += C2NUM) {
+      uint16_t *dst_k = dst_block + k * col_block;
+      for (int n = 0; n < col_block; ++n) {
+        dst_k[n * C2NUM] = k < deep ? Fp32ToBf16Scalar(src_block[k * col_block + n]) : 0;
+        dst_k[n * C2NUM + 1] = k + 1 < deep ? Fp32ToBf16Scalar(src_block[(k + 1) * col_block + n]) : 0;
+      }
+    }
+  }
+}
+
+static inline BF16_TARGET __m512 Bf16Act(__m512 value, int act_type) {
+  if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+    value = _mm512_max_ps(value, _mm512_setzero_ps());
+  }
+  if (act_type == ActType_Relu6) {
+    value = _mm512_min_ps(value, _mm512_set1_ps(6.0f));
+  }
+  return value;
+}
+
+#define BF16_LOAD_A(r)                                        \
+  const uint16_t *a##r = a + (r < row_block ? r : 0) * deep_align; \
+  __m512 acc##r##0 = init0;                                   \
+  __m512 acc##r##1 = init1;
+
+#define BF16_DOT_A(r)                                                 \
+  {                                                                   \
+    int32_t pair;                                                     \
+    memcpy(&pair, a##r + k, sizeof(pair));                            \
+    __m512bh va = (__m512bh)_mm512_set1_epi32(pair);                  \
+    acc##r##0 = _mm512_dpbf16_ps(acc##r##0, va, b0);                  \
+    if (col_vec > 1) acc##r##1 = _mm512_dpbf16_ps(acc##r##1, va, b1); \
+  }
+
+#define BF16_STORE_C(r)                                                                         \
+  if (r < row_block) {                                                                          \
+    _mm512_storeu_ps(c + r * col_align, Bf16Act(acc##r##0, act_type));                          \
+    if (col_vec > 1) _mm512_storeu_ps(c + r * col_align + C16NUM, Bf16Act(acc##r##1, act_type)); \
+  }
+
+// calculate up to 8 rows and 16 * col_vec columns, b points to the first column of the tile in the packed block whose
+// width is col_block.
+static inline __attribute__((always_inline)) BF16_TARGET void MatMulBf16Kernel(
+  const uint16_t *a, const uint16_t *b, float *c, const float *bias, int act_type, int deep_align, int col_block,
+  int col_vec, int col_align, int row_block) {
+  __m512 init0 = bias == NULL ? _mm512_setzero_ps() : _mm512_loadu_ps(bias);
+  __m512 init1 = (bias == NULL || col_vec == 1) ? _mm512_setzero_ps() : _mm512_loadu_ps(bias + C16NUM);
+  BF16_LOAD_A(0)
+  BF16_LOAD_A(1)
+  BF16_LOAD_A(2)
+  BF16_LOAD_A(3)
+  BF16_LOAD_A(4)
+  BF16_LOAD_A(5)
+  BF16_LOAD_A(6)
+  BF16_LOAD_A(7)
+  int b_stride = col_block * C2NUM;
+  for (int k = 0; k < deep_align; k += C2NUM) {
+    __m512bh b0 = (__m512bh)_mm512_loadu_si512(b);
+    __m512bh b1 = b0;
+    if (col_vec > 1) {
+      b1 = (__m512bh)_mm512_loadu_si512(b + C32NUM);
+    }
+    BF16_DOT_A(0)
+    BF16_DOT_A(1)
+    BF16_DOT_A(2)
+    BF16_DOT_A(3)
+    BF16_DOT_A(4)
+    BF16_DOT_A(5)
+    BF16_DOT_A(6)
+    BF16_DOT_A(7)
+    b += b_stride;
+  }
+  BF16_STORE_C(0)
+  BF16_STORE_C(1)
+  BF16_STORE_C(2)
+  BF16_STORE_C(3)
+  BF16_STORE_C(4)
+  BF16_STORE_C(5)
+  BF16_STORE_C(6)
+  BF16_STORE_C(7)
+}
+
+static BF16_TARGET void MatMulBf16Kernel8x32(const uint16_t *a, const uint16_t *b, float *c, const float *bias,
+                                              int act_type, int deep_align, int col_block, int col_align,
+                                              int row_block) {
+  MatMulBf16Kernel(a, b, c, bias, act_type, deep_align, col_block, C2NUM, col_align, row_block);
+}
+
+static BF16_TARGET void MatMulBf16Kernel8x16(const uint16_t *a, const uint16_t *b, float *c, const float *bias,
+                                              int act_type, int deep_align, int col_block, int col_align,
+                                              int row_block) {
+  MatMulBf16Kernel(a, b, c, bias, act_type, deep_align, col_block, 1, col_align, row_block);
+}
+
+// calculate the rows [start_row, row) of one packed block with vdpbf16ps.
+static void MatMulAvx512Bf16Block(const uint16_t *a, const uint16_t *b_block, float *c, const float *bias,
+                                  int act_type, int deep_align, int col_block, int col_align, int start_row, int row) {
+  for (int m = start_row; m < row; m += BF16_ROW_TILE) {
+    int row_block = MSMIN(BF16_ROW_TILE, row - m);
+    for (int n = 0; n < col_block; n += C32NUM) {
+      const float *bias_data = bias == NULL ? NULL : bias + n;
+      if (col_block - n >= C32NUM) {
+        MatMulBf16Kernel8x32(a + m * deep_align, b_block + n * C2NUM, c + m * col_align + n, bias_data, act_type,
+                             deep_align, col_block, col_align, row_block);
+      } else {
+        MatMulBf16Kernel8x16(a + m * deep_align, b_block + n * C2NUM, c + m * col_align + n, bias_data, act_type,
+                             deep_align, col_block, col_align, row_block);
+      }
+    }
+  }
+}
+
+#ifdef ENABLE_AMX_BF16
+#define AMX_TARGET __attribute__((target("avx512f,avx512bf16,amx-tile,amx-bf16")))
+#define AMX_TILE_ROW 16
+#define AMX_TILE_COL_BYTES 64
+
+typedef struct AmxTileConfig {
+  uint8_t palette_id_;
+  uint8_t start_row_;
+  uint8_t reserved_[14];
+  uint16_t colsb_[16];
+  uint8_t rows_[16];
+} AmxTileConfig;
+
+// add the bias, do the activation, and copy the 16x16 result of tile to c.
+static inline AMX_TARGET void AmxStoreC(const float *tile_out, float *c, const float *bias, int act_type,
+                                        int col_align) {
+  __m512 bias_data = bias == NULL ? _mm512_setzero_ps() : _mm512_loadu_ps(bias);
+  for (int r = 0; r < AMX_TILE_ROW; ++r) {
+    __m512 value = _mm512_add_ps(_mm512_loadu_ps(tile_out + r * C16NUM), bias_data);
+    _mm512_storeu_ps(c + r * col_align, Bf16Act(value, act_type));
+  }
+}
+
+// calculate the full 16-row tiles of one packed block with amx, returns the number of rows calculated. Tiles 0~3 are
+// the 32x32 result, tiles 4~5 are 32 rows of a, tiles 6~7 are 32 columns of b.
+static AMX_TARGET int MatMulAmxBf16Block(const uint16_t *a, const uint16_t *b_block, float *c, const float *bias,
+                                         int act_type, int deep_align, int col_block, int col_align, int row) {
+  float tile_out[AMX_TILE_ROW * C16NUM];
+  size_t a_stride = deep_align * sizeof(uint16_t);
+  size_t b_stride = col_block * C2NUM * sizeof(uint16_t);
+  int full_row = row / AMX_TILE_ROW * AMX_TILE_ROW;
+  for (int m = 0; m < full_row; m += C32NUM) {
+    bool two_row = full_row - m >= C32NUM;
+    const uint16_t *a0 = a + m * deep_align;
+    const uint16_t *a1 = a0 + AMX_TILE_ROW * deep_align;
+    for (int n = 0; n < col_block; n += C32NUM) {
+      bool two_col = col_block - n >= C32NUM;
+      const uint16_t *b0 = b_block + n * C2NUM;
+      _tile_zero(0);
+      _tile_zero(1);
+      _tile_zero(2);
+      _tile_zero(3);
+      for (int k = 0; k < deep_align; k += MATMUL_BF16_DEEP_TILE) {
+        // one b tile is 16 columns by 32 depths, that is 16 rows of depth pairs.
+        const uint16_t *b_k = b0 + k * col_block;
+        _tile_loadd(4, a0 + k, a_stride);
+        _tile_loadd(6, b_k, b_stride);
+        _tile_dpbf16ps(0, 4, 6);
+        if (two_col) {
+          _tile_loadd(7, b_k + C32NUM, b_stride);
+          _tile_dpbf16ps(1, 4, 7);
+        }
+        if (two_row) {
+          _tile_loadd(5, a1 + k, a_stride);
+          _tile_dpbf16ps(2, 5, 6);
+          if (two_col) {
+            _tile_dpbf16ps(3, 5, 7);
+          }
+        }
+      }
+      float *c0 = c + m * col_align + n;
+      const float *bias0 = bias == NULL ? NULL : bias + n;
+      const float *bias1 = bias == NULL ? NULL : bias + n + C16NUM;
+      _tile_stored(0, tile_out, AMX_TILE_COL_BYTES);
+      AmxStoreC(tile_out, c0, bias0, act_type, col_align);
+      if (two_col) {
+        _tile_stored(1, tile_out, AMX_TILE_COL_BYTES);
+        AmxStoreC(tile_out, c0 + C16NUM, bias1, act_type, col_align);
+      }
+      if (two_row) {
+        float *c1 = c0 + AMX_TILE_ROW * col_align;
+        _tile_stored(2, tile_out, AMX_TILE_COL_BYTES);
+        AmxStoreC(tile_out, c1, bias0, act_type, col_align);
+        if (two_col) {
+          _tile_stored(3, tile_out, AMX_TILE_COL_BYTES);
+          AmxStoreC(tile_out, c1 + C16NUM, bias1, act_type, col_align);
+        }
+      }
+    }
+  }
+  return full_row;
+}
+
+static AMX_TARGET void MatMulAmxBf16(const uint16_t *a, const uint16_t *b, float *c, const float *bias, int act_type,
+                                     int deep_align, int cur_col, int col_align, int row) {
+  // the tile config is thread local, so it is loaded by every call.
+  AmxTileConfig config;
+  memset(&config, 0, sizeof(config));
+  config.palette_id_ = 1;
+  for (int i = 0; i < C8NUM; ++i) {
+    config.rows_[i] = AMX_TILE_ROW;
+    config.colsb_[i] = AMX_TILE_COL_BYTES;
+  }
+  _tile_loadconfig(&config);
+  for (int col_index = 0; col_index < cur_col; col_index += C64NUM) {
+    int col_block = MSMIN(C64NUM, cur_col - col_index);
+    const uint16_t *b_block = b + col_index * deep_align;
+    const float *bias_data = bias == NULL ? NULL : bias + col_index;
+    int start_row =
+      MatMulAmxBf16Block(a, b_block, c + col_index, bias_data, act_type, deep_align, col_block, col_align, row);
+    // the remaining rows are less than one tile.
+    MatMulAvx512Bf16Block(a, b_block, c + col_index, bias_data, act_type, deep_align, col_block, col_align, start_row,
+                          row);
+  }
+  _tile_release();
+}
+#endif
+
+void MatMulAvx512Bf16(const uint16_t *a, const uint16_t *b, float *c, const float *bias, int act_type,
+                      int deep_align, int cur_col, int col_align, int row) {
+#ifdef ENABLE_AMX_BF16
+  if (row >= AMX_TILE_ROW && X86_Amx_Bf16_Support()) {
+    MatMulAmxBf16(a, b, c, bias, act_type, deep_align, cur_col, col_align, row);
+    return;
+  }
+#endif
+  // one time process 64 out_channel, the columns of one block are split into tiles of 32 and 16.
+  for (int col_index = 0; col_index < cur_col; col_index += C64NUM) {
+    int col_block = MSMIN(C64NUM, cur_col - col_index);
+    MatMulAvx512Bf16Block(a, b + col_index * deep_align, c + col_index, bias == NULL ? NULL : bias + col_index,
+                          act_type, deep_align, col_block, col_align, 0, row);
+  }
+}
+#endif
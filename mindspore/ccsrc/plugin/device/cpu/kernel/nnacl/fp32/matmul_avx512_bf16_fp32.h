@@ -0,0 +1,57 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_NNACL_FP32_MATMUL_AVX512_BF16_H_
+#define MINDSPORE_NNACL_FP32_MATMUL_AVX512_BF16_H_
+#ifdef ENABLE_AVX512
+#include <stdint.h>
+
+// avx512bf16 intrinsics need gcc >= 10 or clang >= 9, amx intrinsics need gcc >= 11 or clang >= 12. The kernels are
+// dispatched at runtime by X86_Avx512_Bf16_Support and X86_Amx_Bf16_Support.
+#if !defined(ENABLE_AVX512_BF16) && \
+  ((defined(__clang__) && __clang_major__ >= 9) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 10))
+#define ENABLE_AVX512_BF16
+#endif
+#if !defined(ENABLE_AMX_BF16) && \
+  ((defined(__clang__) && __clang_major__ >= 12) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 11))
+#define ENABLE_AMX_BF16
+#endif
+
+// the depth of bf16 matrix is aligned to the row size of an amx tile, which is 32 bf16.
+#define MATMUL_BF16_DEEP_TILE 32
+
+#ifdef ENABLE_AVX512_BF16
+#ifdef __cplusplus
+extern "C" {
+#endif
+// convert the row-major fp32 matrix [row, deep] to bf16 [row, deep_align], deep_align is deep rounded up to
+// MATMUL_BF16_DEEP_TILE and the padding is filled with zero.
+void RowMajorFp32ToBf16(const float *src, uint16_t *dst, int row, int deep);
+
+// convert the matrix-b packed by RowMajor2Row64Major/RowMajor2Col64Major to bf16 [col_align, deep_align]. For each
+// block of 64 columns (the last block may be narrower), two adjacent depths of one column are stored together, which is
+// the layout of both vdpbf16ps and the b tile of tdpbf16ps.
+void Row64MajorFp32ToBf16(const float *src, uint16_t *dst, int deep, int col_align);
+
+// a: [row, deep_align] bf16, b: packed by Row64MajorFp32ToBf16, c: [row, col_align] fp32.
+void MatMulAvx512Bf16(const uint16_t *a, const uint16_t *b, float *c, const float *bias, int act_type,
+                      int deep_align, int cur_col, int col_align, int row);
+#ifdef __cplusplus
+}
+#endif
+#endif
+
+#endif
+#endif  // MINDSPORE_NNACL_FP32_MATMUL_AVX512_BF16_H_
@@ -15,6 +15,7 @@
  */
 #ifdef ENABLE_AVX512
 #include "nnacl/fp32/matmul_avx512_fp32.h"
+#include "nnacl/fp32/matmul_avx512_jit_fp32.h"
 #include "nnacl/op_base.h"
 
 void GemmRowxColKernelFp32(float *dst, const float *src, const float *weight, const float *bias, const size_t act_flag,
@@ -147,12 +148,20 @@ void MatMulAvx512Fp32(const float *a, const float *b, float *c, const float *bia
     int col_block = C64NUM;
     for (int col_index = 0; col_index < cur_col; col_index += col_block) {
       col_block = MSMIN(col_block, cur_col - col_index);
-      int row_block = max_shape[(col_block >> C4NUM) - 1];
+      int col_num = col_block >> C4NUM;
+      // the generated kernels fit in more rows than the pre-generated ones.
+      int row_block = MSMAX(GemmAvx512JitMaxRow(col_num), max_shape[col_num - 1]);
+      GemmAvx512JitParam jit_param = {0, col_num, k_block, depth, col_align, act_flag, inc_flag, bias_data != NULL};
       for (int m = 0; m < row; m += row_block) {
         row_block = MSMIN(row_block, row - m);
-        kernel[(col_block >> C4NUM) - 1][row_block](c + col_index + m * col_align, a + m * depth + k,
-                                                    b + col_index * depth + k * col_block, bias_data, act_flag,
-                                                    row_block, col_block >> C4NUM, k_block, depth, col_align, inc_flag);
+        jit_param.row_block_ = row_block;
+        GemmAvx512Kernel tile_kernel = GetGemmAvx512JitKernel(&jit_param);
+        if (tile_kernel == NULL) {
+          row_block = MSMIN(row_block, max_shape[col_num - 1]);
+          tile_kernel = kernel[col_num - 1][row_block];
+        }
+        tile_kernel(c + col_index + m * col_align, a + m * depth + k, b + col_index * depth + k * col_block, bias_data,
+                    act_flag, row_block, col_num, k_block, depth, col_align, inc_flag);
       }
       if (bias_data != NULL) {
         bias_data += col_block;
@@ -191,8 +200,14 @@ void MatVecMulAvx512Fp32(const float *a, const float *b, float *c, const float *
     int col_block = C64NUM;
     for (int col_index = 0; col_index < cur_col; col_index += col_block) {
       col_block = MSMIN(col_block, cur_col - col_index);
-      kernel[(col_block >> C4NUM) - 1](c + col_index, a + k, b + col_index * depth + k * col_block, bias_data, act_flag,
-                                       1, col_block >> C4NUM, k_block, depth, col_align, inc_flag);
+      int col_num = col_block >> C4NUM;
+      GemmAvx512JitParam jit_param = {1, col_num, k_block, depth, col_align, act_flag, inc_flag, bias_data != NULL};
+      GemmAvx512Kernel tile_kernel = GetGemmAvx512JitKernel(&jit_param);
+      if (tile_kernel == NULL) {
+        tile_kernel = kernel[col_num - 1];
+      }
+      tile_kernel(c + col_index, a + k, b + col_index * depth + k * col_block, bias_data, act_flag, 1, col_num, k_block,
+                  depth, col_align, inc_flag);
       if (bias_data != NULL) {
         bias_data += col_block;
       }
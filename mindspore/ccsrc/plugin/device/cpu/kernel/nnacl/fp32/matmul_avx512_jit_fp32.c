@@ -0,0 +1,379 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifdef ENABLE_AVX512
+#include "nnacl/fp32/matmul_avx512_jit_fp32.h"
+#include <string.h>
+#ifdef ENABLE_GEMM_AVX512_JIT
+#include <pthread.h>
+#include <sys/mman.h>
+#endif
+#include "nnacl/errorcode.h"
+#include "nnacl/op_base.h"
+
+#define GEMM_JIT_DEPTH_UNROLL 4
+#define GEMM_JIT_WEIGHT_REG 24
+#define GEMM_JIT_ZMM_BYTES 64
+#define GEMM_JIT_ZMM_NUM 32
+#define GEMM_JIT_LOOP_ALIGN 16
+#define GEMM_JIT_CODE_SIZE 4096
+#define GEMM_JIT_CACHE_SIZE 1024
+#define GEMM_JIT_RELU6_BITS 0x40C00000  // 6.0f
+
+typedef enum JitGpr {
+  JitGpr_Rax = 0,
+  JitGpr_Rcx = 1,
+  JitGpr_Rdx = 2,
+  JitGpr_Rsp = 4,
+  JitGpr_Rbp = 5,
+  JitGpr_Rsi = 6,
+  JitGpr_Rdi = 7
+} JitGpr;
+// the opcode maps of evex.
+typedef enum JitMap { JitMap_0F = 1, JitMap_0F38 = 2 } JitMap;
+// the implied prefixes of evex.
+typedef enum JitPrefix { JitPrefix_None = 0, JitPrefix_66 = 1 } JitPrefix;
+
+typedef struct JitCode {
+  uint8_t *data_;
+  int size_;
+  int capacity_;
+} JitCode;
+
+// the size keeps counting when the buffer is full, which is checked at the end.
+static void EmitByte(JitCode *code, uint8_t value) {
+  if (code->size_ < code->capacity_) {
+    code->data_[code->size_] = value;
+  }
+  code->size_++;
+}
+
+static void EmitInt32(JitCode *code, int32_t value) {
+  uint32_t bits = (uint32_t)value;
+  for (int i = 0; i < C4NUM; ++i) {
+    EmitByte(code, (uint8_t)(bits >> (i * C8NUM)));
+  }
+}
+
+// emit the evex instruction of 512 bits: opcode reg, vvvv, rm/[base + disp]. The operand is the register rm if base is
+// negative. bcst broadcasts the 32 bits memory operand to all lanes, and scalar tells the memory operand is 32 bits.
+static void EmitEvex(JitCode *code, JitMap map, JitPrefix prefix, uint8_t opcode, int reg, int vvvv, int rm, int base,
+                     int disp, int bcst, int scalar) {
+  int is_mem = base >= 0;
+  int rm_reg = is_mem ? base : rm;
+  int rm_high = is_mem ? 0 : ((rm >> C4NUM) & 1);
+  uint8_t p0 = (uint8_t)(((~reg >> C3NUM) & 1) << C7NUM | (!rm_high) << C6NUM | ((~rm_reg >> C3NUM) & 1) << C5NUM |
+                         ((~reg >> C4NUM) & 1) << C4NUM | map);
+  uint8_t p1 = (uint8_t)(((~vvvv) & 0xF) << C3NUM | 0x4 | prefix);
+  uint8_t p2 = (uint8_t)(0x40 | (bcst ? 0x10 : 0) | ((~vvvv >> C4NUM) & 1) << C3NUM);
+  EmitByte(code, 0x62);
+  EmitByte(code, p0);
+  EmitByte(code, p1);
+  EmitByte(code, p2);
+  EmitByte(code, opcode);
+  if (!is_mem) {
+    EmitByte(code, (uint8_t)(0xC0 | (reg & 0x7) << C3NUM | (rm & 0x7)));
+    return;
+  }
+  // the 8 bits displacement of evex is scaled by the size of the memory operand.
+  int scale = (bcst || scalar) ? (int)sizeof(float) : GEMM_JIT_ZMM_BYTES;
+  int mod;
+  if (disp == 0 && (base & 0x7) != JitGpr_Rbp) {
+    mod = 0;
+  } else if (disp % scale == 0 && disp / scale >= INT8_MIN && disp / scale <= INT8_MAX) {
+    mod = 1;
+  } else {
+    mod = C2NUM;
+  }
+  EmitByte(code, (uint8_t)(mod << C6NUM | (reg & 0x7) << C3NUM | (base & 0x7)));
+  if ((base & 0x7) == JitGpr_Rsp) {
+    EmitByte(code, 0x24);  // sib without index
+  }
+  if (mod == 1) {
+    EmitByte(code, (uint8_t)(int8_t)(disp / scale));
+  } else if (mod == C2NUM) {
+    EmitInt32(code, disp);
+  }
+}
+
+static void EmitVmovupsLoad(JitCode *code, int zmm, int base, int disp) {
+  EmitEvex(code, JitMap_0F, JitPrefix_None, 0x10, zmm, 0, 0, base, disp, 0, 0);
+}
+
+static void EmitVmovupsStore(JitCode *code, int zmm, int base, int disp) {
+  EmitEvex(code, JitMap_0F, JitPrefix_None, 0x11, zmm, 0, 0, base, disp, 0, 0);
+}
+
+// acc += weight * broadcast([base + disp])
+static void EmitVfmadd231psBcst(JitCode *code, int acc, int weight, int base, int disp) {
+  EmitEvex(code, JitMap_0F38, JitPrefix_66, 0xB8, acc, weight, 0, base, disp, 1, 0);
+}
+
+// acc += weight * src
+static void EmitVfmadd231ps(JitCode *code, int acc, int weight, int src) {
+  EmitEvex(code, JitMap_0F38, JitPrefix_66, 0xB8, acc, weight, src, -1, 0, 0, 0);
+}
+
+static void EmitVbroadcastss(JitCode *code, int zmm, int base, int disp) {
+  EmitEvex(code, JitMap_0F38, JitPrefix_66, 0x18, zmm, 0, 0, base, disp, 0, 1);
+}
+
+static void EmitVpxord(JitCode *code, int zmm) {
+  EmitEvex(code, JitMap_0F, JitPrefix_66, 0xEF, zmm, zmm, zmm, -1, 0, 0, 0);
+}
+
+static void EmitVmaxps(JitCode *code, int dst, int src0, int src1) {
+  EmitEvex(code, JitMap_0F, JitPrefix_None, 0x5F, dst, src0, src1, -1, 0, 0, 0);
+}
+
+static void EmitVminps(JitCode *code, int dst, int src0, int src1) {
+  EmitEvex(code, JitMap_0F, JitPrefix_None, 0x5D, dst, src0, src1, -1, 0, 0, 0);
+}
+
+// broadcast eax to all lanes of zmm.
+static void EmitVpbroadcastdEax(JitCode *code, int zmm) {
+  EmitEvex(code, JitMap_0F38, JitPrefix_66, 0x7C, zmm, 0, JitGpr_Rax, -1, 0, 0, 0);
+}
+
+static void EmitMovEax(JitCode *code, int32_t imm) {
+  EmitByte(code, 0xB8);
+  EmitInt32(code, imm);
+}
+
+static void EmitMovR11(JitCode *code, int32_t imm) {
+  EmitByte(code, 0x49);
+  EmitByte(code, 0xC7);
+  EmitByte(code, 0xC3);
+  EmitInt32(code, imm);
+}
+
+static void EmitAdd(JitCode *code, JitGpr gpr, int32_t imm) {
+  EmitByte(code, 0x48);
+  EmitByte(code, 0x81);
+  EmitByte(code, (uint8_t)(0xC0 | gpr));
+  EmitInt32(code, imm);
+}
+
+// dec r11 and jump back to target if it's not zero.
+static void EmitLoopEnd(JitCode *code, int target) {
+  EmitByte(code, 0x49);
+  EmitByte(code, 0xFF);
+  EmitByte(code, 0xCB);
+  EmitByte(code, 0x0F);
+  EmitByte(code, 0x85);
+  EmitInt32(code, target - (code->size_ + (int)sizeof(int32_t)));
+}
+
+static void EmitReturn(JitCode *code) {
+  // vzeroupper, to avoid the penalty of the sse code after it.
+  EmitByte(code, 0xC5);
+  EmitByte(code, 0xF8);
+  EmitByte(code, 0x77);
+  EmitByte(code, 0xC3);
+}
+
+// the depth of the tile is fully unrolled, src and weight are advanced by the loop outside.
+static void EmitDepthBlock(JitCode *code, const GemmAvx512JitParam *param, int depth) {
+  int col = param->col_block_;
+  // the registers after the weights hold the broadcast src, which are used in turn.
+  int bcst_reg = GEMM_JIT_WEIGHT_REG + col;
+  int bcst_num = GEMM_JIT_ZMM_NUM - bcst_reg;
+  for (int k = 0; k < depth; ++k) {
+    for (int j = 0; j < col; ++j) {
+      EmitVmovupsLoad(code, GEMM_JIT_WEIGHT_REG + j, JitGpr_Rdx, (k * col + j) * GEMM_JIT_ZMM_BYTES);
+    }
+    for (int i = 0; i < param->row_block_; ++i) {
+      int src_offset = (i * param->src_stride_ + k) * (int)sizeof(float);
+      if (col == 1) {
+        // one fma for one src, the broadcast is folded into it.
+        EmitVfmadd231psBcst(code, i, GEMM_JIT_WEIGHT_REG, JitGpr_Rsi, src_offset);
+        continue;
+      }
+      int src_reg = bcst_reg + i % bcst_num;
+      EmitVbroadcastss(code, src_reg, JitGpr_Rsi, src_offset);
+      for (int j = 0; j < col; ++j) {
+        EmitVfmadd231ps(code, i * col + j, GEMM_JIT_WEIGHT_REG + j, src_reg);
+      }
+    }
+  }
+}
+
+static int CheckGemmAvx512JitParam(const GemmAvx512JitParam *param) {
+  if (param->row_block_ <= 0 || param->col_block_ <= 0 || param->col_block_ > GEMM_AVX512_JIT_MAX_COL_BLOCK ||
+      param->row_block_ * param->col_block_ > GEMM_AVX512_JIT_MAX_ACC || param->depth_ <= 0) {
+    return NNACL_ERR;
+  }
+  // the offsets are 32 bits displacements.
+  int64_t max_offset = ((int64_t)param->row_block_ * MSMAX(param->src_stride_, param->dst_stride_) + param->depth_ +
+                        (int64_t)param->col_block_ * C16NUM) *
+                       (int64_t)sizeof(float);
+  if (param->src_stride_ < 0 || param->dst_stride_ < 0 || max_offset > INT32_MAX) {
+    return NNACL_ERR;
+  }
+  return NNACL_OK;
+}
+
+int GenerateGemmAvx512Kernel(const GemmAvx512JitParam *param, uint8_t *data, int capacity) {
+  if (param == NULL || data == NULL || CheckGemmAvx512JitParam(param) != NNACL_OK) {
+    return -1;
+  }
+  JitCode code = {data, 0, capacity};
+  int row = param->row_block_;
+  int col = param->col_block_;
+  // the arguments: rdi: dst, rsi: src, rdx: weight, rcx: bias.
+  for (int i = 0; i < row; ++i) {
+    for (int j = 0; j < col; ++j) {
+      int acc = i * col + j;
+      if (param->inc_flag_ & 0x1) {
+        EmitVmovupsLoad(&code, acc, JitGpr_Rdi, (i * param->dst_stride_ + j * C16NUM) * (int)sizeof(float));
+      } else if (param->has_bias_) {
+        EmitVmovupsLoad(&code, acc, JitGpr_Rcx, j * GEMM_JIT_ZMM_BYTES);
+      } else {
+        EmitVpxord(&code, acc);
+      }
+    }
+  }
+  int loop_num = param->depth_ / GEMM_JIT_DEPTH_UNROLL;
+  if (loop_num > 0) {
+    EmitMovR11(&code, loop_num);
+    while (code.size_ % GEMM_JIT_LOOP_ALIGN != 0) {
+      EmitByte(&code, 0x90);  // nop
+    }
+    int loop_start = code.size_;
+    EmitDepthBlock(&code, param, GEMM_JIT_DEPTH_UNROLL);
+    EmitAdd(&code, JitGpr_Rsi, GEMM_JIT_DEPTH_UNROLL * (int)sizeof(float));
+    EmitAdd(&code, JitGpr_Rdx, GEMM_JIT_DEPTH_UNROLL * col * GEMM_JIT_ZMM_BYTES);
+    EmitLoopEnd(&code, loop_start);
+  }
+  EmitDepthBlock(&code, param, param->depth_ % GEMM_JIT_DEPTH_UNROLL);
+  if (param->inc_flag_ & 0x2) {
+    if (param->act_flag_ & 0x1) {
+      EmitMovEax(&code, GEMM_JIT_RELU6_BITS);
+      EmitVpbroadcastdEax(&code, GEMM_JIT_WEIGHT_REG);
+      for (int acc = 0; acc < row * col; ++acc) {
+        EmitVminps(&code, acc, acc, GEMM_JIT_WEIGHT_REG);
+      }
+    }
+    if (param->act_flag_ & 0x2) {
+      EmitVpxord(&code, GEMM_JIT_WEIGHT_REG + 1);
+      for (int acc = 0; acc < row * col; ++acc) {
+        EmitVmaxps(&code, acc, acc, GEMM_JIT_WEIGHT_REG + 1);
+      }
+    }
+  }
+  for (int i = 0; i < row; ++i) {
+    for (int j = 0; j < col; ++j) {
+      EmitVmovupsStore(&code, i * col + j, JitGpr_Rdi, (i * param->dst_stride_ + j * C16NUM) * (int)sizeof(float));
+    }
+  }
+  EmitReturn(&code);
+  return code.size_ <= capacity ? code.size_ : -1;
+}
+
+int GemmAvx512JitMaxRow(int col_block) {
+#ifdef ENABLE_GEMM_AVX512_JIT
+  if (col_block <= 0 || col_block > GEMM_AVX512_JIT_MAX_COL_BLOCK) {
+    return 0;
+  }
+  return GEMM_AVX512_JIT_MAX_ACC / col_block;
+#else
+  return 0;
+#endif
+}
+
+#ifdef ENABLE_GEMM_AVX512_JIT
+typedef struct GemmJitEntry {
+  GemmAvx512JitParam param_;
+  GemmAvx512Kernel kernel_;
+  int ready_;  // set after param_ and kernel_, the entry is read without the lock
+} GemmJitEntry;
+
+static GemmJitEntry g_gemm_jit_cache[GEMM_JIT_CACHE_SIZE];
+// at most half of the cache is filled, so that the probe of a missing param ends soon.
+static int g_gemm_jit_count = 0;
+static pthread_mutex_t g_gemm_jit_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint32_t HashGemmAvx512JitParam(const GemmAvx512JitParam *param) {
+  const int *values = (const int *)param;
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < sizeof(GemmAvx512JitParam) / sizeof(int); ++i) {
+    hash = (hash ^ (uint32_t)values[i]) * 16777619u;
+  }
+  return hash;
+}
+
+// find the entry of param, or the empty entry where it should be.
+static GemmJitEntry *FindGemmJitEntry(const GemmAvx512JitParam *param) {
+  uint32_t index = HashGemmAvx512JitParam(param);
+  for (int i = 0; i < GEMM_JIT_CACHE_SIZE; ++i) {
+    GemmJitEntry *entry = &g_gemm_jit_cache[(index + i) % GEMM_JIT_CACHE_SIZE];
+    if (!__atomic_load_n(&entry->ready_, __ATOMIC_ACQUIRE) ||
+        memcmp(&entry->param_, param, sizeof(GemmAvx512JitParam)) == 0) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+static GemmAvx512Kernel CreateGemmAvx512JitKernel(const GemmAvx512JitParam *param) {
+  void *code = mmap(NULL, GEMM_JIT_CODE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+  if (code == MAP_FAILED) {
+    return NULL;
+  }
+  int size = GenerateGemmAvx512Kernel(param, (uint8_t *)code, GEMM_JIT_CODE_SIZE);
+  if (size < 0 || mprotect(code, GEMM_JIT_CODE_SIZE, PROT_READ | PROT_EXEC) != 0) {
+    (void)munmap(code, GEMM_JIT_CODE_SIZE);
+    return NULL;
+  }
+  return (GemmAvx512Kernel)code;
+}
+#endif
+
+GemmAvx512Kernel GetGemmAvx512JitKernel(const GemmAvx512JitParam *param) {
+#ifdef ENABLE_GEMM_AVX512_JIT
+  if (param == NULL || CheckGemmAvx512JitParam(param) != NNACL_OK) {
+    return NULL;
+  }
+  GemmJitEntry *entry = FindGemmJitEntry(param);
+  if (entry != NULL && __atomic_load_n(&entry->ready_, __ATOMIC_ACQUIRE)) {
+    return entry->kernel_;
+  }
+  if (__atomic_load_n(&g_gemm_jit_count, __ATOMIC_RELAXED) >= GEMM_JIT_CACHE_SIZE / C2NUM) {
+    return NULL;
+  }
+  GemmAvx512Kernel kernel = NULL;
+  pthread_mutex_lock(&g_gemm_jit_mutex);
+  // the entry may be taken by another thread before the lock.
+  entry = FindGemmJitEntry(param);
+  if (entry != NULL) {
+    if (__atomic_load_n(&entry->ready_, __ATOMIC_ACQUIRE)) {
+      kernel = entry->kernel_;
+    } else if (g_gemm_jit_count < GEMM_JIT_CACHE_SIZE / C2NUM) {
+      kernel = CreateGemmAvx512JitKernel(param);
+      if (kernel != NULL) {
+        entry->param_ = *param;
+        entry->kernel_ = kernel;
+        __atomic_store_n(&entry->ready_, 1, __ATOMIC_RELEASE);
+        __atomic_store_n(&g_gemm_jit_count, g_gemm_jit_count + 1, __ATOMIC_RELAXED);
+      }
+    }
+  }
+  pthread_mutex_unlock(&g_gemm_jit_mutex);
+  return kernel;
+#else
+  return NULL;
+#endif
+}
+#endif
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_NNACL_FP32_MATMUL_AVX512_JIT_FP32_H_
+#define MINDSPORE_NNACL_FP32_MATMUL_AVX512_JIT_FP32_H_
+
+#ifdef ENABLE_AVX512
+#include <stdint.h>
+#include "nnacl/fp32/matmul_avx512_fp32.h"
+
+#if defined(__x86_64__) && (defined(__linux__) || defined(__APPLE__))
+#define ENABLE_GEMM_AVX512_JIT
+#endif
+
+// the accumulators of the generated kernels are zmm0-zmm23, and zmm24-zmm31 hold the weights and the broadcast src.
+#define GEMM_AVX512_JIT_MAX_ACC 24
+#define GEMM_AVX512_JIT_MAX_COL_BLOCK 4
+
+// everything but the pointers is fixed in the generated kernel.
+typedef struct GemmAvx512JitParam {
+  int row_block_;  // rows of the tile
+  int col_block_;  // columns of the tile, in blocks of 16
+  int depth_;      // depth of the tile
+  int src_stride_;
+  int dst_stride_;
+  int act_flag_;  // 0x1: relu6, 0x2: relu, the same as the pre-generated kernels
+  int inc_flag_;  // 0x1: accumulate to dst, 0x2: the last block of depth
+  int has_bias_;
+} GemmAvx512JitParam;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// the max rows of the tile of col_block, or 0 if the jit is not supported.
+int GemmAvx512JitMaxRow(int col_block);
+
+// generate the machine code of the kernel into code, and return its size, or -1 if the param is not supported or the
+// code buffer is too small.
+int GenerateGemmAvx512Kernel(const GemmAvx512JitParam *param, uint8_t *code, int code_size);
+
+// get the kernel generated for param, which is generated on the first use and cached in the process. The kernel has
+// the same arguments as the pre-generated ones, but only dst, src, weight and bias are used. NULL if it's not
+// supported, and the caller falls back to the pre-generated kernels.
+GemmAvx512Kernel GetGemmAvx512JitKernel(const GemmAvx512JitParam *param);
+#ifdef __cplusplus
+}
+#endif
+#endif
+#endif  // MINDSPORE_NNACL_FP32_MATMUL_AVX512_JIT_FP32_H_
@@ -0,0 +1,276 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nnacl/fp32/matmul_weight_quant_fp32.h"
+#include <string.h>
+#ifdef ENABLE_AVX
+#include <x86intrin.h>
+#endif
+#include "nnacl/op_base.h"
+
+#define WEIGHT_QUANT_INT4_TILE_BYTES 8
+#define WEIGHT_QUANT_INT4_BIT_NUM 4
+#define WEIGHT_QUANT_ROW_TILE 4
+#define WEIGHT_QUANT_MAX_TILE_NUM 4
+
+void PackWeightQuantInt8(const int8_t *src, int8_t *dst, int deep, int col, bool transpose) {
+  int tile_num = UP_DIV(col, WEIGHT_QUANT_COL_TILE);
+  memset(dst, 0, tile_num * deep * WEIGHT_QUANT_COL_TILE);
+  for (int n = 0; n < col; ++n) {
+    int8_t *dst_col = dst + (n / WEIGHT_QUANT_COL_TILE) * deep * WEIGHT_QUANT_COL_TILE + n % WEIGHT_QUANT_COL_TILE;
+    for (int k = 0; k < deep; ++k) {
+      dst_col[k * WEIGHT_QUANT_COL_TILE] = transpose ? src[n * deep + k] : src[k * col + n];
+    }
+  }
+}
+
+void PackWeightQuantInt4(const int8_t *src, uint8_t *dst, int deep, int col, bool transpose) {
+  int tile_num = UP_DIV(col, WEIGHT_QUANT_COL_TILE);
+  memset(dst, 0, tile_num * deep * WEIGHT_QUANT_INT4_TILE_BYTES);
+  for (int n = 0; n < col; ++n) {
+    int tile_index = n % WEIGHT_QUANT_COL_TILE;
+    uint8_t *dst_col = dst + (n / WEIGHT_QUANT_COL_TILE) * deep * WEIGHT_QUANT_INT4_TILE_BYTES +
+                       tile_index % WEIGHT_QUANT_INT4_TILE_BYTES;
+    int shift = tile_index < WEIGHT_QUANT_INT4_TILE_BYTES ? 0 : WEIGHT_QUANT_INT4_BIT_NUM;
+    for (int k = 0; k < deep; ++k) {
+      int8_t value = transpose ? src[n * deep + k] : src[k * col + n];
+      dst_col[k * WEIGHT_QUANT_INT4_TILE_BYTES] |= (uint8_t)((value & 0x0F) << shift);
+    }
+  }
+}
+
+#ifdef ENABLE_AVX
+// one tile of 16 floats is a zmm register with avx512, or a pair of ymm registers with avx2.
+#ifdef ENABLE_AVX512
+typedef __m512 WqFloat16;
+#define WQ_ROW1_TILE_NUM 4
+#define WQ_ROW4_TILE_NUM 4
+
+static inline WqFloat16 WqZero(void) { return _mm512_setzero_ps(); }
+static inline WqFloat16 WqLoad(const float *src) { return _mm512_loadu_ps(src); }
+static inline WqFloat16 WqSet1(float value) { return _mm512_set1_ps(value); }
+static inline WqFloat16 WqInt8ToFloat(__m128i value) { return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(value)); }
+static inline WqFloat16 WqFma(WqFloat16 acc, WqFloat16 a, WqFloat16 b) { return _mm512_fmadd_ps(a, b, acc); }
+static inline WqFloat16 WqAdd(WqFloat16 a, WqFloat16 b) { return _mm512_add_ps(a, b); }
+static inline WqFloat16 WqMul(WqFloat16 a, WqFloat16 b) { return _mm512_mul_ps(a, b); }
+static inline WqFloat16 WqMax(WqFloat16 a, WqFloat16 b) { return _mm512_max_ps(a, b); }
+static inline WqFloat16 WqMin(WqFloat16 a, WqFloat16 b) { return _mm512_min_ps(a, b); }
+static inline void WqStore(float *dst, WqFloat16 value) { _mm512_storeu_ps(dst, value); }
+#else
+typedef struct {
+  __m256 lo_;
+  __m256 hi_;
+} WqFloat16;
+#define WQ_ROW1_TILE_NUM 4
+#define WQ_ROW4_TILE_NUM 1
+
+static inline WqFloat16 WqZero(void) {
+  WqFloat16 res = {_mm256_setzero_ps(), _mm256_setzero_ps()};
+  return res;
+}
+static inline WqFloat16 WqLoad(const float *src) {
+  WqFloat16 res = {_mm256_loadu_ps(src), _mm256_loadu_ps(src + C8NUM)};
+  return res;
+}
+static inline WqFloat16 WqSet1(float value) {
+  WqFloat16 res = {_mm256_set1_ps(value), _mm256_set1_ps(value)};
+  return res;
+}
+static inline WqFloat16 WqInt8ToFloat(__m128i value) {
+  WqFloat16 res = {_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(value)),
+                   _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_unpackhi_epi64(value, value)))};
+  return res;
+}
+static inline WqFloat16 WqFma(WqFloat16 acc, WqFloat16 a, WqFloat16 b) {
+  WqFloat16 res = {_mm256_fmadd_ps(a.lo_, b.lo_, acc.lo_), _mm256_fmadd_ps(a.hi_, b.hi_, acc.hi_)};
+  return res;
+}
+static inline WqFloat16 WqAdd(WqFloat16 a, WqFloat16 b) {
+  WqFloat16 res = {_mm256_add_ps(a.lo_, b.lo_), _mm256_add_ps(a.hi_, b.hi_)};
+  return res;
+}
+static inline WqFloat16 WqMul(WqFloat16 a, WqFloat16 b) {
+  WqFloat16 res = {_mm256_mul_ps(a.lo_, b.lo_), _mm256_mul_ps(a.hi_, b.hi_)};
+  return res;
+}
+static inline WqFloat16 WqMax(WqFloat16 a, WqFloat16 b) {
+  WqFloat16 res = {_mm256_max_ps(a.lo_, b.lo_), _mm256_max_ps(a.hi_, b.hi_)};
+  return res;
+}
+static inline WqFloat16 WqMin(WqFloat16 a, WqFloat16 b) {
+  WqFloat16 res = {_mm256_min_ps(a.lo_, b.lo_), _mm256_min_ps(a.hi_, b.hi_)};
+  return res;
+}
+static inline void WqStore(float *dst, WqFloat16 value) {
+  _mm256_storeu_ps(dst, value.lo_);
+  _mm256_storeu_ps(dst + C8NUM, value.hi_);
+}
+#endif
+
+// 16 int8 of one depth, or 16 int4 of one depth which are sign-extended to int8.
+static inline __m128i WqLoadWeight(const uint8_t *src, int bit_num) {
+  if (bit_num != WEIGHT_QUANT_INT4_BIT_NUM) {
+    return _mm_loadu_si128((const __m128i *)src);
+  }
+  const __m128i low_mask = _mm_set1_epi8(0x0F);
+  const __m128i sign_bit = _mm_set1_epi8(0x08);
+  __m128i value = _mm_loadl_epi64((const __m128i *)src);
+  __m128i low = _mm_and_si128(value, low_mask);
+  __m128i high = _mm_and_si128(_mm_srli_epi16(value, WEIGHT_QUANT_INT4_BIT_NUM), low_mask);
+  value = _mm_unpacklo_epi64(low, high);
+  return _mm_sub_epi8(_mm_xor_si128(value, sign_bit), sign_bit);
+}
+
+static inline void WqStoreTile(float *dst, WqFloat16 value, int col_num) {
+  if (col_num >= WEIGHT_QUANT_COL_TILE) {
+    WqStore(dst, value);
+    return;
+  }
+  float buffer[WEIGHT_QUANT_COL_TILE];
+  WqStore(buffer, value);
+  memcpy(dst, buffer, col_num * sizeof(float));
+}
+
+#define WQ_FOR_TILE(M, r) M(r, 0) M(r, 1) M(r, 2) M(r, 3)
+#define WQ_FOR_ALL(M) WQ_FOR_TILE(M, 0) WQ_FOR_TILE(M, 1) WQ_FOR_TILE(M, 2) WQ_FOR_TILE(M, 3)
+#define WQ_DECLARE_ACC(r, t) WqFloat16 acc##r##t = WqZero();
+#define WQ_FMA_ACC(r, t)                                 \
+  if (row_tile > r && tile_num > t) {                    \
+    acc##r##t = WqFma(acc##r##t, a_value[r], weight[t]); \
+  }
+#define WQ_STORE_ACC(r, t)                                                                                        \
+  if (row_tile > r && tile_num > t && r < row_num && t < cur_tile_num) {                                          \
+    WqFloat16 value = acc##r##t;                                                                                  \
+    if (zps != NULL) {                                                                                            \
+      value = WqFma(value, WqLoad(zps + (tile + t) * WEIGHT_QUANT_COL_TILE), WqSet1(-a_sums[r]));                 \
+    }                                                                                                             \
+    value = WqMul(value, WqLoad(scales + (tile + t) * WEIGHT_QUANT_COL_TILE));                                    \
+    if (bias != NULL) {                                                                                           \
+      value = WqAdd(value, WqLoad(bias + (tile + t) * WEIGHT_QUANT_COL_TILE));                                     \
+    }                                                                                                             \
+    if (act_type == ActType_Relu || act_type == ActType_Relu6) {                                                  \
+      value = WqMax(value, WqZero());                                                                             \
+    }                                                                                                             \
+    if (act_type == ActType_Relu6) {                                                                              \
+      value = WqMin(value, WqSet1(6.0f));                                                                         \
+    }                                                                                                             \
+    WqStoreTile(c + r * col + (tile + t) * WEIGHT_QUANT_COL_TILE, value, col - (tile + t) * WEIGHT_QUANT_COL_TILE); \
+  }
+
+// calculates row_num (<= row_tile) rows and cur_tile_num (<= tile_num) column tiles. The rows and tiles out of range
+// reuse the first one, so that the loop of depth has no branch, and their results are not stored.
+static inline __attribute__((always_inline)) void WeightQuantKernel(
+  const float *a, const uint8_t *b, float *c, const float *bias, const float *scales, const float *zps,
+  const float *a_sums, int act_type, int deep, int col, int tile, int row_num, int cur_tile_num, int row_tile,
+  int tile_num, int bit_num) {
+  int depth_bytes = bit_num == WEIGHT_QUANT_INT4_BIT_NUM ? WEIGHT_QUANT_INT4_TILE_BYTES : WEIGHT_QUANT_COL_TILE;
+  const float *a_row[WEIGHT_QUANT_ROW_TILE];
+  const uint8_t *b_tile[WEIGHT_QUANT_MAX_TILE_NUM];
+  for (int i = 0; i < WEIGHT_QUANT_ROW_TILE; ++i) {
+    a_row[i] = a + (i < row_num ? i : 0) * deep;
+  }
+  for (int i = 0; i < WEIGHT_QUANT_MAX_TILE_NUM; ++i) {
+    b_tile[i] = b + (tile + (i < cur_tile_num ? i : 0)) * deep * depth_bytes;
+  }
+  WQ_FOR_ALL(WQ_DECLARE_ACC)
+  for (int k = 0; k < deep; ++k) {
+    WqFloat16 weight[WEIGHT_QUANT_MAX_TILE_NUM];
+    WqFloat16 a_value[WEIGHT_QUANT_ROW_TILE];
+    for (int t = 0; t < tile_num; ++t) {
+      weight[t] = WqInt8ToFloat(WqLoadWeight(b_tile[t] + k * depth_bytes, bit_num));
+    }
+    for (int r = 0; r < row_tile; ++r) {
+      a_value[r] = WqSet1(a_row[r][k]);
+    }
+    WQ_FOR_ALL(WQ_FMA_ACC)
+  }
+  WQ_FOR_ALL(WQ_STORE_ACC)
+}
+
+#define WQ_KERNEL_FUNC(name, row_tile, tile_num, bit_num)                                                             \
+  static void name(const float *a, const uint8_t *b, float *c, const float *bias, const float *scales,                \
+                   const float *zps, const float *a_sums, int act_type, int deep, int col, int tile, int row_num,     \
+                   int cur_tile_num) {                                                                                \
+    WeightQuantKernel(a, b, c, bias, scales, zps, a_sums, act_type, deep, col, tile, row_num, cur_tile_num, row_tile, \
+                      tile_num, bit_num);                                                                             \
+  }
+WQ_KERNEL_FUNC(WeightQuantInt8Row1, 1, WQ_ROW1_TILE_NUM, C8NUM)
+WQ_KERNEL_FUNC(WeightQuantInt8Row4, WEIGHT_QUANT_ROW_TILE, WQ_ROW4_TILE_NUM, C8NUM)
+WQ_KERNEL_FUNC(WeightQuantInt4Row1, 1, WQ_ROW1_TILE_NUM, WEIGHT_QUANT_INT4_BIT_NUM)
+WQ_KERNEL_FUNC(WeightQuantInt4Row4, WEIGHT_QUANT_ROW_TILE, WQ_ROW4_TILE_NUM, WEIGHT_QUANT_INT4_BIT_NUM)
+
+typedef void (*WeightQuantKernelFunc)(const float *a, const uint8_t *b, float *c, const float *bias,
+                                      const float *scales, const float *zps, const float *a_sums, int act_type,
+                                      int deep, int col, int tile, int row_num, int cur_tile_num);
+
+void MatmulWeightQuantFp32(const float *a, const void *b, float *c, const float *bias, const float *scales,
+                           const float *zps, const float *a_sums, int act_type, int row, int deep, int col,
+                           int start_tile, int end_tile, int bit_num) {
+  bool is_int4 = bit_num == WEIGHT_QUANT_INT4_BIT_NUM;
+  // the decoding of one row is bound by the bandwidth of the weight, so more tiles are loaded in each depth.
+  WeightQuantKernelFunc kernel = row == 1 ? (is_int4 ? WeightQuantInt4Row1 : WeightQuantInt8Row1)
+                                          : (is_int4 ? WeightQuantInt4Row4 : WeightQuantInt8Row4);
+  int row_tile = row == 1 ? 1 : WEIGHT_QUANT_ROW_TILE;
+  int tile_step = row == 1 ? WQ_ROW1_TILE_NUM : WQ_ROW4_TILE_NUM;
+  for (int tile = start_tile; tile < end_tile; tile += tile_step) {
+    int cur_tile_num = MSMIN(tile_step, end_tile - tile);
+    for (int r = 0; r < row; r += row_tile) {
+      int a_sum_offset = zps == NULL ? 0 : r;
+      kernel(a + r * deep, (const uint8_t *)b, c + r * col, bias, scales, zps, a_sums + a_sum_offset, act_type, deep,
+             col, tile, MSMIN(row_tile, row - r), cur_tile_num);
+    }
+  }
+}
+#else
+static inline int8_t WeightQuantValue(const void *b, int tile, int deep, int k, int index, int bit_num) {
+  if (bit_num != WEIGHT_QUANT_INT4_BIT_NUM) {
+    return ((const int8_t *)b)[(tile * deep + k) * WEIGHT_QUANT_COL_TILE + index];
+  }
+  uint8_t value = ((const uint8_t *)b)[(tile * deep + k) * WEIGHT_QUANT_INT4_TILE_BYTES +
+                                       index % WEIGHT_QUANT_INT4_TILE_BYTES];
+  value = index < WEIGHT_QUANT_INT4_TILE_BYTES ? (value & 0x0F) : (value >> WEIGHT_QUANT_INT4_BIT_NUM);
+  return (int8_t)((value ^ 0x08) - 0x08);
+}
+
+void MatmulWeightQuantFp32(const float *a, const void *b, float *c, const float *bias, const float *scales,
+                           const float *zps, const float *a_sums, int act_type, int row, int deep, int col,
+                           int start_tile, int end_tile, int bit_num) {
+  int end_col = MSMIN(col, end_tile * WEIGHT_QUANT_COL_TILE);
+  for (int n = start_tile * WEIGHT_QUANT_COL_TILE; n < end_col; ++n) {
+    int tile = n / WEIGHT_QUANT_COL_TILE;
+    int index = n % WEIGHT_QUANT_COL_TILE;
+    for (int r = 0; r < row; ++r) {
+      float value = 0.0f;
+      for (int k = 0; k < deep; ++k) {
+        value += a[r * deep + k] * WeightQuantValue(b, tile, deep, k, index, bit_num);
+      }
+      if (zps != NULL) {
+        value -= zps[n] * a_sums[r];
+      }
+      value *= scales[n];
+      if (bias != NULL) {
+        value += bias[n];
+      }
+      if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+        value = MSMAX(value, 0.0f);
+      }
+      if (act_type == ActType_Relu6) {
+        value = MSMIN(value, 6.0f);
+      }
+      c[r * col + n] = value;
+    }
+  }
+}
+#endif
@@ -0,0 +1,45 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_NNACL_FP32_MATMUL_WEIGHT_QUANT_FP32_H_
+#define MINDSPORE_NNACL_FP32_MATMUL_WEIGHT_QUANT_FP32_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// the weight is packed in tiles of 16 columns, the float arrays of the columns (scales, zero points and bias) must be
+// padded to a multiple of WEIGHT_QUANT_COL_TILE.
+#define WEIGHT_QUANT_COL_TILE 16
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// pack the int8 weight [deep, col] ([col, deep] if transpose) to [UP_DIV(col, 16), deep, 16].
+void PackWeightQuantInt8(const int8_t *src, int8_t *dst, int deep, int col, bool transpose);
+
+// pack the int4 weight, which is stored in int8, to [UP_DIV(col, 16), deep, 8] bytes. The column j and j + 8 of one
+// tile share a byte, in the low and high 4 bits.
+void PackWeightQuantInt4(const int8_t *src, uint8_t *dst, int deep, int col, bool transpose);
+
+// c[row, col] = act(scales * (a * b - zps * a_sums) + bias), the weight is dequantized in registers. Only the column
+// tiles [start_tile, end_tile) are calculated. zps and a_sums (the sums of each row of a) can be NULL if the zero
+// points of the weight are all zero, bias can be NULL.
+void MatmulWeightQuantFp32(const float *a, const void *b, float *c, const float *bias, const float *scales,
+                           const float *zps, const float *a_sums, int act_type, int row, int deep, int col,
+                           int start_tile, int end_tile, int bit_num);
+#ifdef __cplusplus
+}
+#endif
+#endif  // MINDSPORE_NNACL_FP32_MATMUL_WEIGHT_QUANT_FP32_H_
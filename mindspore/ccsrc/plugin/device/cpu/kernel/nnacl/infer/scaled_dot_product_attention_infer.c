@@ -0,0 +1,67 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/infer/scaled_dot_product_attention_infer.h"
+#include "nnacl/infer/infer_register.h"
+
+int ScaledDotProductAttentionInferShape(const TensorC *const *inputs, size_t inputs_size, TensorC **outputs,
+                                        size_t outputs_size, OpParameter *parameter) {
+  int check_ret = CheckAugmentWithMinSize(inputs, inputs_size, outputs, outputs_size, parameter, C3NUM, 1);
+  if (check_ret != NNACL_OK) {
+    return check_ret;
+  }
+  // the optional mask is the 4th input, the optional log-sum-exp for the backward of training is the 2nd output.
+  if (inputs_size > C4NUM || outputs_size > C2NUM) {
+    return NNACL_INPUT_TENSOR_ERROR;
+  }
+  const TensorC *q = inputs[FIRST_INPUT];
+  const TensorC *k = inputs[SECOND_INPUT];
+  const TensorC *v = inputs[THIRD_INPUT];
+  TensorC *output = outputs[0];
+  SetDataTypeFormat(output, q);
+  if (outputs_size == C2NUM) {
+    SetDataTypeFormat(outputs[1], q);
+  }
+  if (!InferFlag(inputs, inputs_size)) {
+    return NNACL_INFER_INVALID;
+  }
+  // q: [..., q_seq, head_size], k and v: [..., kv_seq, head_size]
+  if (q->shape_size_ < DIMENSION_2D || q->shape_size_ != k->shape_size_ || k->shape_size_ != v->shape_size_) {
+    return NNACL_INPUT_TENSOR_ERROR;
+  }
+  for (size_t i = 0; i < k->shape_size_; i++) {
+    if (k->shape_[i] != v->shape_[i]) {
+      return NNACL_INPUT_TENSOR_ERROR;
+    }
+  }
+  for (size_t i = 0; i < q->shape_size_; i++) {
+    if (i != q->shape_size_ - DIMENSION_2D && q->shape_[i] != k->shape_[i]) {
+      return NNACL_INPUT_TENSOR_ERROR;
+    }
+  }
+  if (q->shape_[q->shape_size_ - DIMENSION_2D] > k->shape_[k->shape_size_ - DIMENSION_2D]) {
+    return NNACL_INPUT_TENSOR_ERROR;
+  }
+  SetShapeTensor(output, q);
+  if (outputs_size == C2NUM) {
+    // lse: [..., q_seq]
+    SetShapeTensor(outputs[1], q);
+    outputs[1]->shape_size_--;
+  }
+  return NNACL_OK;
+}
+
+REG_INFER(ScaledDotProductAttention, PrimType_ScaledDotProductAttention, ScaledDotProductAttentionInferShape)
@@ -72,6 +72,32 @@ void MatMulInt8_4x16_r(const int8_t *a, const int8_t *b, int8_t *dst, size_t row
                        const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
                        int32_t maxi, size_t per_channel, const int32_t *filter_zp);
 
+#ifdef ENABLE_AVX
+/* the vnni kernels need the target attribute of the compiler, they are dispatched by ms_simd_cpu_info at runtime */
+#if (defined(__clang__) && __clang_major__ >= 6) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 8)
+#define ENABLE_AVX512_VNNI_INT8
+#endif
+#if (defined(__clang__) && __clang_major__ >= 12) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 11)
+#define ENABLE_AVX_VNNI_INT8
+#endif
+void MatmulInt8OptAvx2(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16, const int *a_sums,
+                       const int *bias, int act_min, int act_max, int out_zp, const int32_t *multiplier,
+                       const int32_t *left_shift, const int32_t *right_shift, size_t stride, size_t filter_peroc,
+                       const int32_t *filter_zp);
+#ifdef ENABLE_AVX_VNNI_INT8
+void MatmulInt8OptAvxVnni(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                          const int *a_sums, const int *bias, int act_min, int act_max, int out_zp,
+                          const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift,
+                          size_t stride, size_t filter_peroc, const int32_t *filter_zp);
+#endif
+#ifdef ENABLE_AVX512_VNNI_INT8
+void MatmulInt8OptAvx512Vnni(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                             const int *a_sums, const int *bias, int act_min, int act_max, int out_zp,
+                             const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift,
+                             size_t stride, size_t filter_peroc, const int32_t *filter_zp);
+#endif
+#endif
+
 #ifdef ENABLE_ARM64
 void MatmulInt8Neon64(const int8_t *a, const int8_t *b, int8_t *dst, int row4, int col4, int deep16, const int *a_sums,
                       const int *bias, int act_min, int act_max, int out_zp, int32_t *multiplier, int32_t *left_shift,
@@ -0,0 +1,437 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifdef ENABLE_AVX
+#include "nnacl/intrinsics/ms_simd_instructions.h"
+#include "nnacl/int8/matmul_int8.h"
+#include "nnacl/op_base.h"
+
+/*
+ * All the kernels compute row4x16-major * row16x4-major => (int8)row-major, which is the same as MatmulInt8Opt.
+ * The vnni instruction multiplies unsigned a by signed b, so a is shifted to uint8 by adding 128, and
+ * 128 * sum(b) of each column is subtracted from the result.
+ */
+#define INT8_BLOCK_SIZE 64 /* C4NUM * C16NUM */
+#define INT8_TO_UINT8_OFFSET 0x80
+
+typedef struct MatmulInt8QuantAvx2 {
+  __m256i bias_;
+  __m256i filter_zp_;
+  __m256i multiplier_;
+  __m256i left_shift_;
+  __m256i right_shift_;
+  __m256i out_zp_;
+  __m256i act_min_;
+  __m256i act_max_;
+} MatmulInt8QuantAvx2;
+
+/* load the params of 4 columns into both 128 bit lanes, the lanes are for 2 rows */
+static inline __m256i LoadColParamAvx2(const int32_t *src, int cur_col, bool per_channel) {
+  if (!per_channel) {
+    return _mm256_set1_epi32(src[0]);
+  }
+  int32_t tmp[C4NUM] = {0};
+  memcpy(tmp, src, cur_col * sizeof(int32_t));
+  return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)tmp));
+}
+
+static inline void InitMatmulInt8QuantAvx2(MatmulInt8QuantAvx2 *quant, int c, int cur_col, const int *bias,
+                                           int act_min, int act_max, int out_zp, const int32_t *multiplier,
+                                           const int32_t *left_shift, const int32_t *right_shift,
+                                           size_t filter_peroc, const int32_t *filter_zp) {
+  size_t param_offset = filter_peroc ? c : 0;
+  quant->bias_ = LoadColParamAvx2(bias + c, cur_col, true);
+  quant->filter_zp_ = filter_peroc ? LoadColParamAvx2(filter_zp + c, cur_col, true) : _mm256_set1_epi32(1);
+  quant->multiplier_ = LoadColParamAvx2(multiplier + param_offset, cur_col, filter_peroc);
+  quant->left_shift_ = LoadColParamAvx2(left_shift + param_offset, cur_col, filter_peroc);
+  quant->right_shift_ = _mm256_sub_epi32(_mm256_setzero_si256(),
+                                         LoadColParamAvx2(right_shift + param_offset, cur_col, filter_peroc));
+  quant->out_zp_ = _mm256_set1_epi32(out_zp);
+  quant->act_min_ = _mm256_set1_epi32(act_min);
+  quant->act_max_ = _mm256_set1_epi32(act_max);
+}
+
+/* the vector version of SaturatingRoundingDoublingHighMul, the 64 bit products are computed on even and odd lanes */
+static inline __m256i RoundingHalfHighAvx2(__m256i ab) {
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i rounding = _mm256_blendv_epi8(_mm256_set1_epi64x(1ll << 30), _mm256_set1_epi64x(1ll - (1ll << 30)),
+                                        _mm256_cmpgt_epi64(zero, ab));
+  __m256i x = _mm256_add_epi64(ab, rounding);
+  // truncate towards zero as the division does, only the low 32 bits of the result are used
+  x = _mm256_add_epi64(x, _mm256_and_si256(_mm256_cmpgt_epi64(zero, x), _mm256_set1_epi64x(0x7FFFFFFFll)));
+  return _mm256_srli_epi64(x, 31);
+}
+
+static inline __m256i SaturatingRoundingDoublingHighMulAvx2(__m256i a, __m256i b) {
+  __m256i even = RoundingHalfHighAvx2(_mm256_mul_epi32(a, b));
+  __m256i odd = RoundingHalfHighAvx2(_mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)));
+  __m256i res = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+  const __m256i int_min = _mm256_set1_epi32(INT_MIN);
+  __m256i overflow = _mm256_and_si256(_mm256_cmpeq_epi32(a, int_min), _mm256_cmpeq_epi32(b, int_min));
+  return _mm256_blendv_epi8(res, _mm256_set1_epi32(INT_MAX), overflow);
+}
+
+static inline __m256i RoundingDivideByPOTAvx2(__m256i x, __m256i exponent) {
+  const __m256i one = _mm256_set1_epi32(1);
+  __m256i mask = _mm256_sub_epi32(_mm256_sllv_epi32(one, exponent), one);
+  __m256i remainder = _mm256_and_si256(x, mask);
+  __m256i threshold = _mm256_add_epi32(_mm256_srai_epi32(mask, 1), _mm256_srli_epi32(x, 31));
+  return _mm256_sub_epi32(_mm256_srav_epi32(x, exponent), _mm256_cmpgt_epi32(remainder, threshold));
+}
+
+/* value is the int32 result of 2 rows * 4 columns, the low lane is row0 and the high lane is row1 */
+static inline void RequantStoreRow2x4Avx2(__m256i value, const MatmulInt8QuantAvx2 *quant, const int *a_sums,
+                                          int cur_row, int cur_col, int8_t *dst, size_t stride) {
+  __m256i input_sum = _mm256_set1_epi32(a_sums[0]);
+  if (cur_row > 1) {
+    input_sum = _mm256_inserti128_si256(input_sum, _mm_set1_epi32(a_sums[1]), 1);
+  }
+  value = _mm256_sub_epi32(value, _mm256_mullo_epi32(input_sum, quant->filter_zp_));
+  value = _mm256_add_epi32(value, quant->bias_);
+  value = _mm256_sllv_epi32(value, quant->left_shift_);
+  value = SaturatingRoundingDoublingHighMulAvx2(value, quant->multiplier_);
+  value = RoundingDivideByPOTAvx2(value, quant->right_shift_);
+  value = _mm256_add_epi32(value, quant->out_zp_);
+  value = _mm256_min_epi32(value, quant->act_max_);
+  value = _mm256_max_epi32(value, quant->act_min_);
+
+  __m128i res16 = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+  __m128i res8 = _mm_packs_epi16(res16, res16);
+  int32_t row0 = _mm_cvtsi128_si32(res8);
+  memcpy(dst, &row0, cur_col);
+  if (cur_row > 1) {
+    int32_t row1 = _mm_extract_epi32(res8, 1);
+    memcpy(dst + stride, &row1, cur_col);
+  }
+}
+
+/* 2 rows * 4 columns of int8 dot product, the int8 values are extended to int16 for madd */
+static inline __m256i MatmulInt8Row2x4Avx2(const int8_t *a, const int8_t *b, int deep16) {
+  __m256i acc00 = _mm256_setzero_si256();
+  __m256i acc01 = _mm256_setzero_si256();
+  __m256i acc02 = _mm256_setzero_si256();
+  __m256i acc03 = _mm256_setzero_si256();
+  __m256i acc10 = _mm256_setzero_si256();
+  __m256i acc11 = _mm256_setzero_si256();
+  __m256i acc12 = _mm256_setzero_si256();
+  __m256i acc13 = _mm256_setzero_si256();
+  for (int d = 0; d < deep16; d += C16NUM) {
+    __m256i b0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b)));
+    __m256i b1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b + C16NUM)));
+    __m256i b2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b + C32NUM)));
+    __m256i b3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b + C48NUM)));
+    __m256i a0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(a)));
+    acc00 = _mm256_add_epi32(acc00, _mm256_madd_epi16(a0, b0));
+    acc01 = _mm256_add_epi32(acc01, _mm256_madd_epi16(a0, b1));
+    acc02 = _mm256_add_epi32(acc02, _mm256_madd_epi16(a0, b2));
+    acc03 = _mm256_add_epi32(acc03, _mm256_madd_epi16(a0, b3));
+    __m256i a1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(a + C16NUM)));
+    acc10 = _mm256_add_epi32(acc10, _mm256_madd_epi16(a1, b0));
+    acc11 = _mm256_add_epi32(acc11, _mm256_madd_epi16(a1, b1));
+    acc12 = _mm256_add_epi32(acc12, _mm256_madd_epi16(a1, b2));
+    acc13 = _mm256_add_epi32(acc13, _mm256_madd_epi16(a1, b3));
+    a += INT8_BLOCK_SIZE;
+    b += INT8_BLOCK_SIZE;
+  }
+  __m256i row0 = _mm256_hadd_epi32(_mm256_hadd_epi32(acc00, acc01), _mm256_hadd_epi32(acc02, acc03));
+  __m256i row1 = _mm256_hadd_epi32(_mm256_hadd_epi32(acc10, acc11), _mm256_hadd_epi32(acc12, acc13));
+  __m128i res0 = _mm_add_epi32(_mm256_castsi256_si128(row0), _mm256_extracti128_si256(row0, 1));
+  __m128i res1 = _mm_add_epi32(_mm256_castsi256_si128(row1), _mm256_extracti128_si256(row1, 1));
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(res0), res1, 1);
+}
+
+void MatmulInt8OptAvx2(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16, const int *a_sums,
+                       const int *bias, int act_min, int act_max, int out_zp, const int32_t *multiplier,
+                       const int32_t *left_shift, const int32_t *right_shift, size_t stride, size_t filter_peroc,
+                       const int32_t *filter_zp) {
+  MatmulInt8QuantAvx2 quant;
+  for (int c = 0; c < col; c += C4NUM) {
+    int cur_col = MSMIN(C4NUM, col - c);
+    const int8_t *cur_b = b + c * deep16;
+    InitMatmulInt8QuantAvx2(&quant, c, cur_col, bias, act_min, act_max, out_zp, multiplier, left_shift, right_shift,
+                            filter_peroc, filter_zp);
+    for (int r = 0; r < row; r += C2NUM) {
+      // the rows of a are packed in blocks of 4 rows, the second row pair starts at offset C2NUM * C16NUM
+      const int8_t *cur_a = a + (r / C4NUM) * deep16 * C4NUM + (r % C4NUM) * C16NUM;
+      __m256i value = MatmulInt8Row2x4Avx2(cur_a, cur_b, deep16);
+      RequantStoreRow2x4Avx2(value, &quant, a_sums + r, MSMIN(C2NUM, row - r), cur_col, dst + r * stride + c, stride);
+    }
+  }
+}
+
+#ifdef ENABLE_AVX_VNNI_INT8
+#define AVX_VNNI_TARGET __attribute__((target("avx2,avxvnni")))
+
+/* reorder [r0c0, r0c2, r1c0, r1c2 | r0c1, r0c3, r1c1, r1c3] to [r0c0, r0c1, r0c2, r0c3 | r1c0, r1c1, r1c2, r1c3] */
+AVX_VNNI_TARGET static inline __m256i ReduceRow2x4AvxVnni(__m256i acc00, __m256i acc01, __m256i acc10,
+                                                          __m256i acc11) {
+  __m256i res = _mm256_hadd_epi32(_mm256_hadd_epi32(acc00, acc01), _mm256_hadd_epi32(acc10, acc11));
+  return _mm256_permutevar8x32_epi32(res, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+void AVX_VNNI_TARGET MatmulInt8OptAvxVnni(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col,
+                                          int deep16, const int *a_sums, const int *bias, int act_min, int act_max,
+                                          int out_zp, const int32_t *multiplier, const int32_t *left_shift,
+                                          const int32_t *right_shift, size_t stride, size_t filter_peroc,
+                                          const int32_t *filter_zp) {
+  const __m256i offset = _mm256_set1_epi8((char)INT8_TO_UINT8_OFFSET);
+  MatmulInt8QuantAvx2 quant;
+  for (int c = 0; c < col; c += C4NUM) {
+    int cur_col = MSMIN(C4NUM, col - c);
+    const int8_t *cur_b = b + c * deep16;
+    InitMatmulInt8QuantAvx2(&quant, c, cur_col, bias, act_min, act_max, out_zp, multiplier, left_shift, right_shift,
+                            filter_peroc, filter_zp);
+    // 128 * sum(b) of each column, the int8 offset of a is subtracted with it
+    __m256i offset_sum0 = _mm256_setzero_si256();
+    __m256i offset_sum1 = _mm256_setzero_si256();
+    for (int d = 0; d < deep16; d += C16NUM) {
+      const int8_t *b_ptr = cur_b + d * C4NUM;
+      offset_sum0 = _mm256_dpbusd_avx_epi32(offset_sum0, offset, _mm256_loadu_si256((const __m256i *)b_ptr));
+      offset_sum1 =
+        _mm256_dpbusd_avx_epi32(offset_sum1, offset, _mm256_loadu_si256((const __m256i *)(b_ptr + C32NUM)));
+    }
+    __m256i b_offset = ReduceRow2x4AvxVnni(offset_sum0, offset_sum1, offset_sum0, offset_sum1);
+    quant.bias_ = _mm256_sub_epi32(quant.bias_, b_offset);
+
+    for (int r = 0; r < row; r += C4NUM) {
+      const int8_t *a_ptr = a + r * deep16;
+      const int8_t *b_ptr = cur_b;
+      __m256i acc00 = _mm256_setzero_si256();
+      __m256i acc01 = _mm256_setzero_si256();
+      __m256i acc10 = _mm256_setzero_si256();
+      __m256i acc11 = _mm256_setzero_si256();
+      __m256i acc20 = _mm256_setzero_si256();
+      __m256i acc21 = _mm256_setzero_si256();
+      __m256i acc30 = _mm256_setzero_si256();
+      __m256i acc31 = _mm256_setzero_si256();
+      for (int d = 0; d < deep16; d += C16NUM) {
+        __m256i b0 = _mm256_loadu_si256((const __m256i *)b_ptr);
+        __m256i b1 = _mm256_loadu_si256((const __m256i *)(b_ptr + C32NUM));
+        __m256i a0 = _mm256_xor_si256(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)a_ptr)), offset);
+        acc00 = _mm256_dpbusd_avx_epi32(acc00, a0, b0);
+        acc01 = _mm256_dpbusd_avx_epi32(acc01, a0, b1);
+        __m256i a1 = _mm256_xor_si256(
+          _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(a_ptr + C16NUM))), offset);
+        acc10 = _mm256_dpbusd_avx_epi32(acc10, a1, b0);
+        acc11 = _mm256_dpbusd_avx_epi32(acc11, a1, b1);
+        __m256i a2 = _mm256_xor_si256(
+          _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(a_ptr + C32NUM))), offset);
+        acc20 = _mm256_dpbusd_avx_epi32(acc20, a2, b0);
+        acc21 = _mm256_dpbusd_avx_epi32(acc21, a2, b1);
+        __m256i a3 = _mm256_xor_si256(
+          _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(a_ptr + C48NUM))), offset);
+        acc30 = _mm256_dpbusd_avx_epi32(acc30, a3, b0);
+        acc31 = _mm256_dpbusd_avx_epi32(acc31, a3, b1);
+        a_ptr += INT8_BLOCK_SIZE;
+        b_ptr += INT8_BLOCK_SIZE;
+      }
+      int8_t *dst_ptr = dst + r * stride + c;
+      int cur_row = MSMIN(C4NUM, row - r);
+      RequantStoreRow2x4Avx2(ReduceRow2x4AvxVnni(acc00, acc01, acc10, acc11), &quant, a_sums + r,
+                             MSMIN(C2NUM, cur_row), cur_col, dst_ptr, stride);
+      if (cur_row > C2NUM) {
+        RequantStoreRow2x4Avx2(ReduceRow2x4AvxVnni(acc20, acc21, acc30, acc31), &quant, a_sums + r + C2NUM,
+                               cur_row - C2NUM, cur_col, dst_ptr + C2NUM * stride, stride);
+      }
+    }
+  }
+}
+#endif
+
+#ifdef ENABLE_AVX512_VNNI_INT8
+#define AVX512_VNNI_TARGET __attribute__((target("avx512f,avx512vnni")))
+
+typedef struct MatmulInt8QuantAvx512 {
+  __m512i bias_;
+  __m512i filter_zp_;
+  __m512i multiplier_;
+  __m512i left_shift_;
+  __m512i right_shift_;
+  __m512i out_zp_;
+  __m512i act_min_;
+  __m512i act_max_;
+  __mmask16 col_mask_;
+} MatmulInt8QuantAvx512;
+
+AVX512_VNNI_TARGET static inline __m512i LoadColParamAvx512(const int32_t *src, __mmask16 col_mask,
+                                                            bool per_channel) {
+  return per_channel ? _mm512_maskz_loadu_epi32(col_mask, src) : _mm512_set1_epi32(src[0]);
+}
+
+/*
+ * x0 ~ x3 are the results of 4 column blocks, and the 128 bit lane i of them is the column i of the block.
+ * The 4 int32 of each lane are summed, and the result is reordered to the column order.
+ */
+AVX512_VNNI_TARGET static inline __m512i ReduceRow1x16Avx512(__m512i x0, __m512i x1, __m512i x2, __m512i x3) {
+  __m512i s01 = _mm512_add_epi32(_mm512_unpacklo_epi32(x0, x1), _mm512_unpackhi_epi32(x0, x1));
+  __m512i s23 = _mm512_add_epi32(_mm512_unpacklo_epi32(x2, x3), _mm512_unpackhi_epi32(x2, x3));
+  __m512i sum = _mm512_add_epi32(_mm512_unpacklo_epi64(s01, s23), _mm512_unpackhi_epi64(s01, s23));
+  const __m512i index = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+  return _mm512_permutexvar_epi32(index, sum);
+}
+
+AVX512_VNNI_TARGET static inline __m512i RoundingHalfHighAvx512(__m512i ab) {
+  __mmask8 negative = _mm512_cmplt_epi64_mask(ab, _mm512_setzero_si512());
+  __m512i x = _mm512_add_epi64(
+    ab, _mm512_mask_blend_epi64(negative, _mm512_set1_epi64(1ll << 30), _mm512_set1_epi64(1ll - (1ll << 30))));
+  // truncate towards zero as the division does
+  negative = _mm512_cmplt_epi64_mask(x, _mm512_setzero_si512());
+  x = _mm512_mask_add_epi64(x, negative, x, _mm512_set1_epi64(0x7FFFFFFFll));
+  return _mm512_srai_epi64(x, 31);
+}
+
+AVX512_VNNI_TARGET static inline __m512i SaturatingRoundingDoublingHighMulAvx512(__m512i a, __m512i b) {
+  __m512i even = RoundingHalfHighAvx512(_mm512_mul_epi32(a, b));
+  __m512i odd = RoundingHalfHighAvx512(_mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32)));
+  __m512i res = _mm512_mask_blend_epi32(0xAAAA, even, _mm512_slli_epi64(odd, 32));
+  const __m512i int_min = _mm512_set1_epi32(INT_MIN);
+  __mmask16 overflow = _mm512_cmpeq_epi32_mask(a, int_min) & _mm512_cmpeq_epi32_mask(b, int_min);
+  return _mm512_mask_mov_epi32(res, overflow, _mm512_set1_epi32(INT_MAX));
+}
+
+AVX512_VNNI_TARGET static inline __m512i RoundingDivideByPOTAvx512(__m512i x, __m512i exponent) {
+  const __m512i one = _mm512_set1_epi32(1);
+  __m512i mask = _mm512_sub_epi32(_mm512_sllv_epi32(one, exponent), one);
+  __m512i remainder = _mm512_and_si512(x, mask);
+  __m512i threshold = _mm512_add_epi32(_mm512_srai_epi32(mask, 1), _mm512_srli_epi32(x, 31));
+  __m512i res = _mm512_srav_epi32(x, exponent);
+  return _mm512_mask_add_epi32(res, _mm512_cmpgt_epi32_mask(remainder, threshold), res, one);
+}
+
+AVX512_VNNI_TARGET static inline void RequantStoreRow1x16Avx512(__m512i value, const MatmulInt8QuantAvx512 *quant,
+                                                                int a_sum, int8_t *dst) {
+  value = _mm512_sub_epi32(value, _mm512_mullo_epi32(_mm512_set1_epi32(a_sum), quant->filter_zp_));
+  value = _mm512_add_epi32(value, quant->bias_);
+  value = _mm512_sllv_epi32(value, quant->left_shift_);
+  value = SaturatingRoundingDoublingHighMulAvx512(value, quant->multiplier_);
+  value = RoundingDivideByPOTAvx512(value, quant->right_shift_);
+  value = _mm512_add_epi32(value, quant->out_zp_);
+  value = _mm512_min_epi32(value, quant->act_max_);
+  value = _mm512_max_epi32(value, quant->act_min_);
+  _mm512_mask_cvtepi32_storeu_epi8(dst, quant->col_mask_, value);
+}
+
+AVX512_VNNI_TARGET static inline void InitMatmulInt8QuantAvx512(MatmulInt8QuantAvx512 *quant, int c, int cur_col,
+                                                                const int *bias, int act_min, int act_max,
+                                                                int out_zp, const int32_t *multiplier,
+                                                                const int32_t *left_shift,
+                                                                const int32_t *right_shift, size_t filter_peroc,
+                                                                const int32_t *filter_zp) {
+  size_t param_offset = filter_peroc ? c : 0;
+  quant->col_mask_ = (__mmask16)((1u << cur_col) - 1);
+  quant->bias_ = LoadColParamAvx512(bias + c, quant->col_mask_, true);
+  quant->filter_zp_ =
+    filter_peroc ? LoadColParamAvx512(filter_zp + c, quant->col_mask_, true) : _mm512_set1_epi32(1);
+  quant->multiplier_ = LoadColParamAvx512(multiplier + param_offset, quant->col_mask_, filter_peroc);
+  quant->left_shift_ = LoadColParamAvx512(left_shift + param_offset, quant->col_mask_, filter_peroc);
+  quant->right_shift_ = _mm512_sub_epi32(
+    _mm512_setzero_si512(), LoadColParamAvx512(right_shift + param_offset, quant->col_mask_, filter_peroc));
+  quant->out_zp_ = _mm512_set1_epi32(out_zp);
+  quant->act_min_ = _mm512_set1_epi32(act_min);
+  quant->act_max_ = _mm512_set1_epi32(act_max);
+}
+
+void AVX512_VNNI_TARGET MatmulInt8OptAvx512Vnni(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col,
+                                                int deep16, const int *a_sums, const int *bias, int act_min,
+                                                int act_max, int out_zp, const int32_t *multiplier,
+                                                const int32_t *left_shift, const int32_t *right_shift,
+                                                size_t stride, size_t filter_peroc, const int32_t *filter_zp) {
+  const __m512i offset = _mm512_set1_epi8((char)INT8_TO_UINT8_OFFSET);
+  MatmulInt8QuantAvx512 quant;
+  for (int c = 0; c < col; c += C16NUM) {
+    int cur_col = MSMIN(C16NUM, col - c);
+    InitMatmulInt8QuantAvx512(&quant, c, cur_col, bias, act_min, act_max, out_zp, multiplier, left_shift,
+                              right_shift, filter_peroc, filter_zp);
+    // the column blocks out of range reuse the first block, their results are masked when stored
+    int block_num = UP_DIV(cur_col, C4NUM);
+    const int8_t *b0_ptr = b + c * deep16;
+    const int8_t *b1_ptr = block_num > C1NUM ? b0_ptr + C4NUM * deep16 : b0_ptr;
+    const int8_t *b2_ptr = block_num > C2NUM ? b0_ptr + C8NUM * deep16 : b0_ptr;
+    const int8_t *b3_ptr = block_num > C3NUM ? b0_ptr + C12NUM * deep16 : b0_ptr;
+
+    // 128 * sum(b) of each column, the int8 offset of a is subtracted with it
+    __m512i offset_sum0 = _mm512_setzero_si512();
+    __m512i offset_sum1 = _mm512_setzero_si512();
+    __m512i offset_sum2 = _mm512_setzero_si512();
+    __m512i offset_sum3 = _mm512_setzero_si512();
+    for (int d = 0; d < deep16 * C4NUM; d += INT8_BLOCK_SIZE) {
+      offset_sum0 = _mm512_dpbusd_epi32(offset_sum0, offset, _mm512_loadu_si512(b0_ptr + d));
+      offset_sum1 = _mm512_dpbusd_epi32(offset_sum1, offset, _mm512_loadu_si512(b1_ptr + d));
+      offset_sum2 = _mm512_dpbusd_epi32(offset_sum2, offset, _mm512_loadu_si512(b2_ptr + d));
+      offset_sum3 = _mm512_dpbusd_epi32(offset_sum3, offset, _mm512_loadu_si512(b3_ptr + d));
+    }
+    quant.bias_ =
+      _mm512_sub_epi32(quant.bias_, ReduceRow1x16Avx512(offset_sum0, offset_sum1, offset_sum2, offset_sum3));
+
+    for (int r = 0; r < row; r += C4NUM) {
+      const int8_t *a_ptr = a + r * deep16;
+      __m512i acc00 = _mm512_setzero_si512(), acc01 = _mm512_setzero_si512();
+      __m512i acc02 = _mm512_setzero_si512(), acc03 = _mm512_setzero_si512();
+      __m512i acc10 = _mm512_setzero_si512(), acc11 = _mm512_setzero_si512();
+      __m512i acc12 = _mm512_setzero_si512(), acc13 = _mm512_setzero_si512();
+      __m512i acc20 = _mm512_setzero_si512(), acc21 = _mm512_setzero_si512();
+      __m512i acc22 = _mm512_setzero_si512(), acc23 = _mm512_setzero_si512();
+      __m512i acc30 = _mm512_setzero_si512(), acc31 = _mm512_setzero_si512();
+      __m512i acc32 = _mm512_setzero_si512(), acc33 = _mm512_setzero_si512();
+      for (int d = 0; d < deep16 * C4NUM; d += INT8_BLOCK_SIZE) {
+        __m512i b0 = _mm512_loadu_si512(b0_ptr + d);
+        __m512i b1 = _mm512_loadu_si512(b1_ptr + d);
+        __m512i b2 = _mm512_loadu_si512(b2_ptr + d);
+        __m512i b3 = _mm512_loadu_si512(b3_ptr + d);
+        const int8_t *a_block = a_ptr + d;
+        __m512i a0 = _mm512_xor_si512(_mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)a_block)), offset);
+        acc00 = _mm512_dpbusd_epi32(acc00, a0, b0);
+        acc01 = _mm512_dpbusd_epi32(acc01, a0, b1);
+        acc02 = _mm512_dpbusd_epi32(acc02, a0, b2);
+        acc03 = _mm512_dpbusd_epi32(acc03, a0, b3);
+        __m512i a1 =
+          _mm512_xor_si512(_mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a_block + C16NUM))), offset);
+        acc10 = _mm512_dpbusd_epi32(acc10, a1, b0);
+        acc11 = _mm512_dpbusd_epi32(acc11, a1, b1);
+        acc12 = _mm512_dpbusd_epi32(acc12, a1, b2);
+        acc13 = _mm512_dpbusd_epi32(acc13, a1, b3);
+        __m512i a2 =
+          _mm512_xor_si512(_mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a_block + C32NUM))), offset);
+        acc20 = _mm512_dpbusd_epi32(acc20, a2, b0);
+        acc21 = _mm512_dpbusd_epi32(acc21, a2, b1);
+        acc22 = _mm512_dpbusd_epi32(acc22, a2, b2);
+        acc23 = _mm512_dpbusd_epi32(acc23, a2, b3);
+        __m512i a3 =
+          _mm512_xor_si512(_mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)(a_block + C48NUM))), offset);
+        acc30 = _mm512_dpbusd_epi32(acc30, a3, b0);
+        acc31 = _mm512_dpbusd_epi32(acc31, a3, b1);
+        acc32 = _mm512_dpbusd_epi32(acc32, a3, b2);
+        acc33 = _mm512_dpbusd_epi32(acc33, a3, b3);
+      }
+      int cur_row = MSMIN(C4NUM, row - r);
+      int8_t *dst_ptr = dst + r * stride + c;
+      RequantStoreRow1x16Avx512(ReduceRow1x16Avx512(acc00, acc01, acc02, acc03), &quant, a_sums[r], dst_ptr);
+      if (cur_row > C1NUM) {
+        RequantStoreRow1x16Avx512(ReduceRow1x16Avx512(acc10, acc11, acc12, acc13), &quant, a_sums[r + C1NUM],
+                                  dst_ptr + stride);
+      }
+      if (cur_row > C2NUM) {
+        RequantStoreRow1x16Avx512(ReduceRow1x16Avx512(acc20, acc21, acc22, acc23), &quant, a_sums[r + C2NUM],
+                                  dst_ptr + C2NUM * stride);
+      }
+      if (cur_row > C3NUM) {
+        RequantStoreRow1x16Avx512(ReduceRow1x16Avx512(acc30, acc31, acc32, acc33), &quant, a_sums[r + C3NUM],
+                                  dst_ptr + C3NUM * stride);
+      }
+    }
+  }
+}
+#endif
+#endif
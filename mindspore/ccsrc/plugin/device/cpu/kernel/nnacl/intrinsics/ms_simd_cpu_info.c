@@ -20,14 +20,25 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
 #include "nnacl/errorcode.h"
 
+#define ARCH_REQ_XCOMP_PERM 0x1023
+#define XFEATURE_XTILEDATA 18
+
 typedef unsigned int DWORD;
 struct X86CpuInfoContext {
   bool fma_flag_;
   bool sse4_1_flag_;
   bool avx2_flag_;
   bool avx512_flag_;
+  bool avx512_vnni_flag_;
+  bool avx_vnni_flag_;
+  bool avx512_bf16_flag_;
+  bool amx_bf16_flag_;
 };
 
 struct X86CpuInfoContext g_x86_cpu_info_context_;
@@ -36,19 +47,24 @@ inline const bool X86_Fma_Support(void) { return g_x86_cpu_info_context_.fma_fla
 inline const bool X86_Sse_Support(void) { return g_x86_cpu_info_context_.sse4_1_flag_; }
 inline const bool X86_Avx_Support(void) { return g_x86_cpu_info_context_.avx2_flag_; }
 inline const bool X86_Avx512_Support(void) { return g_x86_cpu_info_context_.avx512_flag_; }
+inline const bool X86_Avx512_Vnni_Support(void) { return g_x86_cpu_info_context_.avx512_vnni_flag_; }
+inline const bool X86_Avx_Vnni_Support(void) { return g_x86_cpu_info_context_.avx_vnni_flag_; }
+inline const bool X86_Avx512_Bf16_Support(void) { return g_x86_cpu_info_context_.avx512_bf16_flag_; }
+inline const bool X86_Amx_Bf16_Support(void) { return g_x86_cpu_info_context_.amx_bf16_flag_; }
 
-void ExecuteCpuIdCmd(DWORD cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data, DWORD *edx_data) {
+void ExecuteCpuIdSubCmd(DWORD cmd_code, DWORD sub_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data,
+                        DWORD *edx_data) {
   DWORD deax, debx, decx, dedx;
   asm volatile(
     "movl %4, %%eax;\n"
-    "movl $0, %%ecx;\n"
+    "movl %5, %%ecx;\n"
     "cpuid;\n"
     "movl %%eax, %0;\n"
     "movl %%ebx, %1;\n"
     "movl %%ecx, %2;\n"
     "movl %%edx, %3;\n"
     : "=r"(deax), "=r"(debx), "=r"(decx), "=r"(dedx)
-    : "r"(cmd_code)
+    : "r"(cmd_code), "r"(sub_code)
     : "%eax", "%ebx", "%ecx", "%edx");
 
   *eax_data = deax;
@@ -57,6 +73,25 @@ void ExecuteCpuIdCmd(DWORD cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ec
   *edx_data = dedx;
 }
 
+void ExecuteCpuIdCmd(DWORD cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data, DWORD *edx_data) {
+  ExecuteCpuIdSubCmd(cmd_code, 0, eax_data, ebx_data, ecx_data, edx_data);
+}
+
+// the tile data of amx is disabled by default, it must be enabled in xcr0 by os and requested by the process on linux.
+static bool EnableAmxTileData(void) {
+  DWORD xcr0_eax, xcr0_edx;
+  asm volatile("xgetbv" : "=a"(xcr0_eax), "=d"(xcr0_edx) : "c"(0));
+  const DWORD tile_mask = (1 << 17) | (1 << 18);  // xtilecfg is 17 bit, xtiledata is 18 bit
+  if ((xcr0_eax & tile_mask) != tile_mask) {
+    return false;
+  }
+#ifdef __linux__
+  return syscall(SYS_arch_prctl, ARCH_REQ_XCOMP_PERM, XFEATURE_XTILEDATA) == 0;
+#else
+  return false;
+#endif
+}
+
 bool IsIntelX86Platform(void) {
   DWORD eax_data, ebx_data, ecx_data, edx_data;
 
@@ -85,9 +120,23 @@ int IntelX86CpuInfoInit(void) {
   g_x86_cpu_info_context_.sse4_1_flag_ = (ecx_data & (1 << 19)) == 0 ? false : true;  // sse flag is ecx 19 bit
   g_x86_cpu_info_context_.fma_flag_ = (ecx_data & (1 << 12)) == 0 ? false : true;     // fma flag is ecx 12 bit
 
+  bool osxsave = (ecx_data & (1 << 27)) != 0;  // osxsave flag is ecx 27 bit
+
   ExecuteCpuIdCmd(7, &eax_data, &ebx_data, &ecx_data, &edx_data);  // eax = 7, execute cpuid to get avx2/avx512 flag
   g_x86_cpu_info_context_.avx2_flag_ = (ebx_data & (1 << 5)) == 0 ? false : true;     // avx2 flag is ecx 5 bit
   g_x86_cpu_info_context_.avx512_flag_ = (ebx_data & (1 << 16)) == 0 ? false : true;  // avx512 flag is ecx 16 bit
+  // avx512 vnni flag is ecx 11 bit
+  g_x86_cpu_info_context_.avx512_vnni_flag_ = g_x86_cpu_info_context_.avx512_flag_ && (ecx_data & (1 << 11)) != 0;
+  // amx-bf16 flag is edx 22 bit, amx-tile flag is edx 24 bit
+  bool amx_bf16 = (edx_data & (1 << 22)) != 0 && (edx_data & (1 << 24)) != 0;
+
+  ExecuteCpuIdSubCmd(7, 1, &eax_data, &ebx_data, &ecx_data, &edx_data);  // eax = 7, ecx = 1, get avx-vnni/bf16 flag
+  // avx-vnni flag is eax 4 bit
+  g_x86_cpu_info_context_.avx_vnni_flag_ = g_x86_cpu_info_context_.avx2_flag_ && (eax_data & (1 << 4)) != 0;
+  // avx512 bf16 flag is eax 5 bit
+  g_x86_cpu_info_context_.avx512_bf16_flag_ = g_x86_cpu_info_context_.avx512_flag_ && (eax_data & (1 << 5)) != 0;
+  g_x86_cpu_info_context_.amx_bf16_flag_ =
+    g_x86_cpu_info_context_.avx512_bf16_flag_ && amx_bf16 && osxsave && EnableAmxTileData();
 
   return NNACL_OK;
 }
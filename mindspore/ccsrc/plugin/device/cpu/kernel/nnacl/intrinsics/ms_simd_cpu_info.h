@@ -36,6 +36,10 @@ const bool X86_Fma_Support(void);
 const bool X86_Sse_Support(void);
 const bool X86_Avx_Support(void);
 const bool X86_Avx512_Support(void);
+const bool X86_Avx512_Vnni_Support(void);
+const bool X86_Avx_Vnni_Support(void);
+const bool X86_Avx512_Bf16_Support(void);
+const bool X86_Amx_Bf16_Support(void);
 
 bool IsIntelX86Platform(void);
 X86CpuInfoErrorCodeEnum IntelX86InstructionSetSupportCheck(void);
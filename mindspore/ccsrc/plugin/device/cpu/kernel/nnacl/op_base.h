@@ -498,8 +498,9 @@ enum PrimType {
   PrimType_NLLLossGrad = 208,
   PrimType_FormatTranspose = 209,
   PrimType_GatherD = 210,
+  PrimType_ScaledDotProductAttention = 211,
   PrimType_MIN = PrimType_NONE,
-  PrimType_MAX = PrimType_GatherD + 1,
+  PrimType_MAX = PrimType_ScaledDotProductAttention + 1,
 
   // inner operators.
   PrimType_Inner_ToFormat = 10000,
@@ -38,10 +38,13 @@ class RpcRecvKernelMod : public RpcKernelMod {
     }
 
     MS_EXCEPTION_IF_NULL(remote_input_);
+    // The remote data is either read into the buffer registered by the recv actor or into the message body.
+    const char *remote_data = remote_input_->HasExternalData() ? static_cast<const char *>(remote_input_->external_data)
+                                                                : remote_input_->Body().data();
     size_t offset = 0;
     for (size_t i = 0; i < inputs.size(); i++) {
       MS_EXCEPTION_IF_NULL(inputs[i]->addr);
-      int ret = memcpy_s(inputs[i]->addr, inputs[i]->size, remote_input_->Body().data() + offset, inputs[i]->size);
+      int ret = memcpy_s(inputs[i]->addr, inputs[i]->size, remote_data + offset, inputs[i]->size);
       if (ret != 0) {
         MS_LOG(EXCEPTION) << "memcpy_s for recv output failed, ret code: " << ret;
       }
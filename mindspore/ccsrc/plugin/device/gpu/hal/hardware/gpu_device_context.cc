@@ -451,6 +451,9 @@ void GPUDeviceContext::UpdateDynamicShape(const CNodePtr &kernel) const {
   MS_EXCEPTION_IF_NULL(func_graph);
   if (!(func_graph->has_attr(kAttrHasCustomOp) && GetValue<bool>(func_graph->get_attr(kAttrHasCustomOp)))) {
     opt::dynamic_shape::InferOp(kernel);
+    if (opt::dynamic_shape::IsKernelModResized(kernel)) {
+      return;
+    }
     auto args = kernel::GetArgsFromCNode(kernel);
     if (kernel_mod->GetKernelModType() == kernel::KernelModType::NativeGpuKernelMod) {
       auto update = kernel::AbstractArgsFromCNode(kernel);
@@ -464,6 +467,7 @@ void GPUDeviceContext::UpdateDynamicShape(const CNodePtr &kernel) const {
     if (!kernel_mod->Resize(args->op, args->inputs, args->outputs, args->depend_tensor_map)) {
       MS_LOG(EXCEPTION) << "Node " << kernel->fullname_with_scope() << " Resize failed.";
     }
+    opt::dynamic_shape::SetKernelModResized(kernel);
   }
 }
 
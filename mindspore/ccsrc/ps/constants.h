@@ -81,6 +81,7 @@ constexpr int64_t kEmbeddingLookupCmd = 30;
 constexpr int64_t kFinalizeCmd = 40;
 constexpr int64_t kPushCmd = 50;
 constexpr int64_t kPullCmd = 51;
+constexpr int64_t kCompressedPushCmd = 52;
 
 constexpr size_t kInvalidKey = UINT64_MAX;
 constexpr int64_t kInvalidID = -1;
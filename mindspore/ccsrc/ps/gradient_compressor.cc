@@ -0,0 +1,296 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ps/gradient_compressor.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include "base/float16.h"
+#include "utils/log_adapter.h"
+#include "utils/convert_utils_base.h"
+
+namespace mindspore {
+namespace ps {
+namespace {
+constexpr uint32_t kBf16Shift = 16;
+constexpr uint32_t kBf16RoundingBias = 0x7FFF;
+constexpr uint32_t kFloatNanMask = 0x7FFFFFFF;
+constexpr uint32_t kFloatInfValue = 0x7F800000;
+
+template <typename T>
+void AppendData(std::string *buffer, const T *data, size_t num) {
+  if (num == 0) {
+    return;
+  }
+  (void)buffer->append(reinterpret_cast<const char *>(data), num * sizeof(T));
+}
+
+template <typename T>
+bool ReadData(const uint8_t **cursor, const uint8_t *end, T *data, size_t num) {
+  size_t bytes = num * sizeof(T);
+  if (static_cast<size_t>(end - *cursor) < bytes) {
+    MS_LOG(ERROR) << "The binary push message is truncated.";
+    return false;
+  }
+  if (bytes != 0) {
+    (void)std::memcpy(data, *cursor, bytes);
+  }
+  *cursor += bytes;
+  return true;
+}
+}  // namespace
+
+GradCompressType GradientCompressor::GetCompressType(const std::string &compress_type) {
+  if (compress_type == kPushNoCompress) {
+    return GradCompressType::kNoCompress;
+  } else if (compress_type == kPushFp16Compress) {
+    return GradCompressType::kFp16;
+  } else if (compress_type == kPushBf16Compress) {
+    return GradCompressType::kBf16;
+  } else if (compress_type == kPushTopKCompress) {
+    return GradCompressType::kTopK;
+  }
+  MS_LOG(EXCEPTION) << "The push compress type " << compress_type << " is invalid, it should be one of "
+                    << kPushNoCompress << ", " << kPushFp16Compress << ", " << kPushBf16Compress << " and "
+                    << kPushTopKCompress;
+}
+
+bool GradientCompressor::GetCompressGradIndex(const std::string &optim_name, bool is_sparse, size_t *grad_index) {
+  MS_EXCEPTION_IF_NULL(grad_index);
+  if (is_sparse) {
+    return false;
+  }
+  auto optim_iter = kOptimToPSSendIdx.find(optim_name);
+  if (optim_iter == kOptimToPSSendIdx.end()) {
+    return false;
+  }
+  auto grad_iter = optim_iter->second.find("grad");
+  if (grad_iter == optim_iter->second.end() || grad_iter->second == INDEX_NOT_SEND) {
+    return false;
+  }
+  *grad_index = grad_iter->second;
+  return true;
+}
+
+uint16_t GradientCompressor::FloatToBf16(float value) {
+  uint32_t bits = 0;
+  (void)std::memcpy(&bits, &value, sizeof(bits));
+  if ((bits & kFloatNanMask) > kFloatInfValue) {
+    // Keep nan as a quiet nan instead of rounding it to inf.
+    return static_cast<uint16_t>((bits >> kBf16Shift) | 0x40);
+  }
+  // Round to nearest even.
+  uint32_t lsb = (bits >> kBf16Shift) & 1;
+  bits += kBf16RoundingBias + lsb;
+  return static_cast<uint16_t>(bits >> kBf16Shift);
+}
+
+float GradientCompressor::Bf16ToFloat(uint16_t value) {
+  uint32_t bits = static_cast<uint32_t>(value) << kBf16Shift;
+  float result = 0;
+  (void)std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+std::string GradientCompressor::Encode(Key key, const std::vector<float> &values, const std::vector<int> &lens,
+                                       size_t grad_index, GradCompressType type, float topk_ratio,
+                                       std::vector<float> *residual) {
+  if (grad_index >= lens.size()) {
+    MS_LOG(EXCEPTION) << "The gradient index " << grad_index << " is out of range of lens size " << lens.size();
+  }
+  size_t grad_offset = IntToSize(std::accumulate(lens.begin(), lens.begin() + grad_index, 0));
+  size_t grad_len = IntToSize(lens[grad_index]);
+  if (grad_offset + grad_len > values.size()) {
+    MS_LOG(EXCEPTION) << "The gradient of key " << key << " is out of range of values size " << values.size();
+  }
+
+  // Add the error of the last compression back to the gradient.
+  std::vector<float> grad(values.begin() + grad_offset, values.begin() + grad_offset + grad_len);
+  bool lossy = type != GradCompressType::kNoCompress;
+  if (lossy && residual != nullptr) {
+    if (residual->size() != grad_len) {
+      residual->assign(grad_len, 0.0f);
+    }
+    for (size_t i = 0; i < grad_len; i++) {
+      grad[i] += (*residual)[i];
+    }
+  }
+
+  GradCompressHeader header{};
+  header.key = key;
+  header.compress_type = static_cast<uint32_t>(type);
+  header.segment_num = SizeToUint(lens.size());
+  header.grad_index = SizeToUint(grad_index);
+  header.element_num = grad_len;
+  header.payload_num = grad_len;
+  size_t topk = grad_len;
+  if (type == GradCompressType::kTopK) {
+    topk = static_cast<size_t>(std::ceil(static_cast<double>(grad_len) * topk_ratio));
+    topk = std::min(std::max(topk, static_cast<size_t>(1)), grad_len);
+    header.payload_num = topk;
+  }
+
+  size_t other_num = values.size() - grad_len;
+  size_t payload_bytes = grad_len * sizeof(float);
+  if (type == GradCompressType::kFp16 || type == GradCompressType::kBf16) {
+    payload_bytes = grad_len * sizeof(uint16_t);
+  } else if (type == GradCompressType::kTopK) {
+    payload_bytes = topk * (sizeof(uint32_t) + sizeof(float));
+  }
+  std::string buffer;
+  buffer.reserve(sizeof(GradCompressHeader) + lens.size() * sizeof(int) + other_num * sizeof(float) + payload_bytes);
+  AppendData(&buffer, &header, 1);
+  AppendData(&buffer, lens.data(), lens.size());
+  AppendData(&buffer, values.data(), grad_offset);
+  AppendData(&buffer, values.data() + grad_offset + grad_len, values.size() - grad_offset - grad_len);
+
+  switch (type) {
+    case GradCompressType::kFp16: {
+      std::vector<float16> half_grad(grad_len);
+      for (size_t i = 0; i < grad_len; i++) {
+        half_grad[i] = float16(grad[i]);
+        if (residual != nullptr) {
+          (*residual)[i] = grad[i] - static_cast<float>(half_grad[i]);
+        }
+      }
+      AppendData(&buffer, half_grad.data(), grad_len);
+      break;
+    }
+    case GradCompressType::kBf16: {
+      std::vector<uint16_t> bf16_grad(grad_len);
+      for (size_t i = 0; i < grad_len; i++) {
+        bf16_grad[i] = FloatToBf16(grad[i]);
+        if (residual != nullptr) {
+          (*residual)[i] = grad[i] - Bf16ToFloat(bf16_grad[i]);
+        }
+      }
+      AppendData(&buffer, bf16_grad.data(), grad_len);
+      break;
+    }
+    case GradCompressType::kTopK: {
+      std::vector<uint32_t> indices(grad_len);
+      std::iota(indices.begin(), indices.end(), 0);
+      std::nth_element(indices.begin(), indices.begin() + SizeToLong(topk) - 1, indices.end(),
+                       [&grad](uint32_t a, uint32_t b) { return std::fabs(grad[a]) > std::fabs(grad[b]); });
+      indices.resize(topk);
+      std::sort(indices.begin(), indices.end());
+      std::vector<float> topk_values(topk);
+      if (residual != nullptr) {
+        *residual = grad;
+      }
+      for (size_t i = 0; i < topk; i++) {
+        topk_values[i] = grad[indices[i]];
+        if (residual != nullptr) {
+          (*residual)[indices[i]] = 0.0f;
+        }
+      }
+      AppendData(&buffer, indices.data(), topk);
+      AppendData(&buffer, topk_values.data(), topk);
+      break;
+    }
+    default:
+      AppendData(&buffer, grad.data(), grad_len);
+      break;
+  }
+  return buffer;
+}
+
+bool GradientCompressor::Decode(const void *data, size_t size, Keys *keys, Values *values, Lengths *lens) {
+  MS_EXCEPTION_IF_NULL(data);
+  MS_EXCEPTION_IF_NULL(keys);
+  MS_EXCEPTION_IF_NULL(values);
+  MS_EXCEPTION_IF_NULL(lens);
+  const uint8_t *cursor = static_cast<const uint8_t *>(data);
+  const uint8_t *end = cursor + size;
+  GradCompressHeader header{};
+  if (!ReadData(&cursor, end, &header, 1)) {
+    return false;
+  }
+  if (header.grad_index >= header.segment_num || header.payload_num > header.element_num) {
+    MS_LOG(ERROR) << "The header of the binary push message is invalid.";
+    return false;
+  }
+  lens->resize(header.segment_num);
+  if (!ReadData(&cursor, end, lens->data(), lens->size())) {
+    return false;
+  }
+  size_t total_num = IntToSize(std::accumulate(lens->begin(), lens->end(), 0));
+  size_t grad_offset = IntToSize(std::accumulate(lens->begin(), lens->begin() + header.grad_index, 0));
+  if (IntToSize((*lens)[header.grad_index]) != header.element_num || total_num < header.element_num) {
+    MS_LOG(ERROR) << "The lens of the binary push message is invalid.";
+    return false;
+  }
+  keys->assign(1, header.key);
+  values->assign(total_num, 0.0f);
+  float *grad = values->data() + grad_offset;
+  size_t grad_len = header.element_num;
+  if (!ReadData(&cursor, end, values->data(), grad_offset) ||
+      !ReadData(&cursor, end, grad + grad_len, total_num - grad_offset - grad_len)) {
+    return false;
+  }
+
+  auto type = static_cast<GradCompressType>(header.compress_type);
+  switch (type) {
+    case GradCompressType::kFp16: {
+      std::vector<float16> half_grad(grad_len);
+      if (!ReadData(&cursor, end, half_grad.data(), grad_len)) {
+        return false;
+      }
+      for (size_t i = 0; i < grad_len; i++) {
+        grad[i] = static_cast<float>(half_grad[i]);
+      }
+      break;
+    }
+    case GradCompressType::kBf16: {
+      std::vector<uint16_t> bf16_grad(grad_len);
+      if (!ReadData(&cursor, end, bf16_grad.data(), grad_len)) {
+        return false;
+      }
+      for (size_t i = 0; i < grad_len; i++) {
+        grad[i] = Bf16ToFloat(bf16_grad[i]);
+      }
+      break;
+    }
+    case GradCompressType::kTopK: {
+      size_t topk = header.payload_num;
+      std::vector<uint32_t> indices(topk);
+      std::vector<float> topk_values(topk);
+      if (!ReadData(&cursor, end, indices.data(), topk) || !ReadData(&cursor, end, topk_values.data(), topk)) {
+        return false;
+      }
+      for (size_t i = 0; i < topk; i++) {
+        if (indices[i] >= grad_len) {
+          MS_LOG(ERROR) << "The index " << indices[i] << " of the top-k gradient is out of range " << grad_len;
+          return false;
+        }
+        grad[indices[i]] = topk_values[i];
+      }
+      break;
+    }
+    case GradCompressType::kNoCompress:
+      if (!ReadData(&cursor, end, grad, grad_len)) {
+        return false;
+      }
+      break;
+    default:
+      MS_LOG(ERROR) << "The compress type " << header.compress_type << " of the binary push message is invalid.";
+      return false;
+  }
+  return true;
+}
+}  // namespace ps
+}  // namespace mindspore
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PS_GRADIENT_COMPRESSOR_H_
+#define MINDSPORE_CCSRC_PS_GRADIENT_COMPRESSOR_H_
+
+#include <string>
+#include <vector>
+#include "ps/constants.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace ps {
+constexpr char kPushNoCompress[] = "NO_COMPRESS";
+constexpr char kPushFp16Compress[] = "FP16";
+constexpr char kPushBf16Compress[] = "BF16";
+constexpr char kPushTopKCompress[] = "TOP_K";
+
+enum class GradCompressType : uint32_t { kNoCompress = 0, kFp16, kBf16, kTopK };
+
+// The header of the binary push message. The layout of the message is:
+// | GradCompressHeader | int32 lens[segment_num] | float values of the segments before and after the gradient |
+// | compressed gradient |
+// The compressed gradient is element_num fp16/bf16 values for kFp16/kBf16, payload_num uint32 indices followed by
+// payload_num float values for kTopK, and element_num float values for kNoCompress.
+struct GradCompressHeader {
+  uint64_t key;
+  uint32_t compress_type;
+  uint32_t segment_num;
+  uint32_t grad_index;
+  uint32_t reserved;
+  uint64_t element_num;
+  uint64_t payload_num;
+};
+
+// Encode and decode the dense gradients pushed from worker to server in a flat binary format. The lossy compression
+// types keep the compression error in a residual which is added to the gradient of the next push (error feedback).
+class BACKEND_EXPORT GradientCompressor {
+ public:
+  static GradCompressType GetCompressType(const std::string &compress_type);
+
+  // Get the index of the gradient segment in the dense push of the optimizer. Only the dense pushes are compressed, the
+  // sparse ones keep the KVMessage format. Returns false if the push can not be compressed.
+  static bool GetCompressGradIndex(const std::string &optim_name, bool is_sparse, size_t *grad_index);
+
+  // Encode the values of the key into the binary push message. Only the segment grad_index of values is compressed.
+  static std::string Encode(Key key, const std::vector<float> &values, const std::vector<int> &lens,
+                            size_t grad_index, GradCompressType type, float topk_ratio, std::vector<float> *residual);
+
+  // Decode the binary push message, the compressed gradient is restored to dense float values.
+  static bool Decode(const void *data, size_t size, Keys *keys, Values *values, Lengths *lens);
+
+  static uint16_t FloatToBf16(float value);
+  static float Bf16ToFloat(uint16_t value);
+};
+}  // namespace ps
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PS_GRADIENT_COMPRESSOR_H_
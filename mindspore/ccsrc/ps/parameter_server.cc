@@ -66,6 +66,11 @@ bool ParameterServer::Init(const FuncGraphPtr &func_graph) {
   pserver_num_ = std::strtol(mindspore::common::GetEnv(kEnvPServerNum).c_str(), nullptr, kBase);
   worker_num_ = std::strtol(mindspore::common::GetEnv(kEnvWorkerNum).c_str(), nullptr, kBase);
   func_graph_ = func_graph;
+  const std::string &consistency_mode = PSContext::instance()->consistency_mode();
+  uint32_t staleness_threshold = PSContext::instance()->staleness_threshold();
+  push_clock_ = PushClock(consistency_mode, staleness_threshold);
+  MS_LOG(INFO) << "The consistency mode of parameter server is " << consistency_mode << ", staleness threshold is "
+               << staleness_threshold;
   handler_.reset(new ServerHandler(this));
   handler_->Init();
 
@@ -170,6 +175,7 @@ void ParameterServer::InitWeight(const Key &key, const WeightPtr &weight) {
     MS_LOG(INFO) << "Initializing weight for key " << key << ", server rank " << server_node_->rank_id();
     weights_[key] = weight;
     tokens_[key] = 0;
+    push_clock_.InitKey(key, worker_num_);
     is_embedding_[key] = false;
   }
 }
@@ -382,6 +388,7 @@ void ParameterServer::InitEmbeddingTable(
     weights_[key] = embedding;
     MS_LOG(DEBUG) << "The key:" << key << " the embedding:" << *(embedding->MutableData());
     tokens_[key] = 0;
+    push_clock_.InitKey(key, worker_num_);
     is_embedding_[key] = true;
 
     grads_accum_counter_[key] = 0;
@@ -410,8 +417,6 @@ void ParameterServer::UpdateWeights() {
 
     for (auto iter = weights_.begin(); iter != weights_.end(); iter++) {
       Key key = iter->first;
-      WeightPtr weight_ptr = iter->second;
-
       std::shared_ptr<PServerKernel> optimizer = nullptr;
       if (weight_key_to_optims_.count(key) > 0) {
         optimizer = optimizers_[key];
@@ -420,26 +425,11 @@ void ParameterServer::UpdateWeights() {
 
       std::shared_ptr<OptimizerInfo> optim_info = optim_infos_[key];
       if (optim_info != nullptr) {
-        const std::vector<kernel::AddressPtr> &inputs = optim_info->inputs();
-        const std::vector<kernel::AddressPtr> &workspaces = optim_info->workspaces();
-        const std::vector<kernel::AddressPtr> &outputs = optim_info->outputs();
-
-        std::vector<std::vector<size_t>> shapes = {};
-        std::vector<size_t> indices_shape = {};
-        indices_shape.emplace_back(optim_info->indice_size());
-        shapes.push_back(indices_shape);
-
+        InputsShapePtr original_inputs_shape = nullptr;
         if (original_optim_inputs_shape_.count(key) != 0) {
-          std::transform((*(original_optim_inputs_shape_[key])).begin(), (*(original_optim_inputs_shape_[key])).end(),
-                         std::back_inserter(shapes),
-                         [](const std::shared_ptr<std::vector<size_t>> &input_shapes) -> std::vector<size_t> {
-                           return *input_shapes;
-                         });
+          original_inputs_shape = original_optim_inputs_shape_[key];
         }
-        optimizer->ReInit(shapes);
-        optim_info->ComputeMean(shapes, worker_num_, pserver_num_, server_node_->rank_id());
-        optimizer->Execute(inputs, workspaces, outputs);
-        optim_info->Reset();
+        ApplyGrads(key, optimizer, optim_info, original_inputs_shape, worker_num_);
       }
       if (!is_embedding_[key]) {
         tokens_[key] = worker_num_;
@@ -449,7 +439,42 @@ void ParameterServer::UpdateWeights() {
   }
 }
 
-void ParameterServer::AccumGrad(const Keys &keys, const Values &values, const Lengths &lengths) {
+void ParameterServer::ApplyGrads(const Key &key, const std::shared_ptr<PServerKernel> &optimizer,
+                                 const std::shared_ptr<OptimizerInfo> &optim_info,
+                                 const InputsShapePtr &original_inputs_shape, size_t grad_num) {
+  MS_EXCEPTION_IF_NULL(optimizer);
+  MS_EXCEPTION_IF_NULL(optim_info);
+  const std::vector<kernel::AddressPtr> &inputs = optim_info->inputs();
+  const std::vector<kernel::AddressPtr> &workspaces = optim_info->workspaces();
+  const std::vector<kernel::AddressPtr> &outputs = optim_info->outputs();
+
+  std::vector<std::vector<size_t>> shapes = {};
+  std::vector<size_t> indices_shape = {};
+  indices_shape.emplace_back(optim_info->indice_size());
+  shapes.push_back(indices_shape);
+
+  if (original_inputs_shape != nullptr) {
+    std::transform(original_inputs_shape->begin(), original_inputs_shape->end(), std::back_inserter(shapes),
+                   [](const std::shared_ptr<std::vector<size_t>> &input_shapes) -> std::vector<size_t> {
+                     return *input_shapes;
+                   });
+  }
+  optimizer->ReInit(shapes);
+  optim_info->ComputeMean(shapes, grad_num, pserver_num_, server_node_->rank_id());
+  optimizer->Execute(inputs, workspaces, outputs);
+  optim_info->Reset();
+}
+
+void ParameterServer::AccumGrad(const Keys &keys, const Values &values, const Lengths &lengths, uint32_t rank_id) {
+  if (!IsSyncMode()) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      push_clock_.Tick(keys[0], rank_id);
+    }
+    AccumAndApplyGrad(keys, values, lengths);
+    return;
+  }
+
   std::unique_lock<std::mutex> lock(mutex_);
   const Key &key = keys[0];
   bool no_sparse_grad = values.size() == 1 && values[0] == kGradValue;
@@ -483,6 +508,44 @@ void ParameterServer::AccumGrad(const Keys &keys, const Values &values, const Le
   }
 }
 
+void ParameterServer::AccumAndApplyGrad(const Keys &keys, const Values &values, const Lengths &lengths) {
+  const Key &key = keys[0];
+  bool no_sparse_grad = values.size() == 1 && values[0] == kGradValue;
+  if (no_sparse_grad) {
+    return;
+  }
+  // Lock order: weight mutex of the key first, then mutex_ only for accessing the maps.
+  std::unique_lock<std::mutex> weight_lock(weight_mutex(key));
+  std::shared_ptr<kernel::ps::PServerKernel> optimizer = nullptr;
+  std::shared_ptr<OptimizerInfo> optim_info = nullptr;
+  InputsShapePtr original_inputs_shape = nullptr;
+  bool created = false;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    optimizer = optimizers_[key];
+    if (optimizer == nullptr) {
+      MS_LOG(EXCEPTION) << "no optimizer found for key " << key << " optim name " << weight_key_to_optims_[key];
+    }
+    if (original_optim_inputs_shape_.count(key) != 0) {
+      original_inputs_shape = original_optim_inputs_shape_[key];
+    }
+    optim_info = optim_infos_[key];
+    if (optim_info == nullptr) {
+      const std::shared_ptr<OptimizerInfoBuilder> &builder = optim_info_builders_[weight_key_to_optims_[key]];
+      OptimizerInfo *optim = builder->Build(optimizer, weights_[key], keys, values, lengths, optim_inputs_shape_[key],
+                                            worker_num_, is_embedding_[key]);
+      optim_info.reset(optim);
+      optim_infos_[key] = optim_info;
+      created = true;
+    }
+  }
+  if (!created) {
+    optim_info->Update(values, lengths);
+    optim_info->Accumulate(values, lengths);
+  }
+  ApplyGrads(key, optimizer, optim_info, original_inputs_shape, 1);
+}
+
 WeightPtr ParameterServer::weight(const Key &key) {
   std::unique_lock<std::mutex> lock(mutex_);
   if (weights_.count(key) == 0) {
@@ -490,10 +553,23 @@ WeightPtr ParameterServer::weight(const Key &key) {
   }
   WeightPtr weight_ptr = weights_[key];
   MS_EXCEPTION_IF_NULL(weight_ptr);
-  tokens_[key] -= 1;
+  // The tokens are only used to block the pulls until the weights are updated in SYNC mode.
+  if (IsSyncMode()) {
+    tokens_[key] -= 1;
+  }
   return weight_ptr;
 }
 
+void ParameterServer::PullWeight(const Key &key, KVMessage *res) {
+  MS_EXCEPTION_IF_NULL(res);
+  // Lock order: weight mutex of the key first, then mutex_ in weight(), the same as AccumAndApplyGrad.
+  std::unique_lock<std::mutex> weight_lock(weight_mutex(key));
+  WeightPtr weight_ptr = weight(key);
+  auto weight_data = weight_ptr->MutableData();
+  MS_EXCEPTION_IF_NULL(weight_data);
+  *res->mutable_values() = {weight_data->begin(), weight_data->end()};
+}
+
 void ParameterServer::DoEmbeddingLookup(Key key, const LookupIds &lookup_ids, KVMessage *res) {
   if (EnableRecovery()) {
     while (!finish_recovery_) {
@@ -501,6 +577,7 @@ void ParameterServer::DoEmbeddingLookup(Key key, const LookupIds &lookup_ids, KV
     }
   }
 
+  std::unique_lock<std::mutex> weight_lock(weight_mutex(key));
   std::unique_lock<std::mutex> lock(mutex_);
   MS_EXCEPTION_IF_NULL(res);
   if (weights_.count(key) == 0) {
@@ -605,12 +682,15 @@ inline bool ParameterServer::ReadyForUpdateWeights() const {
   return grads_accum_counter_.size() > 0 && grad_accum_count_ == grads_accum_counter_.size();
 }
 
-inline bool ParameterServer::ReadyForPush(const Key &key) {
+inline bool ParameterServer::ReadyForPush(const Key &key, uint32_t rank_id) {
   std::unique_lock<std::mutex> lock(mutex_);
   if (weights_.empty()) {
     MS_LOG(EXCEPTION) << "The weights in server is empty. Many reasons could cause this: 1.The Worker didn't send "
                          "kInitWeightsCmd command. 2.The Server failed to initialize weights.";
   }
+  if (!IsSyncMode()) {
+    return push_clock_.ReadyForPush(key, rank_id);
+  }
   return grad_accum_count_ < weights_.size() && tokens_[key] == 0;
 }
 
@@ -619,6 +699,9 @@ inline bool ParameterServer::ReadyForPull(const Key &key) {
   if (tokens_.count(key) == 0 || weights_[key] == 0) {
     MS_LOG(EXCEPTION) << "Invalid weight key " << key;
   }
+  if (!IsSyncMode()) {
+    return true;
+  }
   MS_LOG(INFO) << "ReadyForPull: " << (tokens_[key] > 0);
   return tokens_[key] > 0;
 }
@@ -644,6 +727,12 @@ const CNodePtr ParameterServer::GetCNode(const std::string &name) const {
 
 inline std::mutex &ParameterServer::mutex() { return mutex_; }
 
+inline std::mutex &ParameterServer::weight_mutex(const Key &key) {
+  return weight_mutexes_[key % kWeightMutexStripeNum];
+}
+
+inline bool ParameterServer::IsSyncMode() const { return push_clock_.IsSyncMode(); }
+
 void ParameterServer::GetEmbeddingTableParamPtr() {
   if (ps::PsDataPrefetch::GetInstance().cache_enable()) {
     return;
@@ -883,6 +972,7 @@ void ParameterServer::ServerHandler::Init() {
   handlers_[kUpdateEmbeddingsCmd] = &ServerHandler::HandleUpdateEmbeddings;
   handlers_[kFinalizeCmd] = &ServerHandler::HandleFinalize;
   handlers_[kPushCmd] = &ServerHandler::HandlePushReq;
+  handlers_[kCompressedPushCmd] = &ServerHandler::HandleCompressedPushReq;
   handlers_[kPullCmd] = &ServerHandler::HandlePullReq;
   commands_[kInitWeightsCmd] = "kInitWeightsCmd";
   commands_[kInitWeightToOptimIdCmd] = "kInitWeightToOptimIdCmd";
@@ -894,6 +984,7 @@ void ParameterServer::ServerHandler::Init() {
   commands_[kUpdateEmbeddingsCmd] = "kUpdateEmbeddingsCmd";
   commands_[kFinalizeCmd] = "kFinalizeCmd";
   commands_[kPushCmd] = "kPushCmd";
+  commands_[kCompressedPushCmd] = "kCompressedPushCmd";
   commands_[kPullCmd] = "kPullCmd";
 }
 
@@ -908,7 +999,7 @@ void ParameterServer::ServerHandler::operator()(const std::shared_ptr<core::TcpC
   MS_LOG(INFO) << "The command is:" << commands_[meta->user_cmd()];
 
   auto &handler_ptr = handlers_[meta->user_cmd()];
-  (this->*handler_ptr)(data, size, output);
+  (this->*handler_ptr)(data, size, output, meta->rank_id());
   MS_LOG(DEBUG) << "The output size is:" << output->size();
 
   if (output->size() > 0) {
@@ -925,7 +1016,8 @@ void ParameterServer::ServerHandler::operator()(const std::shared_ptr<core::TcpC
                      .count();
 }
 
-void ParameterServer::ServerHandler::HandlePushReq(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandlePushReq(const void *data, size_t size, const VectorPtr &res,
+                                                   uint32_t rank_id) {
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
@@ -934,10 +1026,24 @@ void ParameterServer::ServerHandler::HandlePushReq(const void *data, size_t size
   Values values = {input.values().begin(), input.values().end()};
   Lengths lens = {input.len().begin(), input.len().end()};
   MS_LOG(DEBUG) << "The keys:" << keys << " the values:" << values << " the len:" << lens;
-  ps_->AccumGrad(keys, values, lens);
+  ps_->AccumGrad(keys, values, lens, rank_id);
 }
 
-void ParameterServer::ServerHandler::HandlePullReq(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleCompressedPushReq(const void *data, size_t size, const VectorPtr &res,
+                                                             uint32_t rank_id) {
+  MS_EXCEPTION_IF_NULL(data);
+  MS_EXCEPTION_IF_NULL(res);
+  Keys keys;
+  Values values;
+  Lengths lens;
+  if (!GradientCompressor::Decode(data, size, &keys, &values, &lens)) {
+    MS_LOG(EXCEPTION) << "Decode the compressed push message failed.";
+  }
+  MS_LOG(DEBUG) << "The keys:" << keys << " the len:" << lens;
+  ps_->AccumGrad(keys, values, lens, rank_id);
+}
+
+void ParameterServer::ServerHandler::HandlePullReq(const void *data, size_t size, const VectorPtr &res, uint32_t) {
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
@@ -945,10 +1051,7 @@ void ParameterServer::ServerHandler::HandlePullReq(const void *data, size_t size
   KVMessage res_data;
   *res_data.mutable_keys() = input.keys();
   Key key = input.keys()[0];
-  auto weight = ps_->weight(key);
-  auto weight_data = weight->MutableData();
-  MS_EXCEPTION_IF_NULL(weight_data);
-  *res_data.mutable_values() = {weight_data->begin(), weight_data->end()};
+  ps_->PullWeight(key, &res_data);
   res->resize(res_data.ByteSizeLong());
   size_t dest_size = res_data.ByteSizeLong();
   size_t src_size = res_data.ByteSizeLong();
@@ -958,7 +1061,7 @@ void ParameterServer::ServerHandler::HandlePullReq(const void *data, size_t size
   }
 }
 
-void ParameterServer::ServerHandler::HandleInitWeights(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleInitWeights(const void *data, size_t size, const VectorPtr &res, uint32_t) {
   std::unique_lock<std::mutex> lock(ps_->mutex());
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
@@ -985,7 +1088,8 @@ void ParameterServer::ServerHandler::HandleInitWeights(const void *data, size_t
   }
 }
 
-void ParameterServer::ServerHandler::HandleInitWeightToOptimId(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleInitWeightToOptimId(const void *data, size_t size, const VectorPtr &res,
+                                                               uint32_t) {
   std::unique_lock<std::mutex> lock(ps_->mutex());
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
@@ -1004,7 +1108,8 @@ void ParameterServer::ServerHandler::HandleInitWeightToOptimId(const void *data,
   }
 }
 
-void ParameterServer::ServerHandler::HandleInitInputsShape(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleInitInputsShape(const void *data, size_t size, const VectorPtr &res,
+                                                           uint32_t) {
   std::unique_lock<std::mutex> lock(ps_->mutex());
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
@@ -1022,7 +1127,7 @@ void ParameterServer::ServerHandler::HandleInitInputsShape(const void *data, siz
   ps_->InitOptimInputsShape(keys, values, lens);
 }
 
-void ParameterServer::ServerHandler::HandleInitEmbeddings(const void *data, size_t size, const VectorPtr &) {
+void ParameterServer::ServerHandler::HandleInitEmbeddings(const void *data, size_t size, const VectorPtr &, uint32_t) {
   std::unique_lock<std::mutex> lock(ps_->mutex());
   MS_EXCEPTION_IF_NULL(data);
   EmbeddingTableMeta embedding_table_meta;
@@ -1060,13 +1165,14 @@ void ParameterServer::ServerHandler::HandleInitEmbeddings(const void *data, size
   ps_->InitEmbeddingTable(key, shapes, param_init_info);
 }
 
-void ParameterServer::ServerHandler::HandleCheckReadyForPush(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleCheckReadyForPush(const void *data, size_t size, const VectorPtr &res,
+                                                             uint32_t rank_id) {
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
   CHECK_RETURN_TYPE(input.ParseFromArray(data, SizeToInt(size)));
   const Key &key = input.keys()[0];
-  bool ready = ps_->ReadyForPush(key);
+  bool ready = ps_->ReadyForPush(key, rank_id);
   MS_LOG(INFO) << "The ready is:" << ready;
   KVMessage res_data;
   res_data.add_keys(key);
@@ -1080,7 +1186,8 @@ void ParameterServer::ServerHandler::HandleCheckReadyForPush(const void *data, s
   }
 }
 
-void ParameterServer::ServerHandler::HandleCheckReadyForPull(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleCheckReadyForPull(const void *data, size_t size, const VectorPtr &res,
+                                                             uint32_t) {
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   KVMessage input;
@@ -1099,7 +1206,8 @@ void ParameterServer::ServerHandler::HandleCheckReadyForPull(const void *data, s
   }
 }
 
-void ParameterServer::ServerHandler::HandleEmbeddingLookup(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleEmbeddingLookup(const void *data, size_t size, const VectorPtr &res,
+                                                           uint32_t) {
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
   EmbeddingTableLookup input;
@@ -1121,7 +1229,8 @@ void ParameterServer::ServerHandler::HandleEmbeddingLookup(const void *data, siz
   }
 }
 
-void ParameterServer::ServerHandler::HandleUpdateEmbeddings(const void *data, size_t size, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleUpdateEmbeddings(const void *data, size_t size, const VectorPtr &res,
+                                                            uint32_t) {
   std::unique_lock<std::mutex> lock(ps_->mutex());
   MS_EXCEPTION_IF_NULL(data);
   MS_EXCEPTION_IF_NULL(res);
@@ -1133,7 +1242,7 @@ void ParameterServer::ServerHandler::HandleUpdateEmbeddings(const void *data, si
   ps_->UpdateEmbeddings(key, lookup_ids, update_vals);
 }
 
-void ParameterServer::ServerHandler::HandleFinalize(const void *, size_t, const VectorPtr &res) {
+void ParameterServer::ServerHandler::HandleFinalize(const void *, size_t, const VectorPtr &res, uint32_t) {
   MS_EXCEPTION_IF_NULL(res);
   ps_->Finalize();
 }
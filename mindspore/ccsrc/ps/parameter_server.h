@@ -32,6 +32,7 @@
 #include <map>
 #include <functional>
 #include <algorithm>
+#include <array>
 
 #include "utils/hash_map.h"
 #include "ir/func_graph.h"
@@ -58,6 +59,8 @@
 #include "ps/constants.h"
 #include "ps/util.h"
 #include "ps/embedding_table_shard_metadata.h"
+#include "ps/gradient_compressor.h"
+#include "ps/push_clock.h"
 #include "utils/log_adapter.h"
 #include "proto/comm.pb.h"
 #include "proto/ps.pb.h"
@@ -67,6 +70,8 @@
 
 namespace mindspore {
 namespace ps {
+constexpr size_t kWeightMutexStripeNum = 64;
+
 class BACKEND_EXPORT ParameterServer {
  public:
   static ParameterServer &GetInstance();
@@ -95,21 +100,24 @@ class BACKEND_EXPORT ParameterServer {
     void Init();
     void operator()(const std::shared_ptr<core::TcpConnection> &conn, const std::shared_ptr<core::MessageMeta> &meta,
                     const void *data, size_t size);
-    void HandlePushReq(const void *data, size_t size, const VectorPtr &res);
-    void HandlePullReq(const void *data, size_t size, const VectorPtr &res);
-    void HandleInitWeights(const void *data, size_t size, const VectorPtr &res);
-    void HandleInitWeightToOptimId(const void *data, size_t size, const VectorPtr &res);
-    void HandleInitInputsShape(const void *data, size_t size, const VectorPtr &res);
-    void HandleInitEmbeddings(const void *data, size_t size, const VectorPtr &res);
-    void HandleCheckReadyForPush(const void *data, size_t size, const VectorPtr &res);
-    void HandleCheckReadyForPull(const void *data, size_t size, const VectorPtr &res);
-    void HandleEmbeddingLookup(const void *data, size_t size, const VectorPtr &res);
-    void HandleUpdateEmbeddings(const void *data, size_t size, const VectorPtr &res);
-    void HandleFinalize(const void *data, size_t size, const VectorPtr &res);
+    void HandlePushReq(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandleCompressedPushReq(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandlePullReq(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandleInitWeights(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandleInitWeightToOptimId(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandleInitInputsShape(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandleInitEmbeddings(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandleCheckReadyForPush(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandleCheckReadyForPull(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandleEmbeddingLookup(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandleUpdateEmbeddings(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
+    void HandleFinalize(const void *data, size_t size, const VectorPtr &res, uint32_t rank_id);
 
    private:
     ParameterServer *ps_;
-    typedef void (ServerHandler::*RequestHandler)(const void *data, size_t size, const VectorPtr &res);
+    // The rank_id is the rank of the worker which sends the request.
+    typedef void (ServerHandler::*RequestHandler)(const void *data, size_t size, const VectorPtr &res,
+                                                  uint32_t rank_id);
     mindspore::HashMap<int, RequestHandler> handlers_;
     mindspore::HashMap<int, std::string> commands_;
     mindspore::HashMap<Key, bool> init_weights_;
@@ -154,12 +162,26 @@ class BACKEND_EXPORT ParameterServer {
   bool HasWeight(const Key &key);
   void Finalize();
   void UpdateWeights();
-  void AccumGrad(const Keys &key, const Values &values, const Lengths &lengths);
+  // Run the optimizer of the key with the gradients accumulated in optim_info, grad_num is the number of the
+  // accumulated gradients which is used to compute the mean.
+  void ApplyGrads(const Key &key, const std::shared_ptr<PServerKernel> &optimizer,
+                  const std::shared_ptr<OptimizerInfo> &optim_info, const InputsShapePtr &original_inputs_shape,
+                  size_t grad_num);
+  void AccumGrad(const Keys &key, const Values &values, const Lengths &lengths, uint32_t rank_id);
+  // In STALE_SYNC and ASYNC mode the gradients pushed by each worker are applied immediately instead of waiting for
+  // all the workers.
+  void AccumAndApplyGrad(const Keys &keys, const Values &values, const Lengths &lengths);
   WeightPtr weight(const Key &key);
+  // Copy the weight into the pull response under the weight mutex of the key, so that it's not half updated by an
+  // asynchronous push.
+  void PullWeight(const Key &key, KVMessage *res);
+  // The weights are guarded by striped mutexes so that pushes and pulls on different keys do not block each other.
+  inline std::mutex &weight_mutex(const Key &key);
+  inline bool IsSyncMode() const;
   void DoEmbeddingLookup(Key key, const LookupIds &lookup_ids, KVMessage *res);
   void UpdateEmbeddings(const Key &key, const LookupIds &lookup_ids, const Values &vals);
   inline bool ReadyForUpdateWeights() const;
-  inline bool ReadyForPush(const Key &key);
+  inline bool ReadyForPush(const Key &key, uint32_t rank_id);
   inline bool ReadyForPull(const Key &key);
   inline void ResetGradAccumCount();
   const CNodePtr GetCNode(const std::string &name) const;
@@ -228,8 +250,12 @@ class BACKEND_EXPORT ParameterServer {
   mindspore::HashMap<Key, size_t> grads_accum_counter_;
   mindspore::HashMap<Key, std::shared_ptr<PServerKernel>> embedding_lookup_ops_;
   mindspore::HashMap<Key, uint64_t> tokens_;
+  // The pushes of each key from each worker, used to bound the staleness in STALE_SYNC mode. It's accessed under
+  // mutex_.
+  PushClock push_clock_;
 
   std::mutex mutex_;
+  std::array<std::mutex, kWeightMutexStripeNum> weight_mutexes_;
   std::condition_variable apply_grads_cv_;
 
   std::mutex access_weight_mutex_;
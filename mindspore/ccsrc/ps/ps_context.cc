@@ -15,6 +15,7 @@
  */
 
 #include "ps/ps_context.h"
+#include "ps/gradient_compressor.h"
 #include "utils/log_adapter.h"
 #include "utils/ms_utils.h"
 #include "kernel/kernel.h"
@@ -566,5 +567,36 @@ std::string PSContext::download_compress_type() const { return download_compress
 std::string PSContext::checkpoint_dir() const { return checkpoint_dir_; }
 
 void PSContext::set_checkpoint_dir(const std::string &checkpoint_dir) { checkpoint_dir_ = checkpoint_dir; }
+
+void PSContext::set_consistency_mode(const std::string &consistency_mode) {
+  if (consistency_mode != kSyncConsistencyMode && consistency_mode != kStaleSyncConsistencyMode &&
+      consistency_mode != kAsyncConsistencyMode) {
+    MS_LOG(EXCEPTION) << "The consistency mode " << consistency_mode << " is invalid. It should be one of "
+                      << kSyncConsistencyMode << ", " << kStaleSyncConsistencyMode << " and " << kAsyncConsistencyMode;
+  }
+  consistency_mode_ = consistency_mode;
+}
+
+const std::string &PSContext::consistency_mode() const { return consistency_mode_; }
+
+void PSContext::set_staleness_threshold(uint32_t staleness_threshold) { staleness_threshold_ = staleness_threshold; }
+
+uint32_t PSContext::staleness_threshold() const { return staleness_threshold_; }
+
+void PSContext::set_push_compress_type(const std::string &push_compress_type) {
+  (void)GradientCompressor::GetCompressType(push_compress_type);
+  push_compress_type_ = push_compress_type;
+}
+
+const std::string &PSContext::push_compress_type() const { return push_compress_type_; }
+
+void PSContext::set_push_topk_ratio(float push_topk_ratio) {
+  if (push_topk_ratio <= 0.0f || push_topk_ratio > 1.0f) {
+    MS_LOG(EXCEPTION) << "The push_topk_ratio must be in range (0, 1], but got " << push_topk_ratio;
+  }
+  push_topk_ratio_ = push_topk_ratio;
+}
+
+float PSContext::push_topk_ratio() const { return push_topk_ratio_; }
 }  // namespace ps
 }  // namespace mindspore
@@ -42,6 +42,9 @@ constexpr char kStablePWEncryptType[] = "STABLE_PW_ENCRYPT";
 constexpr char kNotEncryptType[] = "NOT_ENCRYPT";
 constexpr char kDSEncryptType[] = "SIGNDS";
 constexpr char kNoCompressType[] = "NO_COMPRESS";
+constexpr char kSyncConsistencyMode[] = "SYNC";
+constexpr char kStaleSyncConsistencyMode[] = "STALE_SYNC";
+constexpr char kAsyncConsistencyMode[] = "ASYNC";
 
 // Use binary data to represent federated learning server's context so that we can judge which round resets the
 // iteration. From right to left, each bit stands for:
@@ -244,6 +247,18 @@ class BACKEND_EXPORT PSContext {
   std::string checkpoint_dir() const;
   void set_checkpoint_dir(const std::string &checkpoint_dir);
 
+  void set_consistency_mode(const std::string &consistency_mode);
+  const std::string &consistency_mode() const;
+
+  void set_staleness_threshold(uint32_t staleness_threshold);
+  uint32_t staleness_threshold() const;
+
+  void set_push_compress_type(const std::string &push_compress_type);
+  const std::string &push_compress_type() const;
+
+  void set_push_topk_ratio(float push_topk_ratio);
+  float push_topk_ratio() const;
+
  private:
   PSContext()
       : ps_enabled_(false),
@@ -300,7 +315,11 @@ class BACKEND_EXPORT PSContext {
         upload_compress_type_(kNoCompressType),
         upload_sparse_rate_(0.4f),
         download_compress_type_(kNoCompressType),
-        checkpoint_dir_("") {}
+        checkpoint_dir_(""),
+        consistency_mode_(kSyncConsistencyMode),
+        staleness_threshold_(0),
+        push_compress_type_(kNoCompressType),
+        push_topk_ratio_(0.01f) {}
   bool ps_enabled_;
   bool is_worker_;
   bool is_pserver_;
@@ -442,6 +461,16 @@ class BACKEND_EXPORT PSContext {
 
   // directory of server checkpoint
   std::string checkpoint_dir_;
+
+  // The consistency mode of parameter server training, which could be SYNC, STALE_SYNC and ASYNC.
+  std::string consistency_mode_;
+  // The max number of steps that the fastest worker could be ahead of the slowest one in STALE_SYNC mode.
+  uint32_t staleness_threshold_;
+
+  // The compress type of the dense gradients pushed from workers to parameter servers.
+  std::string push_compress_type_;
+  // The ratio of the gradient elements which are pushed when the compress type is TOP_K.
+  float push_topk_ratio_;
 };
 }  // namespace ps
 }  // namespace mindspore
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ps/push_clock.h"
+#include <algorithm>
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace ps {
+PushClock::PushClock(const std::string &consistency_mode, uint32_t staleness_threshold)
+    : consistency_mode_(consistency_mode), staleness_threshold_(staleness_threshold) {
+  if (consistency_mode_ != kSyncConsistencyMode && consistency_mode_ != kStaleSyncConsistencyMode &&
+      consistency_mode_ != kAsyncConsistencyMode) {
+    MS_LOG(EXCEPTION) << "Invalid consistency mode " << consistency_mode_;
+  }
+}
+
+bool PushClock::IsSyncMode() const { return consistency_mode_ == kSyncConsistencyMode; }
+
+void PushClock::InitKey(const Key &key, size_t worker_num) {
+  worker_clocks_[key] = std::vector<uint64_t>(worker_num, 0);
+}
+
+bool PushClock::ReadyForPush(const Key &key, uint32_t rank_id) const {
+  if (consistency_mode_ != kStaleSyncConsistencyMode) {
+    return true;
+  }
+  const std::vector<uint64_t> &clocks = worker_clocks(key, rank_id);
+  uint64_t min_clock = *std::min_element(clocks.begin(), clocks.end());
+  return clocks[rank_id] <= min_clock + staleness_threshold_;
+}
+
+void PushClock::Tick(const Key &key, uint32_t rank_id) {
+  (void)worker_clocks(key, rank_id);
+  worker_clocks_[key][rank_id] += 1;
+}
+
+uint64_t PushClock::clock(const Key &key, uint32_t rank_id) const { return worker_clocks(key, rank_id)[rank_id]; }
+
+const std::vector<uint64_t> &PushClock::worker_clocks(const Key &key, uint32_t rank_id) const {
+  auto iter = worker_clocks_.find(key);
+  if (iter == worker_clocks_.end() || rank_id >= iter->second.size()) {
+    MS_LOG(EXCEPTION) << "Invalid push for key " << key << " from worker " << rank_id;
+  }
+  return iter->second;
+}
+}  // namespace ps
+}  // namespace mindspore
@@ -0,0 +1,55 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PS_PUSH_CLOCK_H_
+#define MINDSPORE_CCSRC_PS_PUSH_CLOCK_H_
+
+#include <string>
+#include <vector>
+#include "utils/hash_map.h"
+#include "ps/constants.h"
+#include "ps/ps_context.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace ps {
+// Counts the pushes of each worker on each key, and decides whether a worker could push a key in STALE_SYNC and ASYNC
+// mode. In SYNC mode the parameter server blocks the pushes by its tokens instead. It's not thread safe, the parameter
+// server accesses it under its mutex.
+class BACKEND_EXPORT PushClock {
+ public:
+  PushClock() = default;
+  PushClock(const std::string &consistency_mode, uint32_t staleness_threshold);
+  ~PushClock() = default;
+
+  bool IsSyncMode() const;
+  void InitKey(const Key &key, size_t worker_num);
+  // In STALE_SYNC mode the fastest worker could not be ahead of the slowest one by more than staleness_threshold
+  // pushes, in ASYNC mode the workers are never blocked.
+  bool ReadyForPush(const Key &key, uint32_t rank_id) const;
+  void Tick(const Key &key, uint32_t rank_id);
+  uint64_t clock(const Key &key, uint32_t rank_id) const;
+
+ private:
+  const std::vector<uint64_t> &worker_clocks(const Key &key, uint32_t rank_id) const;
+
+  std::string consistency_mode_{kSyncConsistencyMode};
+  uint32_t staleness_threshold_{0};
+  mindspore::HashMap<Key, std::vector<uint64_t>> worker_clocks_;
+};
+}  // namespace ps
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PS_PUSH_CLOCK_H_
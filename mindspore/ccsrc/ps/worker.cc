@@ -114,7 +114,21 @@ void Worker::Push(const std::vector<size_t> &keys, std::vector<uintptr_t> addrs,
   std::vector<int> sizes_int;
   (void)std::transform(sizes.begin(), sizes.end(), std::back_inserter(sizes_int),
                        [](const int64_t &value) { return static_cast<int>(value); });
-  if (!is_sparse) {
+  GradCompressType compress_type = GetKeyCompressType(key);
+  size_t compress_grad_index = 0;
+  bool compress_push = compress_type != GradCompressType::kNoCompress && keys.size() == 1 &&
+                       embedding_table_ranges_.count(key) == 0 &&
+                       GradientCompressor::GetCompressGradIndex(Util::optimizer_name(optim_id), is_sparse,
+                                                                &compress_grad_index);
+  bool warn_uncompressed = compress_type != GradCompressType::kNoCompress && !compress_push;
+  if (warn_uncompressed && compress_unsupported_keys_.insert(key).second) {
+    MS_LOG(WARNING) << "The gradient of key " << key << " with optimizer " << Util::optimizer_name(optim_id)
+                    << " is pushed without compression, because only the dense gradients of a single key are "
+                       "compressed.";
+  }
+  if (!is_sparse && compress_push) {
+    PushCompressedData(key, total_buffer, sizes_int, compress_grad_index, compress_type);
+  } else if (!is_sparse) {
     PushData(std::vector<Key>(keys), total_buffer, std::vector<int>(sizes_int), kPushCmd);
   } else {
     std::vector<int64_t> &var_shape = key_to_optim_shapes_[key][0];
@@ -192,6 +206,19 @@ void Worker::SetOptimInputShapes(size_t key, const ShapeVector &shape) {
   }
 }
 
+void Worker::SetKeyCompressType(size_t key, const std::string &compress_type) {
+  MS_LOG(INFO) << "SetKeyCompressType key is:" << key << " compress_type:" << compress_type;
+  key_to_compress_type_[key] = GradientCompressor::GetCompressType(compress_type);
+}
+
+GradCompressType Worker::GetKeyCompressType(const Key &key) const {
+  auto iter = key_to_compress_type_.find(key);
+  if (iter != key_to_compress_type_.end()) {
+    return iter->second;
+  }
+  return GradientCompressor::GetCompressType(PSContext::instance()->push_compress_type());
+}
+
 void Worker::AddEmbeddingTable(const Key &key, const size_t &row_count) {
   bool has_init = IsKeyInit(key);
   if (has_init) {
@@ -645,6 +672,18 @@ void Worker::PushData(const std::vector<Key> &keys, const std::vector<float> &va
   }
 }
 
+void Worker::PushCompressedData(const Key &key, const std::vector<float> &vals, const std::vector<int> &lens,
+                                size_t grad_index, GradCompressType compress_type) {
+  if (key_to_server_id_.count(key) == 0) {
+    MS_LOG(EXCEPTION) << "No server found for key " << key;
+  }
+  std::vector<uint32_t> rank_ids = {static_cast<uint32_t>(key_to_server_id_[key])};
+  std::vector<std::string> data_strs;
+  data_strs.emplace_back(GradientCompressor::Encode(key, vals, lens, grad_index, compress_type,
+                                                    PSContext::instance()->push_topk_ratio(), &grad_residuals_[key]));
+  worker_node_.Send(core::NodeRole::SERVER, rank_ids, data_strs, kCompressedPushCmd);
+}
+
 void Worker::PushSparseData(const std::vector<Key> &keys, const std::vector<float> &vals, const std::vector<int> &lens,
                             size_t grad_index, size_t indice_index, size_t first_dim_size, size_t outer_dim_size) {
   KVMessage kvs;
@@ -37,6 +37,7 @@
 #include "ps/ps_cache/ps_data/ps_data_prefetch.h"
 #include "ps/core/ps_worker_node.h"
 #include "ps/embedding_table_shard_metadata.h"
+#include "ps/gradient_compressor.h"
 #include "proto/comm.pb.h"
 #include "proto/ps.pb.h"
 #include "ps/ps_context.h"
@@ -65,6 +66,8 @@ class BACKEND_EXPORT Worker {
   bool GetParamInitInServer(const std::string &param_name);
   void SetKeyOptimId(size_t key, const std::string &optimizer_name);
   void SetOptimInputShapes(size_t key, const ShapeVector &shape);
+  // Set the compress type of the dense gradient pushed for the key, which overrides the push_compress_type in context.
+  void SetKeyCompressType(size_t key, const std::string &compress_type);
   void AddEmbeddingTable(const Key &key, const size_t &row_count);
   bool InitPSEmbeddingTable(const size_t &key, const std::vector<size_t> &input_shape,
                             const std::vector<size_t> &indices_shape, const std::vector<size_t> &output_shape,
@@ -101,6 +104,10 @@ class BACKEND_EXPORT Worker {
 
   void PushData(const std::vector<Key> &keys, const std::vector<float> &vals, const std::vector<int> &lens = {},
                 int command = 0, int64_t priority = 0);
+  // Push the dense gradient in the binary format with the gradient segment compressed.
+  void PushCompressedData(const Key &key, const std::vector<float> &vals, const std::vector<int> &lens,
+                          size_t grad_index, GradCompressType compress_type);
+  GradCompressType GetKeyCompressType(const Key &key) const;
   void PushSparseData(const std::vector<Key> &keys, const std::vector<float> &vals, const std::vector<int> &lens,
                       size_t grad_index, size_t indice_index, size_t first_dim_size, size_t outer_dim_size);
   void PullData(const std::vector<Key> &keys, std::vector<float> *const vals, std::vector<int> *lens = nullptr,
@@ -133,6 +140,11 @@ class BACKEND_EXPORT Worker {
   std::map<size_t, int64_t> key_to_optimId_;
   std::map<size_t, std::vector<ShapeVector>> key_to_optim_shapes_;
   std::map<std::string, bool> param_to_init_in_server_;
+  std::map<size_t, GradCompressType> key_to_compress_type_;
+  // The keys whose pushes can not be compressed and have been warned about.
+  mindspore::HashSet<Key> compress_unsupported_keys_;
+  // The compression error of each key which is added to the gradient of the next push.
+  mindspore::HashMap<Key, std::vector<float>> grad_residuals_;
   core::PSWorkerNode worker_node_;
 
   EmbeddingPartitioner lookup_partitioner_;
@@ -15,6 +15,7 @@
  */
 
 #include "runtime/graph_scheduler/actor/actor_dump.h"
+#include "backend/common/optimizer/dynamic_shape/dynamic_shape_helper.h"
 
 namespace mindspore {
 namespace runtime {
@@ -152,6 +153,12 @@ void DumpKernelActor(const KernelActor *actor, std::ofstream &ofs) {
       << "\tinputs_num:" << common::AnfAlgo::GetInputTensorNum(kernel)
       << "\toutputs_num:" << common::AnfAlgo::GetOutputTensorNum(kernel)
       << "\tis_dynamic_shape:" << actor->is_dynamic_shape() << "\n";
+  const auto &infer_shape_cache = kernel->user_data<opt::dynamic_shape::InferShapeCache>();
+  if (actor->is_dynamic_shape() && infer_shape_cache != nullptr) {
+    ofs << "\t\tinfer_cache_hit:" << infer_shape_cache->hit_count()
+        << "\tinfer_cache_miss:" << infer_shape_cache->miss_count()
+        << "\tresize_count:" << infer_shape_cache->resize_count() << "\n";
+  }
   for (size_t i = 0; i < common::AnfAlgo::GetOutputTensorNum(kernel); ++i) {
     const auto &device_tensor = AnfAlgo::GetMutableOutputAddr(kernel, i, false);
     MS_EXCEPTION_IF_NULL(device_tensor);
@@ -25,6 +25,46 @@
 
 namespace mindspore {
 namespace runtime {
+namespace {
+// The max number of idle receiving buffers cached by a recv actor. The data of one step is usually received in one
+// buffer, and a few more buffers are cached for the messages arriving before the previous ones are consumed.
+constexpr size_t kMaxIdleRecvBufferNum = 4;
+}  // namespace
+
+RecvBufferPool::~RecvBufferPool() {
+  std::unique_lock<std::mutex> lock(mtx_);
+  for (auto &buffer : idle_buffers_) {
+    free(buffer.second);
+  }
+  idle_buffers_.clear();
+}
+
+void *RecvBufferPool::Allocate(size_t size) {
+  {
+    std::unique_lock<std::mutex> lock(mtx_);
+    auto iter = idle_buffers_.find(size);
+    if (iter != idle_buffers_.end()) {
+      void *buffer = iter->second;
+      (void)idle_buffers_.erase(iter);
+      return buffer;
+    }
+  }
+  // If the allocation fails, the returned nullptr makes the message body be received into the body string instead.
+  return malloc(size);
+}
+
+void RecvBufferPool::Free(void *data, size_t size) {
+  if (data == nullptr) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mtx_);
+  if (idle_buffers_.size() >= kMaxIdleRecvBufferNum) {
+    free(data);
+    return;
+  }
+  (void)idle_buffers_.emplace(size, data);
+}
+
 void RecvActor::SetOpcontext(OpContext<DeviceTensor> *const op_context) {
   std::unique_lock<std::mutex> lock(context_mtx_);
   MS_EXCEPTION_IF_NULL(op_context);
@@ -57,8 +97,11 @@ bool RecvActor::StartServer() {
   MS_LOG(INFO) << "Start server for recv actor. Server address: " << server_url
                << ", inter-process edge name: " << inter_process_edge_name_;
 
-  // Step 2: Set the message handler of the server.
+  // Step 2: Set the message handler and the receiving buffer of the server.
   server_->SetMessageHandler(std::bind(&RecvActor::HandleMessage, this, std::placeholders::_1));
+  const auto &recv_buffer_pool = recv_buffer_pool_;
+  server_->SetRecvBufferCallback([recv_buffer_pool](size_t size) { return recv_buffer_pool->Allocate(size); },
+                                 [recv_buffer_pool](void *data, size_t size) { recv_buffer_pool->Free(data, size); });
 
   // Step 2: Register the server address to route table. The server should not be connected before this step is done.
   ActorAddress recv_actor_addresss;
@@ -146,5 +189,6 @@ MessageBase *RecvActor::HandleMessage(MessageBase *const msg) {
   ActorDispatcher::Send(GetAID(), &RecvActor::RunOpInterProcessData, msg, op_context_);
   return distributed::rpc::NULL_MSG;
 }
+
 }  // namespace runtime
 }  // namespace mindspore
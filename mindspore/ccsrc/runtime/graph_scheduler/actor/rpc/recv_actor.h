@@ -18,6 +18,7 @@
 #define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_RPC_RECV_ACTOR_H_
 
 #include <set>
+#include <map>
 #include <mutex>
 #include <vector>
 #include <string>
@@ -27,6 +28,23 @@
 
 namespace mindspore {
 namespace runtime {
+// The buffers which the inter-process data is received into. They are reused across steps, so that each message
+// doesn't allocate and zero-initialize a new body. The pool is owned by the callbacks registered to the tcp server and
+// by the received messages too, because both of them may outlive the recv actor.
+class RecvBufferPool {
+ public:
+  RecvBufferPool() = default;
+  ~RecvBufferPool();
+  void *Allocate(size_t size);
+  void Free(void *data, size_t size);
+
+ private:
+  // The idle receiving buffers keyed by their byte size.
+  std::multimap<size_t, void *> idle_buffers_;
+  std::mutex mtx_;
+};
+using RecvBufferPoolPtr = std::shared_ptr<RecvBufferPool>;
+
 // RecvActor inherits from RpcActor and it's used to receive data from other processes.
 class RecvActor : public RpcActor {
  public:
@@ -36,7 +54,8 @@ class RecvActor : public RpcActor {
                      const std::set<size_t> &modifiable_ref_output_indexes)
       : RpcActor(name, kernel, device_context, memory_manager_aid, debug_aid, recorder_aid, strategy,
                  modifiable_ref_input_indexes, modifiable_ref_output_indexes, KernelTransformType::kRecvActor),
-        is_context_valid_(false) {}
+        is_context_valid_(false),
+        recv_buffer_pool_(std::make_shared<RecvBufferPool>()) {}
   ~RecvActor() override = default;
 
   // Besides set the op context, this method also notify the message handler to 'RunOpInterProcessData'.
@@ -78,6 +97,8 @@ class RecvActor : public RpcActor {
   bool is_context_valid_;
   std::mutex context_mtx_;
   std::condition_variable context_cv_;
+
+  RecvBufferPoolPtr recv_buffer_pool_;
 };
 
 using RecvActorPtr = std::shared_ptr<RecvActor>;
@@ -17,6 +17,7 @@
 #include "runtime/graph_scheduler/actor/rpc/send_actor.h"
 
 #include <utility>
+#include "runtime/graph_scheduler/actor/memory_manager_actor.h"
 
 namespace mindspore {
 namespace runtime {
@@ -65,21 +66,70 @@ void SendActor::SendOutput(OpContext<DeviceTensor> *const context) {
     return;
   }
   auto send_output = launch_info_.inputs_;
+  std::function<void(void *, size_t)> release_callback = nullptr;
+  if (sending_buffer_ != nullptr) {
+    // Every message holds the input memory taken in SendMemoryFreeReq, which is freed by the last released one on the
+    // rpc thread.
+    release_callback = [buffer = sending_buffer_](void *, size_t) mutable { buffer.reset(); };
+  }
   for (const auto &peer : peer_actor_urls_) {
     std::string peer_server_url = peer.second;
-    auto message = BuildRpcMessage(send_output, peer_server_url);
+    auto message = BuildRpcMessage(send_output, peer_server_url, release_callback);
     MS_ERROR_IF_NULL_WO_RET_VAL(message);
     MS_LOG(INFO) << "Rpc actor send message for inter-process edge: " << peer.first;
     client_->SendAsync(std::move(message));
   }
+  sending_buffer_ = nullptr;
+}
+
+void SendActor::SendMemoryFreeReq(OpContext<DeviceTensor> *const context) {
+  if (!IsZeroCopySend()) {
+    KernelActor::SendMemoryFreeReq(context);
+    return;
+  }
+  // The input memory is sent without copying, so it's taken away from the input device tensor instead of being freed,
+  // and the next step allocates new memory for the device tensor. This actor doesn't wait for the messages.
+  auto input_device_tensor = input_device_tensors_[0];
+  const auto &device_context = device_contexts_[0];
+  MS_EXCEPTION_IF_NULL(device_context);
+  sending_buffer_ = std::shared_ptr<void>(input_device_tensor->GetMutablePtr(),
+                                          [device_context](void *ptr) { device_context->FreeMemory(ptr); });
+  input_device_tensor->set_ptr(nullptr);
+
+  // Free the other memory as usual.
+  rest_memory_free_list_.assign(memory_free_list_.begin() + 1, memory_free_list_.end());
+  if (rest_memory_free_list_.empty()) {
+    return;
+  }
+  ActorDispatcher::Send(memory_manager_aid_, &MemoryManagerActor::FreeMemory, &rest_memory_free_list_, device_context,
+                        context, GetAID());
+}
+
+bool SendActor::IsZeroCopySend() const {
+  // The message body supports only one external buffer, so multiple inputs are still copied into the message body.
+  if (strategy_ != GraphExecutionStrategy::kPipeline || peer_actor_urls_.empty() || launch_info_.inputs_.size() != 1 ||
+      (!copy_input_device_tensors_.empty() && copy_input_device_tensors_[0] != nullptr)) {
+    return false;
+  }
+  // The memory can only be taken away if this actor is its only user and it comes from the memory pool.
+  auto input_device_tensor = input_device_tensors_[0];
+  return input_device_tensor != nullptr && input_device_tensor->original_ref_count() == 1 &&
+         input_device_tensor->from_mem_pool() && input_device_tensor->GetPtr() != nullptr;
 }
 
 std::unique_ptr<MessageBase> SendActor::BuildRpcMessage(const kernel::AddressPtrList &data_list,
-                                                        const std::string &server_url) {
+                                                        const std::string &server_url,
+                                                        const std::function<void(void *, size_t)> &release_callback) {
   std::unique_ptr<MessageBase> message = std::make_unique<MessageBase>();
   MS_ERROR_IF_NULL_W_RET_VAL(message, nullptr);
   message->to = AID("", server_url);
 
+  if (release_callback != nullptr && data_list.size() == 1) {
+    MS_ERROR_IF_NULL_W_RET_VAL(data_list[0], nullptr);
+    message->SetExternalData(data_list[0]->addr, data_list[0]->size, release_callback);
+    return message;
+  }
+
   size_t total_size = 0;
   total_size =
     std::accumulate(data_list.begin(), data_list.end(), total_size,
@@ -21,6 +21,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <functional>
 #include "runtime/graph_scheduler/actor/rpc/rpc_actor.h"
 
 namespace mindspore {
@@ -47,9 +48,17 @@ class SendActor : public RpcActor {
   // After rpc send kernel is launched, inter-process data should be sent.
   void SendOutput(OpContext<DeviceTensor> *const context) override;
 
+  // The input memory is handed over to the messages instead of being freed if it's sent without copying.
+  void SendMemoryFreeReq(OpContext<DeviceTensor> *const context) override;
+
  private:
-  // Client only supports to send MessageBase, so build MessageBase with data and url.
-  std::unique_ptr<MessageBase> BuildRpcMessage(const kernel::AddressPtrList &data_list, const std::string &server_url);
+  // Client only supports to send MessageBase, so build MessageBase with data and url. The single input is sent from its
+  // memory directly and release_callback is called after the message is sent.
+  std::unique_ptr<MessageBase> BuildRpcMessage(const kernel::AddressPtrList &data_list, const std::string &server_url,
+                                               const std::function<void(void *, size_t)> &release_callback);
+
+  // Whether the inter-process data is sent from the input memory without copying it into message bodies.
+  bool IsZeroCopySend() const;
 
   friend class GraphScheduler;
 
@@ -58,6 +67,12 @@ class SendActor : public RpcActor {
   mindspore::HashMap<std::string, std::string> peer_actor_urls_;
 
   std::unique_ptr<TCPClient> client_;
+
+  // The input memory of this step which is sent without copying. It's shared with the messages sent from it, and freed
+  // when all of them are released.
+  std::shared_ptr<void> sending_buffer_{nullptr};
+  // The memory free list without the input memory which is sent without copying.
+  std::vector<DeviceTensor *> rest_memory_free_list_;
 };
 
 using SendActorPtr = std::shared_ptr<SendActor>;
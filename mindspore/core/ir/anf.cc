@@ -19,6 +19,7 @@
 #include "ir/anf.h"
 
 #include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <vector>
 #include <queue>
@@ -368,7 +369,7 @@ bool IsStateEquivalent(const AnfNodePtr &outer, const AnfNodePtr &inner) {
 }
 
 SeenNum NewSeenGeneration() {
-  static SeenNum seen_generation = 0;
+  static std::atomic<SeenNum> seen_generation{0};
   return ++seen_generation;
 }
 
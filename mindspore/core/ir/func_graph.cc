@@ -18,6 +18,7 @@
 
 #include "ir/func_graph.h"
 #include <algorithm>
+#include <atomic>
 #include "utils/trace_base.h"
 #include "ir/manager.h"
 #include "utils/flags.h"
@@ -787,7 +788,7 @@ void FuncGraph::set_used_forward_nodes(const std::vector<AnfNodePtr> &used_forwa
 std::vector<AnfNodePtr> FuncGraph::TopoSort(const AnfNodePtr &node) { return mindspore::TopoSort(node); }
 
 SeenNum NewFgSeenGeneration() {
-  static SeenNum fg_seen_generation = 0;
+  static std::atomic<SeenNum> fg_seen_generation{0};
   return ++fg_seen_generation;
 }
 }  // namespace mindspore
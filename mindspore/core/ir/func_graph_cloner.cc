@@ -17,6 +17,9 @@
 #include "ir/func_graph_cloner.h"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 
 #include "ir/manager.h"
 #include "ir/param_info.h"
@@ -771,6 +774,57 @@ FuncGraphPtr BasicClone(const FuncGraphPtr &func_graph, bool clone_value_nodes,
   return cloner[func_graph];
 }
 
+FuncGraphVector ParallelBasicClone(const FuncGraphVector &func_graphs, bool clone_value_nodes, size_t thread_num) {
+  FuncGraphVector new_func_graphs(func_graphs.size());
+  // A cloner registers the graphs to the manager of them, which is not thread safe, so only the graphs without a
+  // manager are cloned in parallel, each by a cloner of its own.
+  std::vector<size_t> unmanaged_indexes;
+  for (size_t i = 0; i < func_graphs.size(); ++i) {
+    MS_EXCEPTION_IF_NULL(func_graphs[i]);
+    if (func_graphs[i]->manager() == nullptr) {
+      (void)unmanaged_indexes.emplace_back(i);
+    } else {
+      new_func_graphs[i] = BasicClone(func_graphs[i], clone_value_nodes);
+    }
+  }
+  if (thread_num == 0) {
+    thread_num = std::thread::hardware_concurrency();
+  }
+  thread_num = std::max<size_t>(std::min(thread_num, unmanaged_indexes.size()), 1);
+  std::atomic<size_t> next{0};
+  auto clone = [&func_graphs, &new_func_graphs, &unmanaged_indexes, &next, clone_value_nodes]() {
+    for (size_t i = next++; i < unmanaged_indexes.size(); i = next++) {
+      auto index = unmanaged_indexes[i];
+      new_func_graphs[index] = BasicClone(func_graphs[index], clone_value_nodes);
+    }
+  };
+  std::vector<std::thread> threads;
+  std::vector<std::exception_ptr> exceptions(thread_num);
+  for (size_t i = 1; i < thread_num; ++i) {
+    (void)threads.emplace_back([&clone, &exceptions, i]() {
+      try {
+        clone();
+      } catch (...) {
+        exceptions[i] = std::current_exception();
+      }
+    });
+  }
+  try {
+    clone();
+  } catch (...) {
+    exceptions[0] = std::current_exception();
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (auto &exception : exceptions) {
+    if (exception != nullptr) {
+      std::rethrow_exception(exception);
+    }
+  }
+  return new_func_graphs;
+}
+
 AnfNodePtr InlineClone(const FuncGraphPtr &func_graph, const FuncGraphPtr &target_func_graph,
                        const AnfNodePtrList &func_graph_args, const ScopePtr &scope) {
   MS_EXCEPTION_IF_NULL(func_graph);
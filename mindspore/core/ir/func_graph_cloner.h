@@ -146,6 +146,12 @@ MS_CORE_API FuncGraphPtr TransformableClone(const FuncGraphPtr &func_graph,
                                             const TraceInfoPtr &relation = std::make_shared<TraceTransform>());
 MS_CORE_API FuncGraphPtr BasicClone(const FuncGraphPtr &func_graph, bool clone_value_nodes = false,
                                     const UpdateInfoPtr update_info = nullptr);
+
+// Clone each graph of func_graphs as BasicClone does, several graphs at a time on up to thread_num threads, or on as
+// many threads as the cores if thread_num is 0. The graphs must not share any node or used graph, since the seen marks
+// of the node traversals are not thread safe. The graphs which have a manager are cloned one by one.
+MS_CORE_API FuncGraphVector ParallelBasicClone(const FuncGraphVector &func_graphs, bool clone_value_nodes = false,
+                                               size_t thread_num = 0);
 }  // namespace mindspore
 
 #endif  // MINDSPORE_CORE_IR_FUNC_GRAPH_CLONER_H_
@@ -709,7 +709,7 @@ void FuncGraphManager::OnEdgeAdded(const AnfNodePtr &node, int index, const AnfN
     }
   } else if (fg != nullptr && fg != input->func_graph()) {
     if (fg->AddFreeVariable(input)) {
-      signals_->InvalidateComputer();
+      signals_->InvalidateFreeVariableComputer();
     }
   }
 }
@@ -731,7 +731,7 @@ void FuncGraphManager::OnEdgeRemoved(const AnfNodePtr &node, int index, const An
     }
   } else if (fg != nullptr && fg != input->func_graph()) {
     if (fg->DropFreeVariable(input)) {
-      signals_->InvalidateComputer();
+      signals_->InvalidateFreeVariableComputer();
     }
   }
 }
@@ -855,9 +855,13 @@ void FuncGraphTransaction::AddEdge(const AnfNodePtr &src_node, const AnfNodePtr
 
 void FuncGraphTransaction::Commit() { manager_->CommitChanges(std::move(changes_)); }
 
-DepComputer::DepComputer(const FuncGraphManager *const manager) : manager_(manager) {
+DepComputer::DepComputer(const FuncGraphManager *const manager, bool depend_on_free_variables)
+    : manager_(manager) {
   MS_EXCEPTION_IF_NULL(manager_);
   manager_->signals()->InvalidateComputer.connect(this, &DepComputer::OnInvalidateComputer);
+  if (depend_on_free_variables) {
+    manager_->signals()->InvalidateFreeVariableComputer.connect(this, &DepComputer::OnInvalidateComputer);
+  }
   validate_ = false;
 }
 
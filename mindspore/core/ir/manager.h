@@ -74,6 +74,8 @@ MS_CORE_API FuncGraphManagerPtr MakeManager(const std::vector<FuncGraphPtr> &fun
 
 struct Signals {
   Signal<void()> InvalidateComputer;
+  // a change of free variables only invalidates the computers depending on them.
+  Signal<void()> InvalidateFreeVariableComputer;
 };
 
 using CNodeIndexPair = std::pair<AnfNodePtr, int>;
@@ -83,12 +85,16 @@ using FuncGraphToFuncGraphSetMap = OrderedMap<FuncGraphPtr, FuncGraphSet>;
 // analysis base class, graphs analysis which need dynamic compute by DepCollector in each read
 class DepComputer {
  public:
-  explicit DepComputer(const FuncGraphManager *manager);
+  explicit DepComputer(const FuncGraphManager *manager, bool depend_on_free_variables = true);
   virtual ~DepComputer() { manager_ = nullptr; }
 
   virtual size_t size() const { return 0; }
 
   void Reset() {
+    // nothing has been computed since the last reset, the edges of a commit usually invalidate many times.
+    if (!validate_ && func_graphs_validate_.empty()) {
+      return;
+    }
     ExtraReset();
     validate_ = false;
     func_graphs_validate_.clear();
@@ -217,7 +223,7 @@ class FVTotalComputer final : public DepComputer {
 
 class FuncGraphsUsedTotalComputer final : public DepComputer {
  public:
-  explicit FuncGraphsUsedTotalComputer(const FuncGraphManager *m) : DepComputer(m) {}
+  explicit FuncGraphsUsedTotalComputer(const FuncGraphManager *m) : DepComputer(m, false) {}
   ~FuncGraphsUsedTotalComputer() override = default;
 
   FuncGraphToFuncGraphSetMap &func_graph_used_total_analysis() { return func_graph_used_total_analysis_; }
@@ -237,7 +243,7 @@ using RecursiveMap = OrderedMap<FuncGraphPtr, std::shared_ptr<std::list<FuncGrap
 
 class RecursiveComputer final : public DepComputer {
  public:
-  explicit RecursiveComputer(const FuncGraphManager *m) : DepComputer(m) {}
+  explicit RecursiveComputer(const FuncGraphManager *m) : DepComputer(m, false) {}
   ~RecursiveComputer() override = default;
 
   RecursiveMap &recursive_map() { return recursive_map_; }
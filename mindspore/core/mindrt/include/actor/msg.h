@@ -19,6 +19,7 @@
 
 #include <utility>
 #include <string>
+#include <functional>
 
 #include "actor/aid.h"
 
@@ -50,7 +51,11 @@ class MessageBase {
                        Type eType = Type::KMSG)
       : from(aFrom), to(aTo), name(sName), body(std::move(sBody)), type(eType) {}
 
-  virtual ~MessageBase() {}
+  virtual ~MessageBase() {
+    if (external_data_release != nullptr) {
+      external_data_release(external_data, external_size);
+    }
+  }
 
   inline std::string &Name() { return name; }
 
@@ -60,6 +65,17 @@ class MessageBase {
 
   inline std::string &Body() { return body; }
 
+  // Return whether the message body is an external buffer instead of the `body` string.
+  inline bool HasExternalData() const { return external_data != nullptr; }
+
+  // Set the external buffer which is used as the message body without being copied. The buffer must stay valid until
+  // `release` is called, which happens when this message is destroyed.
+  inline void SetExternalData(void *aData, size_t aSize, const std::function<void(void *, size_t)> &release) {
+    external_data = aData;
+    external_size = aSize;
+    external_data_release = release;
+  }
+
   inline void SetFrom(const AID &aFrom) { from = aFrom; }
 
   inline AID &To() { return to; }
@@ -79,6 +95,11 @@ class MessageBase {
   std::string name;
   std::string body;
   Type type;
+
+  // The external buffer of the message body.
+  void *external_data{nullptr};
+  size_t external_size{0};
+  std::function<void(void *, size_t)> external_data_release{nullptr};
 };
 }  // namespace mindspore
 
@@ -59,10 +59,13 @@ enum Arch {
   Cortex_X1
 };
 
+constexpr int kMaxNumaNodeNum = 64;
+
 typedef struct {
   int core_id;
   int max_freq;
   enum Arch arch;
+  int numa_node;
 } CpuInfo;
 
 enum Arch GetArch(int cpu_part) {
@@ -215,6 +218,54 @@ int GetMaxFrequency(int core_id) {
   return max_freq;
 }
 
+// parse the cpulist of each numa node, such as "0-15,32-47", the cores are in node 0 if there is no numa info.
+std::vector<int> GetNumaNodes(size_t core_num) {
+  std::vector<int> numa_nodes(core_num, 0);
+  for (int node = 0; node < kMaxNumaNodeNum; ++node) {
+    std::string file = "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+    FILE *fp = fopen(file.c_str(), "rb");
+    if (fp == nullptr) {
+      continue;
+    }
+    int begin = 0;
+    while (fscanf(fp, "%d", &begin) == 1) {
+      int end = begin;
+      int separator = fgetc(fp);
+      if (separator == '-') {
+        if (fscanf(fp, "%d", &end) != 1) {
+          break;
+        }
+        separator = fgetc(fp);
+      }
+      for (int core = begin; core <= end; ++core) {
+        if (core >= 0 && static_cast<size_t>(core) < core_num) {
+          numa_nodes[core] = node;
+        }
+      }
+      if (separator != ',') {
+        break;
+      }
+    }
+    (void)fclose(fp);
+  }
+  return numa_nodes;
+}
+
+// the faster cores come first, and the cores of the same kind are grouped by numa node, so that the adjacent threads
+// of the pool share the local memory and the cache.
+bool CoreOrderBefore(const CpuInfo &lhs, const CpuInfo &rhs) {
+  if (lhs.max_freq != rhs.max_freq) {
+    return lhs.max_freq > rhs.max_freq;
+  }
+  if (lhs.arch != rhs.arch) {
+    return lhs.arch > rhs.arch;
+  }
+  if (lhs.numa_node != rhs.numa_node) {
+    return lhs.numa_node < rhs.numa_node;
+  }
+  return lhs.core_id < rhs.core_id;
+}
+
 float CoreAffinity::GetServerFrequency() {
   float max_freq = -1.0f;
 #ifdef SERVER_INFERENCE
@@ -269,33 +320,27 @@ int CoreAffinity::InitHardwareCoreInfo() {
   std::vector<CpuInfo> freq_set;
   freq_set.resize(core_num_);
   core_freq_.resize(core_num_);
+  auto numa_nodes = GetNumaNodes(core_num_);
   for (size_t i = 0; i < core_num_; ++i) {
     int max_freq = GetMaxFrequency(i);
     core_freq_[i] = max_freq;
     freq_set[i].core_id = i;
     freq_set[i].max_freq = max_freq;
     freq_set[i].arch = UnKnown_Arch;
+    freq_set[i].numa_node = numa_nodes[i];
   }
   int err_code = SetArch(&freq_set, core_num_);
   if (err_code != THREAD_OK) {
     THREAD_INFO("set arch failed, ignoring arch.");
   }
-  // sort core id by frequency into descending order
-  for (size_t i = 0; i < core_num_; ++i) {
-    for (size_t j = i + 1; j < core_num_; ++j) {
-      if (freq_set[i].max_freq < freq_set[j].max_freq ||
-          (freq_set[i].max_freq == freq_set[j].max_freq && freq_set[i].arch <= freq_set[j].arch)) {
-        CpuInfo temp = freq_set[i];
-        freq_set[i] = freq_set[j];
-        freq_set[j] = temp;
-      }
-    }
-  }
+  // sort core id by frequency into descending order, and then by numa node
+  std::sort(freq_set.begin(), freq_set.end(), CoreOrderBefore);
   higher_num_ = 0;
   sorted_id_.clear();
   int max_freq = freq_set.front().max_freq;
   for (const auto &info : freq_set) {
-    THREAD_INFO("sorted core id: %d, max frequency: %d, arch: %d", info.core_id, info.max_freq, info.arch);
+    THREAD_INFO("sorted core id: %d, max frequency: %d, arch: %d, numa node: %d", info.core_id, info.max_freq,
+                info.arch, info.numa_node);
     sorted_id_.push_back(info.core_id);
     higher_num_ += info.max_freq == max_freq ? 1 : 0;
   }
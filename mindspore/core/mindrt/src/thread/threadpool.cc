@@ -102,12 +102,18 @@ void Worker::Run() {
 }
 
 bool Worker::RunLocalKernelTask() {
+  // the task slot is still held by the running task, when a ParallelLaunch is nested in it.
+  if (running_task_) {
+    return false;
+  }
   Task *task = task_.load(std::memory_order_consume);
   if (task == nullptr) {
     return false;
   }
   int task_id = task_id_.load(std::memory_order_consume);
+  running_task_ = true;
   task->status |= task->func(task->content, task_id, lhs_scale_, rhs_scale_);
+  running_task_ = false;
   task_.store(nullptr, std::memory_order_relaxed);
   (void)++task->finished;
   return true;
@@ -238,7 +244,8 @@ void ThreadPool::DistributeTask(Task *task, int task_num, Worker *curr) const {
   std::vector<Worker *> assigned;
   int num = static_cast<int>(workers_.size()) - 1;
   int offset = 0;
-  bool use_curr = (curr != nullptr) ? curr->get_task_free() : false;
+  // a ParallelLaunch nested in a kernel task runs on the idle workers and the calling thread only.
+  bool use_curr = (curr != nullptr) ? (curr->get_task_free() && !curr->running_task()) : false;
   // if the current thread isn't nullptr, that is the curr is a ActorThread,
   // then assign (task_num - 1) tasks to workers, and run the last one by itself
   int num_assigned = use_curr ? task_num - 1 : task_num;
@@ -106,6 +106,7 @@ class Worker {
   inline void set_task_free(bool flag) { task_free_ = flag; }
   inline void set_alive(bool flag) { alive_ = flag; }
   inline bool alive() { return alive_; }
+  inline bool running_task() const { return running_task_; }
 
  protected:
   void SetAffinity();
@@ -134,6 +135,7 @@ class Worker {
   int spin_count_{0};
   int max_spin_count_{kMinSpinCount};
   bool task_free_{true};
+  bool running_task_{false};
   ThreadPool *pool_{nullptr};
   size_t worker_id_{0};
 };
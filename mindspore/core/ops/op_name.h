@@ -264,6 +264,7 @@ constexpr auto kBegin = "begin";
 constexpr auto kSrcFormat = "src_format";
 constexpr auto kDstFormat = "dst_format";
 constexpr auto kLambd = "lambd";
+constexpr auto kIsCausal = "is_causal";
 
 enum Index : size_t {
   kInputIndex0 = 0,
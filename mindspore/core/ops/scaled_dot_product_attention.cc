@@ -0,0 +1,44 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ops/scaled_dot_product_attention.h"
+#include "ops/op_utils.h"
+#include "mindapi/src/helper.h"
+
+namespace mindspore {
+namespace ops {
+MIND_API_OPERATOR_IMPL(ScaledDotProductAttention, BaseOperator);
+void ScaledDotProductAttention::Init(float scale, bool is_causal) {
+  set_scale(scale);
+  set_is_causal(is_causal);
+}
+
+void ScaledDotProductAttention::set_scale(float scale) { (void)AddAttr(kScale, api::MakeValue(scale)); }
+
+void ScaledDotProductAttention::set_is_causal(bool is_causal) {
+  (void)AddAttr(kIsCausal, api::MakeValue(is_causal));
+}
+
+float ScaledDotProductAttention::get_scale() const {
+  auto value_ptr = GetAttr(kScale);
+  return GetValue<float>(value_ptr);
+}
+
+bool ScaledDotProductAttention::get_is_causal() const {
+  auto value_ptr = GetAttr(kIsCausal);
+  return GetValue<bool>(value_ptr);
+}
+}  // namespace ops
+}  // namespace mindspore
@@ -0,0 +1,48 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_OPS_SCALED_DOT_PRODUCT_ATTENTION_H_
+#define MINDSPORE_CORE_OPS_SCALED_DOT_PRODUCT_ATTENTION_H_
+#include <vector>
+#include <memory>
+#include "ops/base_operator.h"
+#include "mindapi/base/types.h"
+
+namespace mindspore {
+namespace ops {
+constexpr auto kNameScaledDotProductAttention = "ScaledDotProductAttention";
+/// \brief softmax(q * k^T * scale + mask) * v, the q is [batch, head, q_seq, head_size] and the k and v are
+/// [batch, head, kv_seq, head_size]. The mask is optional.
+class MIND_API ScaledDotProductAttention : public BaseOperator {
+ public:
+  MIND_API_BASE_MEMBER(ScaledDotProductAttention);
+  /// \brief Constructor.
+  ScaledDotProductAttention() : BaseOperator(kNameScaledDotProductAttention) {
+    InitIOName({"q", "k", "v", "mask"}, {"output"});
+  }
+  /// \brief Init.
+  ///
+  /// \param[in] scale Define the scale of q * k^T, 1 / sqrt(head_size) is used if it's not positive.
+  /// \param[in] is_causal Define whether the query only attends to the keys up to its position.
+  void Init(float scale = 0.0f, bool is_causal = false);
+  void set_scale(float scale);
+  void set_is_causal(bool is_causal);
+  float get_scale() const;
+  bool get_is_causal() const;
+};
+}  // namespace ops
+}  // namespace mindspore
+#endif  // MINDSPORE_CORE_OPS_SCALED_DOT_PRODUCT_ATTENTION_H_
@@ -15,6 +15,7 @@
  */
 
 #include "utils/info.h"
+#include <atomic>
 #include <utility>
 #include <fstream>
 #include <sstream>
@@ -97,7 +98,7 @@ bool Location::operator<(const Location &other) const {
 
 int64_t DebugInfo::get_id() const {
   // cppcheck-suppress variableScope
-  static int64_t current_id = 1;
+  static std::atomic<int64_t> current_id{1};
   if (id_ == 0) {
     id_ = current_id++;
   }
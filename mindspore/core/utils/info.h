@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CORE_UTILS_INFO_H_
 #define MINDSPORE_CORE_UTILS_INFO_H_
 
+#include <atomic>
 #include <string>
 #include <memory>
 #include <utility>
@@ -236,7 +237,8 @@ class MS_CORE_API DebugInfo {
 
  protected:
   static int64_t gen_unique_id() {
-    static int64_t cur_unique_id = 0;
+    // the nodes may be created on several threads, such as the graphs cloned in parallel.
+    static std::atomic<int64_t> cur_unique_id{0};
     return cur_unique_id++;
   }
 
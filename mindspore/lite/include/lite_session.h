@@ -168,6 +168,11 @@ class MS_API LiteSession {
   /// \return learning rate. 0.0 if no optimizer was found
   virtual float GetLearningRate() { return 0.0; }
 
+  /// \brief Gets the memory size which the tensors of the current mode are planned to take
+  ///
+  /// \return size in bytes. 0 if the tensors are not planned by the static allocator
+  virtual size_t GetPlannedTensorsSize() const { return 0; }
+
   /// \brief Setup training with virtual batches
   ///
   /// \param[in] virtual_batch_multiplier - virtual batch multiplier, use any number < 1 to disable
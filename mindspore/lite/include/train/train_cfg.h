@@ -51,11 +51,15 @@ class TrainCfg {
     this->loss_name_ = rhs.loss_name_;
     this->mix_precision_cfg_ = rhs.mix_precision_cfg_;
     this->accumulate_gradients_ = rhs.accumulate_gradients_;
+    this->recompute_memory_budget_ = rhs.recompute_memory_budget_;
+    this->recompute_names_ = rhs.recompute_names_;
   }
   TrainCfg &operator=(const TrainCfg &rhs) = default;
   std::vector<std::string> loss_name_ = {"loss_fct"}; /**< Set part of the name that identify a loss kernel */
   MixPrecisionCfg mix_precision_cfg_;                 /**< Mix precision configuration */
   bool accumulate_gradients_ = false; /**< If true gardents are accmulated and can be read by GetGradients */
+  size_t recompute_memory_budget_ = 0;       /**< Memory budget of the activations in bytes, 0 means no budget */
+  std::vector<std::string> recompute_names_; /**< Set part of the name that identify a forward kernel to recompute */
 };
 
 }  // namespace lite
@@ -65,6 +65,15 @@ static const char *const kMSCacheModelPath = "cache_model_path";
 static const char *const kMSCacheVocabSize = "vocab_size";
 static const char *const kMSCacheDeviceSize = "device_cache_size";
 static const char *const kMSCacheSerializePath = "serialize_path";
+// resize plan cache
+static const char *const kResizePlanCache = "resize_plan_cache";
+static const char *const kResizePlanCacheSize = "cache_size";
+// parallel subgraph profile
+static const char *const kSubGraphProfile = "sub_graph_profile";
+static const char *const kSubGraphProfileFile = "profile_file";
+// bfloat16 matmul on x86
+static const char *const kCpuBFloat16 = "cpu_bfloat16";
+static const char *const kCpuBFloat16Enable = "enable_bfloat16";
 }  // namespace lite
 }  // namespace mindspore
 
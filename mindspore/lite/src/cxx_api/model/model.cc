@@ -496,4 +496,12 @@ float Model::GetLearningRate() {
   }
   return impl_->GetLearningRate();
 }
+
+size_t Model::GetPlannedTensorsSize() {
+  if (impl_ == nullptr) {
+    MS_LOG(WARNING) << "Model implement is null.";
+    return 0;
+  }
+  return impl_->GetPlannedTensorsSize();
+}
 }  // namespace mindspore
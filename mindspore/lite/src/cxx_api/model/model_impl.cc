@@ -735,6 +735,14 @@ float ModelImpl::GetLearningRate() {
   return session_->GetLearningRate();
 }
 
+size_t ModelImpl::GetPlannedTensorsSize() {
+  if (session_ == nullptr) {
+    MS_LOG(WARNING) << "Session is null.";
+    return 0;
+  }
+  return session_->GetPlannedTensorsSize();
+}
+
 lite::LiteSession *ModelImpl::CreateLiteSession(lite::InnerContext *context) {
   auto session = new (std::nothrow) lite::LiteSession();
   if (session == nullptr) {
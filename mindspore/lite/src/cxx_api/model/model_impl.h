@@ -97,6 +97,7 @@ class ModelImpl {
   Status SetupVirtualBatch(int virtual_batch_multiplier, float lr, float momentum);
   Status SetLearningRate(float learning_rate);
   float GetLearningRate();
+  size_t GetPlannedTensorsSize();
   Status BuildTransferLearning(const std::shared_ptr<Graph> &backbone, const std::shared_ptr<Graph> &head);
 
   Status InitMetrics(const std::vector<Metrics *> metrics) {
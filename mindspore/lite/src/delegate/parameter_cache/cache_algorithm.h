@@ -21,6 +21,7 @@
 #include "include/api/status.h"
 
 namespace mindspore {
+class ThreadPool;
 namespace cache {
 struct CacheNoe {
   CacheNoe(int _index, int _frequency, int _value) : key(_index), frequency(_frequency), value(_value) {}
@@ -37,6 +38,11 @@ class CacheAlgorithm {
   virtual Status Init(size_t cache_size, int min_host_index, int max_host_index) = 0;
   virtual Status CheckCacheHit(const int *batch_ids, const size_t batch_ids_len, int *cache_index,
                                std::vector<int> *need_swap_indies, std::vector<int> *need_swap_indies_cache_index) = 0;
+  // the thread pool of the session, the batch is handled by the calling thread only if it is not set.
+  void set_thread_pool(ThreadPool *thread_pool) { thread_pool_ = thread_pool; }
+
+ protected:
+  ThreadPool *thread_pool_{nullptr};
 };
 }  // namespace cache
 }  // namespace mindspore
@@ -24,6 +24,7 @@
 #include "include/errorcode.h"
 #include "src/delegate/parameter_cache/gpu/gpu_cache_mem.h"
 #include "src/delegate/parameter_cache/lfu_cache.h"
+#include "src/delegate/parameter_cache/flat_lfu_cache.h"
 #include "src/delegate/parameter_cache/factory_mgr_base.h"
 
 namespace {
@@ -127,11 +128,12 @@ Status EmbeddingCache::Init(uint32_t device_id, const void *context, mindspore::
   if (ret != kSuccess) {
     return ret;
   }
-  cache_ = lite::FactoryManagerBase<std::string, cache::CacheAlgorithm>::Instance().GetProduct("lfu");
+  cache_ = lite::FactoryManagerBase<std::string, cache::CacheAlgorithm>::Instance().GetProduct("flat_lfu");
   if (cache_ == nullptr) {
-    MS_LOG(ERROR) << "malloc LFUCacheAlgorithm failed";
+    MS_LOG(ERROR) << "malloc FlatLFUCacheAlgorithm failed";
     return kLiteMemoryFailed;
   }
+  cache_->set_thread_pool(thread_pool_);
   ret = cache_->Init(device_cache_size_, min_host_index_, max_host_index_);
   if (ret != kSuccess) {
     MS_LOG(ERROR) << "init cache failed," << ret.CodeAsString;
@@ -206,8 +208,12 @@ Status EmbeddingCache::CheckCacheHit(const int *batch_ids, const size_t batch_id
   }
   auto swap_indices_size = need_swap_indies.size();
   if (swap_indices_size > 0) {
-    LookUpTableTask(swap_indices_size, host_cache_size_, static_cast<char *>(host_addr_), need_swap_indies.data(),
-                    static_cast<char *>(hash_swap_value_addr_), embedding_size_ * sizeof_data_type_, min_host_index_);
+    auto embedding_len = embedding_size_ * sizeof_data_type_;
+    ParallelForBatch(thread_pool_, swap_indices_size, [&](size_t begin, size_t end) {
+      LookUpTableTask(end - begin, host_cache_size_, static_cast<char *>(host_addr_), need_swap_indies.data() + begin,
+                      static_cast<char *>(hash_swap_value_addr_) + begin * embedding_len, embedding_len,
+                      min_host_index_);
+    });
 
     auto device_cache_ret = device_cache_->CopyHostMemToDevice(hash_swap_value_device_addr_, hash_swap_value_addr_,
                                                                swap_indices_size * embedding_size_ * sizeof_data_type_);
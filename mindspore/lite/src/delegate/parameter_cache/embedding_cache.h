@@ -53,6 +53,7 @@ class EmbeddingCache {
   Status SetDeviceCacheAddr(void *host_mem_addr, size_t size);
   Status CheckCacheHit(const int *batch_ids, const size_t batch_ids_len, int *hash_index);
   size_t GetDeviceStartIndex() { return device_start_index_; }
+  void set_thread_pool(ThreadPool *thread_pool) { thread_pool_ = thread_pool; }
 
  private:
   Status Init(mindspore::MSTensor host_cache_tensor, mindspore::MSTensor device_tensor);
@@ -61,6 +62,7 @@ class EmbeddingCache {
  private:
   std::shared_ptr<cache::CacheMemBase> device_cache_{nullptr};
   std::shared_ptr<CacheAlgorithm> cache_{nullptr};
+  ThreadPool *thread_pool_{nullptr};
 
   size_t vocab_size_{0};         // total size
   size_t host_cache_size_{0};    // local host size
@@ -105,6 +105,7 @@ Status EmbeddingCacheManager::InitCacheKernel(kernel::Kernel *kernel, uint32_t d
     MS_LOG(ERROR) << kernel->name() << ": malloc EmbeddingCache failed";
     return kLiteError;
   }
+  cache->set_thread_pool(thread_pool_);
 
   auto ret = cache->Init(device_id, context, host_cache_tensor, device_tensor);
   if (ret != kSuccess) {
@@ -44,6 +44,7 @@ class EmbeddingCacheManager {
   Status SetDeviceCacheAddr(const std::string &tensor_name, void *device_mem_addr, size_t size);
   std::vector<int64_t> GetCacheShape(mindspore::MSTensor tensor);
   size_t GetCacheDataSize(mindspore::MSTensor tensor);
+  void set_thread_pool(ThreadPool *thread_pool) { thread_pool_ = thread_pool; }
 
  private:
   std::map<std::string, std::shared_ptr<EmbeddingCache>> caches_;
@@ -54,6 +55,7 @@ class EmbeddingCacheManager {
   std::shared_ptr<HostCacheModel> host_cache_model_;
   size_t vocab_size_;
   size_t device_cache_size_;
+  ThreadPool *thread_pool_{nullptr};
 };
 }  // namespace cache
 }  // namespace mindspore
@@ -0,0 +1,300 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "src/delegate/parameter_cache/flat_lfu_cache.h"
+#include <algorithm>
+#include <string>
+#include "src/common/log_adapter.h"
+#include "thread/threadpool.h"
+#include "src/delegate/parameter_cache/factory_mgr_base.h"
+namespace mindspore {
+namespace cache {
+namespace {
+constexpr int kInvalidIndex = -1;
+constexpr int kOutOfRange = -1;
+constexpr int kNotCached = -2;
+// the misses of a batch are marked by kPendingBase - miss index, until the swap slots are decided.
+constexpr int kPendingBase = -3;
+constexpr size_t kMinParallelBatch = 8192;
+}  // namespace
+RET_COMMON_PRODUCT_REGISTRAR(std::string, cache::CacheAlgorithm, cache::FlatLFUCacheAlgorithm, "flat_lfu",
+                             FlatLFUCacheAlgorithm);
+
+void ParallelForBatch(ThreadPool *thread_pool, size_t size, const std::function<void(size_t, size_t)> &task) {
+  size_t task_num = 1;
+  if (thread_pool != nullptr) {
+    // the calling thread runs tasks too.
+    task_num = std::min(thread_pool->thread_num() + 1, size / kMinParallelBatch);
+  }
+  if (task_num <= 1) {
+    task(0, size);
+    return;
+  }
+  size_t chunk = (size + task_num - 1) / task_num;
+  auto func = [&task, size, chunk](void *, int task_id, float, float) {
+    size_t begin = static_cast<size_t>(task_id) * chunk;
+    if (begin < size) {
+      task(begin, std::min(begin + chunk, size));
+    }
+    return THREAD_OK;
+  };
+  if (thread_pool->ParallelLaunch(func, nullptr, static_cast<int>(task_num)) != THREAD_OK) {
+    MS_LOG(WARNING) << "ParallelLaunch failed, run the batch by the calling thread.";
+    task(0, size);
+  }
+}
+
+Status FlatLFUCacheAlgorithm::Init(size_t cache_size, int min_host_index, int max_host_index) {
+  if (cache_size <= 0 || min_host_index < 0 || max_host_index <= min_host_index) {
+    return kLiteParamInvalid;
+  }
+  cache_size_ = cache_size;
+  min_host_index_ = min_host_index;
+  max_host_index_ = max_host_index;
+  key_slots_.assign(static_cast<size_t>(max_host_index_ - min_host_index_), kNotCached);
+  slots_.clear();
+  slots_.reserve(cache_size_);
+  // a new bucket may be taken before the old one is freed when a frequency is increased.
+  buckets_.resize(cache_size_ + 1);
+  free_buckets_.resize(buckets_.size());
+  for (size_t i = 0; i < free_buckets_.size(); i++) {
+    free_buckets_[i] = static_cast<int>(free_buckets_.size() - 1 - i);
+  }
+  min_bucket_ = kInvalidIndex;
+  epoch_ = 0;
+  return kSuccess;
+}
+
+int FlatLFUCacheAlgorithm::NewBucket(int64_t frequency, int prev) {
+  MS_ASSERT(!free_buckets_.empty());
+  int bucket = free_buckets_.back();
+  free_buckets_.pop_back();
+  auto &new_bucket = buckets_[bucket];
+  new_bucket.frequency = frequency;
+  new_bucket.head = kInvalidIndex;
+  new_bucket.tail = kInvalidIndex;
+  new_bucket.prev = prev;
+  if (prev == kInvalidIndex) {
+    new_bucket.next = min_bucket_;
+    min_bucket_ = bucket;
+  } else {
+    new_bucket.next = buckets_[prev].next;
+    buckets_[prev].next = bucket;
+  }
+  if (new_bucket.next != kInvalidIndex) {
+    buckets_[new_bucket.next].prev = bucket;
+  }
+  return bucket;
+}
+
+void FlatLFUCacheAlgorithm::FreeBucket(int bucket) {
+  auto &old_bucket = buckets_[bucket];
+  if (old_bucket.prev == kInvalidIndex) {
+    min_bucket_ = old_bucket.next;
+  } else {
+    buckets_[old_bucket.prev].next = old_bucket.next;
+  }
+  if (old_bucket.next != kInvalidIndex) {
+    buckets_[old_bucket.next].prev = old_bucket.prev;
+  }
+  free_buckets_.push_back(bucket);
+}
+
+void FlatLFUCacheAlgorithm::LinkSlot(int slot, int bucket) {
+  auto &node = slots_[slot];
+  auto &list = buckets_[bucket];
+  node.bucket = bucket;
+  node.prev = kInvalidIndex;
+  node.next = list.head;
+  if (list.head != kInvalidIndex) {
+    slots_[list.head].prev = slot;
+  } else {
+    list.tail = slot;
+  }
+  list.head = slot;
+}
+
+void FlatLFUCacheAlgorithm::UnlinkSlot(int slot) {
+  auto &node = slots_[slot];
+  auto &list = buckets_[node.bucket];
+  if (node.prev == kInvalidIndex) {
+    list.head = node.next;
+  } else {
+    slots_[node.prev].next = node.next;
+  }
+  if (node.next == kInvalidIndex) {
+    list.tail = node.prev;
+  } else {
+    slots_[node.next].prev = node.prev;
+  }
+  if (list.head == kInvalidIndex) {
+    FreeBucket(node.bucket);
+  }
+  node.bucket = kInvalidIndex;
+}
+
+void FlatLFUCacheAlgorithm::IncreaseFrequency(int slot) {
+  int bucket = slots_[slot].bucket;
+  int64_t frequency = buckets_[bucket].frequency + 1;
+  int next = buckets_[bucket].next;
+  if (next == kInvalidIndex || buckets_[next].frequency != frequency) {
+    next = NewBucket(frequency, bucket);
+  }
+  UnlinkSlot(slot);
+  LinkSlot(slot, next);
+}
+
+void FlatLFUCacheAlgorithm::InsertSlot(int slot) {
+  int bucket = min_bucket_;
+  if (bucket == kInvalidIndex || buckets_[bucket].frequency != 1) {
+    bucket = NewBucket(1, kInvalidIndex);
+  }
+  LinkSlot(slot, bucket);
+}
+
+int FlatLFUCacheAlgorithm::Get(int key) {
+  if (!InRange(key)) {
+    return -1;
+  }
+  int slot = key_slots_[key - min_host_index_];
+  if (slot < 0) {
+    return -1;
+  }
+  IncreaseFrequency(slot);
+  return slots_[slot].value;
+}
+
+void FlatLFUCacheAlgorithm::Put(int key, int value) {
+  if (!InRange(key) || cache_size_ == 0) {
+    return;
+  }
+  int slot = key_slots_[key - min_host_index_];
+  if (slot >= 0) {
+    IncreaseFrequency(slot);
+    slots_[slot].value = value;
+    return;
+  }
+  if (slots_.size() < cache_size_) {
+    slot = static_cast<int>(slots_.size());
+    slots_.push_back({key, value, kInvalidIndex, kInvalidIndex, kInvalidIndex, 0});
+  } else {
+    // the least recently used one of the least frequently used slots
+    slot = buckets_[min_bucket_].tail;
+    UnlinkSlot(slot);
+    key_slots_[slots_[slot].key - min_host_index_] = kNotCached;
+    slots_[slot].key = key;
+    slots_[slot].value = value;
+  }
+  key_slots_[key - min_host_index_] = slot;
+  InsertSlot(slot);
+}
+
+bool FlatLFUCacheAlgorithm::CollectSwapSlots(size_t swap_size, std::vector<int> *swap_slots) const {
+  for (int bucket = min_bucket_; bucket != kInvalidIndex && swap_slots->size() < swap_size;
+       bucket = buckets_[bucket].next) {
+    for (int slot = buckets_[bucket].tail; slot != kInvalidIndex && swap_slots->size() < swap_size;
+         slot = slots_[slot].prev) {
+      if (slots_[slot].pin_epoch != epoch_) {
+        swap_slots->push_back(slot);
+      }
+    }
+  }
+  return swap_slots->size() == swap_size;
+}
+
+Status FlatLFUCacheAlgorithm::CheckCacheHit(const int *batch_ids, const size_t batch_ids_len, int *cache_index,
+                                            std::vector<int> *need_swap_indies,
+                                            std::vector<int> *need_swap_indies_cache_index) {
+  if (batch_ids == nullptr) {
+    MS_LOG(ERROR) << "batch_ids is nullptr";
+    return kLiteNullptr;
+  }
+  if (cache_index == nullptr || need_swap_indies == nullptr || need_swap_indies_cache_index == nullptr) {
+    MS_LOG(ERROR) << "cache_index or need_swap_indies is nullptr";
+    return kLiteNullptr;
+  }
+  if (++epoch_ == 0) {
+    for (auto &slot : slots_) {
+      slot.pin_epoch = 0;
+    }
+    epoch_ = 1;
+  }
+
+  // the slots of the batch are looked up in parallel, and the frequency is updated in the batch order.
+  std::vector<int> batch_slots(batch_ids_len);
+  ParallelForBatch(thread_pool_, batch_ids_len, [this, batch_ids, &batch_slots](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      batch_slots[i] = InRange(batch_ids[i]) ? key_slots_[batch_ids[i] - min_host_index_] : kOutOfRange;
+    }
+  });
+
+  std::vector<int> miss_keys;
+  for (size_t i = 0; i < batch_ids_len; i++) {
+    int slot = batch_slots[i];
+    if (slot >= 0) {
+      IncreaseFrequency(slot);
+      slots_[slot].pin_epoch = epoch_;
+      cache_index[i] = slots_[slot].value;
+      continue;
+    }
+    if (slot == kOutOfRange) {
+      cache_index[i] = -1;
+      continue;
+    }
+    // the same key may miss several times in a batch, it is swapped in once.
+    int &key_slot = key_slots_[batch_ids[i] - min_host_index_];
+    if (key_slot == kNotCached) {
+      key_slot = kPendingBase - static_cast<int>(miss_keys.size());
+      miss_keys.push_back(batch_ids[i]);
+    }
+    batch_slots[i] = key_slot;
+  }
+  if (miss_keys.empty()) {
+    return kSuccess;
+  }
+
+  std::vector<int> swap_slots;
+  swap_slots.reserve(miss_keys.size());
+  if (!CollectSwapSlots(miss_keys.size(), &swap_slots)) {
+    MS_LOG(ERROR) << "need swap " << miss_keys.size() << " keys, but only " << swap_slots.size()
+                  << " slots can be swapped out, cache size " << cache_size_;
+    for (auto key : miss_keys) {
+      key_slots_[key - min_host_index_] = kNotCached;
+    }
+    return kLiteError;
+  }
+  need_swap_indies->reserve(need_swap_indies->size() + miss_keys.size());
+  need_swap_indies_cache_index->reserve(need_swap_indies_cache_index->size() + miss_keys.size());
+  for (size_t i = 0; i < miss_keys.size(); i++) {
+    int slot = swap_slots[i];
+    auto &node = slots_[slot];
+    UnlinkSlot(slot);
+    key_slots_[node.key - min_host_index_] = kNotCached;
+    node.key = miss_keys[i];
+    node.pin_epoch = epoch_;
+    key_slots_[node.key - min_host_index_] = slot;
+    InsertSlot(slot);
+    need_swap_indies->push_back(node.key);
+    need_swap_indies_cache_index->push_back(node.value);
+  }
+  for (size_t i = 0; i < batch_ids_len; i++) {
+    if (batch_slots[i] <= kPendingBase) {
+      cache_index[i] = slots_[swap_slots[kPendingBase - batch_slots[i]]].value;
+    }
+  }
+  return kSuccess;
+}
+}  // namespace cache
+}  // namespace mindspore
@@ -0,0 +1,82 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_FLAT_LFU_CACHE_H_
+#define MINDSPORE_LITE_FLAT_LFU_CACHE_H_
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "include/api/status.h"
+#include "src/delegate/parameter_cache/cache_algorithm.h"
+namespace mindspore {
+namespace cache {
+// run task(begin, end) on the chunks of [0, size), by the thread pool if it is set and the size is large enough.
+void ParallelForBatch(ThreadPool *thread_pool, size_t size, const std::function<void(size_t, size_t)> &task);
+
+// O(1) LFU over flat arrays: the slot of a key is found by key - min_host_index, the slots of the same frequency are
+// linked in a bucket and the buckets are linked by ascending frequency. nothing is allocated after Init.
+class FlatLFUCacheAlgorithm : public CacheAlgorithm {
+ public:
+  FlatLFUCacheAlgorithm() {}
+  ~FlatLFUCacheAlgorithm() override = default;
+
+  int Get(int key) override;
+  void Put(int key, int value) override;
+  Status Init(size_t cache_size, int min_host_index, int max_host_index) override;
+  Status CheckCacheHit(const int *batch_ids, const size_t batch_ids_len, int *cache_index,
+                       std::vector<int> *need_swap_indies, std::vector<int> *need_swap_indies_cache_index) override;
+
+ private:
+  struct Slot {
+    int key;
+    int value;
+    int bucket;
+    int prev;
+    int next;
+    uint32_t pin_epoch;  // the slots hit by the current batch can't be swapped out
+  };
+  struct Bucket {
+    int64_t frequency;
+    int head;  // the most recently used slot
+    int tail;
+    int prev;
+    int next;
+  };
+
+  bool InRange(int key) const { return key >= min_host_index_ && key < max_host_index_; }
+  int NewBucket(int64_t frequency, int prev);
+  void FreeBucket(int bucket);
+  void LinkSlot(int slot, int bucket);
+  void UnlinkSlot(int slot);
+  void IncreaseFrequency(int slot);
+  void InsertSlot(int slot);
+  bool CollectSwapSlots(size_t swap_size, std::vector<int> *swap_slots) const;
+
+  std::vector<int> key_slots_;  // key - min_host_index_ -> slot, negative if the key isn't cached
+  std::vector<Slot> slots_;
+  std::vector<Bucket> buckets_;
+  std::vector<int> free_buckets_;
+  int min_bucket_{-1};
+  uint32_t epoch_{0};
+  size_t cache_size_{0};
+
+  int min_host_index_{0};
+  int max_host_index_{1};
+};
+}  // namespace cache
+}  // namespace mindspore
+#endif  // MINDSPORE_LITE_FLAT_LFU_CACHE_H_
@@ -86,6 +86,7 @@ Status TensorRTDelegate::Init() {
     MS_LOG(ERROR) << "malloc EmbeddingCacheManager failed.";
     return kLiteMemoryFailed;
   }
+  cache_mgr_->set_thread_pool(thread_pool_);
   auto cache_ret = cache_mgr_->Init(cache_model_path_, vocab_size_, device_cache_size_);
   if (cache_ret != mindspore::kSuccess) {
     MS_LOG(ERROR) << "cache_mgr_ init failed.";
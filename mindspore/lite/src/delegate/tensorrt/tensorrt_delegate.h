@@ -45,6 +45,8 @@ class TensorRTDelegate : public Delegate {
 
   Status Build(DelegateModel<schema::Primitive> *model) override;
 
+  void set_thread_pool(ThreadPool *thread_pool) { thread_pool_ = thread_pool; }
+
  private:
   Status BuildSubGraph(DelegateModel<schema::Primitive> *model);
 
@@ -63,6 +65,7 @@ class TensorRTDelegate : public Delegate {
   size_t vocab_size_{0};
   size_t device_cache_size_{0};
   std::shared_ptr<cache::EmbeddingCacheManager> cache_mgr_{nullptr};
+  ThreadPool *thread_pool_{nullptr};
   const std::string serialize_path_;
   cudaStream_t stream_{nullptr};
 };
@@ -16,30 +16,67 @@
 
 #include "src/huffman_decode.h"
 #include <queue>
+#include <vector>
 
 namespace mindspore {
 namespace lite {
-STATUS HuffmanDecode::DoHuffmanDecode(const std::string &input_str, void *decoded_data, size_t data_len) {
-  if (decoded_data == nullptr) {
-    MS_LOG(ERROR) << "decoded_data is nullptr.";
+namespace {
+// the codes are decoded by looking up the leading bits, the longer codes go on from the node reached by them.
+constexpr int kHuffmanLookupBits = 10;
+constexpr size_t kHuffmanLookupSize = 1 << kHuffmanLookupBits;
+constexpr int kBitsOfByte = 8;
+constexpr int kBitBufferBits = 64;
+
+struct HuffmanLookupEntry {
+  HuffmanNodePtr node = nullptr;
+  // the code length of a leaf node, or 0 for a code longer than the lookup bits.
+  int code_len = 0;
+};
+
+bool IsLeaf(const HuffmanNodePtr &node) { return node->left == nullptr && node->right == nullptr; }
+
+void FillLookupTable(const HuffmanNodePtr &node, int depth, size_t prefix, std::vector<HuffmanLookupEntry> *table) {
+  if (node == nullptr) {
+    return;
+  }
+  if (IsLeaf(node) || depth == kHuffmanLookupBits) {
+    auto shift = kHuffmanLookupBits - depth;
+    auto begin = prefix << shift;
+    auto end = begin + (static_cast<size_t>(1) << shift);
+    for (auto i = begin; i < end; ++i) {
+      (*table)[i] = {node, IsLeaf(node) ? depth : 0};
+    }
+    return;
+  }
+  FillLookupTable(node->left, depth + 1, prefix << 1, table);
+  FillLookupTable(node->right, depth + 1, (prefix << 1) | 1, table);
+}
+}  // namespace
+
+STATUS HuffmanDecode::DoHuffmanDecode(const char *input_data, size_t input_len, void *decoded_data,
+                                      size_t data_len) {
+  if (input_data == nullptr || decoded_data == nullptr) {
+    MS_LOG(ERROR) << "input_data or decoded_data is nullptr.";
     return RET_ERROR;
   }
 
   int status;
-  std::string huffman_decoded_str;
-  auto key_pos = input_str.find_first_of('#');
-  auto code_pos = input_str.find_first_of('#', key_pos + 1);
-  if (key_pos == std::string::npos || code_pos == std::string::npos) {
-    MS_LOG(ERROR) << "not found '#' in input_str";
+  // only the keys and codes are copied, the encoded data is decoded in place.
+  auto key_end = static_cast<const char *>(memchr(input_data, '#', input_len));
+  if (key_end == nullptr) {
+    MS_LOG(ERROR) << "not found '#' in input_data";
     return RET_ERROR;
   }
-  if (key_pos + 1 > input_str.size() || code_pos + 1 > input_str.size()) {
-    MS_LOG(ERROR) << "pos extend input_str size.";
+  auto code_begin = key_end + 1;
+  auto code_end = static_cast<const char *>(memchr(code_begin, '#', input_len - (code_begin - input_data)));
+  if (code_end == nullptr) {
+    MS_LOG(ERROR) << "not found '#' in input_data";
     return RET_ERROR;
   }
-  auto key = input_str.substr(0, key_pos);
-  auto code = input_str.substr(key_pos + 1, code_pos - key_pos - 1);
-  auto encoded_data = input_str.substr(code_pos + 1);
+  std::string key(input_data, key_end - input_data);
+  std::string code(code_begin, code_end - code_begin);
+  auto encoded_data = code_end + 1;
+  size_t encoded_len = input_len - (encoded_data - input_data);
 
   auto root = new (std::nothrow) HuffmanNode();
   if (root == nullptr) {
@@ -53,23 +90,15 @@ STATUS HuffmanDecode::DoHuffmanDecode(const std::string &input_str, void *decode
   status = RebuildHuffmanTree(key, code, root);
   if (status != RET_OK) {
     MS_LOG(ERROR) << "Rebuild huffman tree failed.";
-    delete root;
+    FreeHuffmanNodeTree(root);
     return status;
   }
 
-  status = DoHuffmanDecompress(root, encoded_data, &huffman_decoded_str);
+  status = DoHuffmanDecompress(root, encoded_data, encoded_len, static_cast<char *>(decoded_data), data_len);
   if (status != RET_OK) {
     MS_LOG(ERROR) << "DoHuffmanDecompress failed.";
-    delete root;
-    return status;
-  }
-
-  size_t len = huffman_decoded_str.length();
-  if (data_len >= len) {
-    memcpy(decoded_data, huffman_decoded_str.c_str(), len);
-  } else {
     FreeHuffmanNodeTree(root);
-    return RET_ERROR;
+    return status;
   }
   FreeHuffmanNodeTree(root);
   return RET_OK;
@@ -131,38 +160,64 @@ STATUS HuffmanDecode::RebuildHuffmanTree(std::string keys, std::string codes, co
   return RET_OK;
 }
 
-STATUS HuffmanDecode::DoHuffmanDecompress(HuffmanNodePtr root, std::string encoded_data, std::string *decoded_str) {
-  HuffmanNodePtr cur_node = root;
-  bool pseudo_eof = false;
+STATUS HuffmanDecode::DoHuffmanDecompress(HuffmanNodePtr root, const char *encoded_data, size_t encoded_len,
+                                          char *decoded_data, size_t data_len) {
+  if (IsLeaf(root)) {
+    MS_LOG(ERROR) << "the huffman tree is empty.";
+    return RET_ERROR;
+  }
+  std::vector<HuffmanLookupEntry> lookup_table(kHuffmanLookupSize);
+  FillLookupTable(root, 0, 0, &lookup_table);
+
+  // the bits are consumed from the highest bit of the buffer.
+  uint64_t bit_buffer = 0;
+  int bit_count = 0;
   size_t pos = 0;
-  unsigned char flag;
-
-  decoded_str->clear();
-  while (pos < encoded_data.length()) {
-    auto u_char = static_cast<unsigned char>(encoded_data[pos]);
-    flag = 0x80;
-    for (size_t i = 0; i < 8; ++i) {  // traverse the 8 bit num, to find the leaf node
-      if (u_char & flag) {
-        cur_node = cur_node->right;
-      } else {
-        cur_node = cur_node->left;
-      }
-      if (cur_node->left == nullptr && cur_node->right == nullptr) {
-        auto key = cur_node->key;
-        if (key == PSEUDO_EOF) {
-          pseudo_eof = true;
+  auto refill = [&]() {
+    while (bit_count <= kBitBufferBits - kBitsOfByte && pos < encoded_len) {
+      bit_buffer |= static_cast<uint64_t>(static_cast<unsigned char>(encoded_data[pos++]))
+                    << (kBitBufferBits - kBitsOfByte - bit_count);
+      bit_count += kBitsOfByte;
+    }
+  };
+  size_t decoded_len = 0;
+  while (true) {
+    refill();
+    if (bit_count == 0) {
+      break;
+    }
+    HuffmanNodePtr cur_node = root;
+    if (bit_count >= kHuffmanLookupBits) {
+      const auto &entry = lookup_table[bit_buffer >> (kBitBufferBits - kHuffmanLookupBits)];
+      auto code_len = entry.code_len > 0 ? entry.code_len : kHuffmanLookupBits;
+      cur_node = entry.node;
+      bit_buffer <<= code_len;
+      bit_count -= code_len;
+    }
+    // the codes longer than the lookup bits and the tail of the encoded data are decoded bit by bit.
+    while (cur_node != nullptr && !IsLeaf(cur_node)) {
+      if (bit_count == 0) {
+        refill();
+        if (bit_count == 0) {
           break;
-        } else {
-          *decoded_str += static_cast<char>(cur_node->key);
-          cur_node = root;
         }
       }
-      flag = flag >> 1;
+      cur_node = (bit_buffer >> (kBitBufferBits - 1)) != 0 ? cur_node->right : cur_node->left;
+      bit_buffer <<= 1;
+      bit_count--;
+    }
+    if (cur_node == nullptr) {
+      MS_LOG(ERROR) << "the huffman code is invalid.";
+      return RET_ERROR;
     }
-    pos++;
-    if (pseudo_eof) {
+    if (!IsLeaf(cur_node) || cur_node->key == PSEUDO_EOF) {
       break;
     }
+    if (decoded_len >= data_len) {
+      MS_LOG(ERROR) << "the decoded data exceeds the data len " << data_len;
+      return RET_ERROR;
+    }
+    decoded_data[decoded_len++] = static_cast<char>(cur_node->key);
   }
   return RET_OK;
 }
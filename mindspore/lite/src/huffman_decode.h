@@ -44,7 +44,7 @@ class HuffmanDecode {
  public:
   virtual ~HuffmanDecode() = default;
 
-  static STATUS DoHuffmanDecode(const std::string &input_str, void *decoded_data, size_t data_len);
+  static STATUS DoHuffmanDecode(const char *input_data, size_t input_len, void *decoded_data, size_t data_len);
 
  private:
   HuffmanDecode() = default;
@@ -53,7 +53,8 @@ class HuffmanDecode {
 
   static STATUS RebuildHuffmanTree(std::string key, std::string code, const HuffmanNodePtr &root);
 
-  static STATUS DoHuffmanDecompress(HuffmanNodePtr root, std::string encoded_data, std::string *decoded_str);
+  static STATUS DoHuffmanDecompress(HuffmanNodePtr root, const char *encoded_data, size_t encoded_len,
+                                    char *decoded_data, size_t data_len);
 
   static std::vector<std::string> Str2Vec(std::string s) {
     size_t i = 0;
@@ -30,6 +30,11 @@
 #include "src/runtime/gpu/opencl/opencl_runtime.h"
 #endif
 #include "nnacl/kernel.h"
+#ifdef ENABLE_AVX512
+#include "nnacl/errorcode.h"
+#include "nnacl/fp32/matmul_avx512_bf16_fp32.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
 #include "src/runtime/inner_allocator.h"
 #include "experimental/src/exec_env_utils.h"
 
@@ -46,6 +51,9 @@ void InnerContext::InitDeviceFp16() {
 #else
   device_and_pkg_support_fp16_ = false;
 #endif
+#if defined(ENABLE_AVX512) && defined(ENABLE_AVX512_BF16)
+  device_and_pkg_support_bf16_ = IntelX86CpuInfoInit() == NNACL_OK && X86_Avx512_Bf16_Support();
+#endif
 }
 
 InnerContext::InnerContext(const Context *context) {
@@ -247,6 +255,16 @@ bool InnerContext::IsCpuFloat16Enabled() const {
   return GetDeviceInfo(DT_CPU).cpu_device_info_.enable_float16_;
 }
 
+bool InnerContext::IsCpuBFloat16Enabled() const {
+  if (!IsDeviceTypeEnabled(DT_CPU)) {
+    return false;
+  }
+  if (!device_and_pkg_support_bf16_) {
+    return false;
+  }
+  return enable_cpu_bf16_;
+}
+
 bool InnerContext::IsGpuFloat16Enabled() const {
 #ifdef GPU_OPENCL
   if (!IsDeviceTypeEnabled(DT_GPU)) {
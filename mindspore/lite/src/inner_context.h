@@ -45,6 +45,9 @@ struct InnerContext : public Context {
 
   bool IsCpuFloat16Enabled() const;
 
+  // On x86 cpus supporting bf16, the fp32 matmul is computed in bfloat16 only if enable_cpu_bf16_ is set.
+  bool IsCpuBFloat16Enabled() const;
+
   bool IsGpuFloat16Enabled() const;
 
   bool IsGLTextureEnabled() const;
@@ -77,6 +80,9 @@ struct InnerContext : public Context {
 
   void ReplaceLinkInfoSenderWithNewOne(void *new_sender, void *old_sender);
 
+  // bfloat16 is less precise than float32, so it's never chosen by enable_float16_ but only by the config.
+  bool enable_cpu_bf16_ = false;
+
  private:
   bool IsAllDeviceTypeValid() const;
 
@@ -92,6 +98,8 @@ struct InnerContext : public Context {
 
   bool device_and_pkg_support_fp16_ = false;
 
+  bool device_and_pkg_support_bf16_ = false;
+
 #ifdef BFC_MEMORY
   int node_id_ = -1;
 #endif
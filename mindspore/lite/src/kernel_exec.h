@@ -182,6 +182,22 @@ class KernelExec {
     return false;
   }
 
+  virtual ResizeStatePtr SaveResizeState() const {
+    MS_ASSERT(kernel_ != nullptr);
+    if (desc_.provider == kBuiltin) {
+      return std::static_pointer_cast<LiteKernel>(kernel_)->SaveResizeState();
+    }
+    return nullptr;
+  }
+
+  virtual int RestoreResizeState(const ResizeState &state) {
+    MS_ASSERT(kernel_ != nullptr);
+    if (desc_.provider == kBuiltin) {
+      return std::static_pointer_cast<LiteKernel>(kernel_)->RestoreResizeState(state);
+    }
+    return mindspore::lite::RET_ERROR;
+  }
+
   int DoExecute();
 
   void set_is_model_output(bool is_model_output) { this->is_model_output_ = is_model_output; }
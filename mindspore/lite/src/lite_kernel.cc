@@ -23,6 +23,12 @@
 namespace mindspore::kernel {
 using mindspore::lite::RET_ERROR;
 using mindspore::lite::RET_OK;
+namespace {
+struct ThreadNumState : public ResizeState {
+  explicit ThreadNumState(int num) : thread_num(num) {}
+  int thread_num;
+};
+}  // namespace
 
 void LiteKernel::AllocWorkspace() {
   workspace_ = malloc(workspace_size());
@@ -101,6 +107,14 @@ int LiteKernel::UpdateThreadNumPass(int32_t kernel_type, int64_t per_unit_load_n
   return lite::RET_OK;
 }
 
+ResizeStatePtr LiteKernel::SaveThreadNum() const { return std::make_shared<ThreadNumState>(thread_num_); }
+
+// the state is saved by SaveThreadNum() of the same kernel.
+int LiteKernel::RestoreThreadNum(const ResizeState &state) {
+  thread_num_ = static_cast<const ThreadNumState &>(state).thread_num;
+  return RET_OK;
+}
+
 int LiteKernel::Execute() {
   auto ret = PreProcess();
   if (lite::RET_OK != ret) {
@@ -34,6 +34,12 @@
 #include "src/thread_cost_model.h"
 
 namespace mindspore::kernel {
+// what ReSize() of a kernel works out from the tensor shapes, kept by the resize plan cache of the session.
+struct ResizeState {
+  virtual ~ResizeState() = default;
+};
+using ResizeStatePtr = std::shared_ptr<ResizeState>;
+
 class LiteKernel : public Kernel {
  public:
   LiteKernel() = default;
@@ -71,6 +77,10 @@ class LiteKernel : public Kernel {
                                      int64_t unit_num);
   int UpdateThreadNumPass(int32_t kernel_type, int64_t per_unit_load_num, int64_t per_unit_store_num, int64_t unit_num);
 
+  // the resize state of the current shapes, nullptr if the kernel can't restore it and has to be resized again.
+  virtual ResizeStatePtr SaveResizeState() const { return nullptr; }
+  virtual int RestoreResizeState(const ResizeState &state) { return mindspore::lite::RET_ERROR; }
+
   virtual bool CheckInputsValid() const { return true; }
 
   virtual bool CheckParamsValid() const { return true; }
@@ -191,6 +201,10 @@ class LiteKernel : public Kernel {
   bool ws_allocated_ = false;
 
  protected:
+  // for the kernels whose ReSize() only works out the thread num.
+  ResizeStatePtr SaveThreadNum() const;
+  int RestoreThreadNum(const ResizeState &state);
+
   OpParameter *op_parameter_ = nullptr;
   // tensor will free in ~lite_session()
   std::vector<lite::Tensor *> in_tensors_;
@@ -16,6 +16,10 @@
 
 #include "src/lite_session.h"
 #include <set>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <unordered_set>
 #include "src/pack_weight_manager.h"
 #include "src/runtime/runtime_pass.h"
 #if defined(LINUX_RUNTIME)
@@ -222,6 +226,44 @@ lite::Tensor *LiteSession::ConvertTensor(const schema::Tensor &src_tensor) {
   return dst_tensor;
 }
 
+int LiteSession::DecodeTensorsData(const lite::LiteModel *model, const std::vector<lite::Tensor *> &dst_tensors) {
+  MS_ASSERT(model != nullptr);
+  // the largest tensors are decoded first, so that the decoding threads finish at about the same time.
+  std::vector<size_t> order(dst_tensors.size());
+  std::iota(order.begin(), order.end(), 0);
+  auto data_length = [model](size_t index) {
+    auto src_tensor = model->GetSchemaTensor(index);
+    return src_tensor == nullptr ? 0 : src_tensor->length();
+  };
+  std::stable_sort(order.begin(), order.end(),
+                   [&data_length](size_t a, size_t b) { return data_length(a) > data_length(b); });
+
+  std::atomic<size_t> next_index(0);
+  std::atomic<int> decode_ret(RET_OK);
+  auto decode_func = [&](void *, int, float, float) {
+    for (auto i = next_index++; i < order.size() && decode_ret == RET_OK; i = next_index++) {
+      auto ret = ConvertTensorsData(model, order[i], dst_tensors[order[i]]);
+      if (ret != RET_OK) {
+        MS_LOG(ERROR) << "Convert data of " << order[i] << "th tensor failed";
+        decode_ret = ret;
+      }
+    }
+    return RET_OK;
+  };
+  auto thread_num = context_->thread_pool() == nullptr ? 1 : static_cast<int>(context_->thread_pool()->thread_num());
+  auto task_num = std::min(thread_num, static_cast<int>(dst_tensors.size()));
+  if (task_num <= 1) {
+    (void)decode_func(nullptr, 0, 0, 0);
+  } else {
+    auto ret = ParallelLaunch(context_, decode_func, nullptr, task_num);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "Decode tensors data in parallel failed: " << ret;
+      return ret;
+    }
+  }
+  return decode_ret;
+}
+
 int LiteSession::ConvertTensors(const lite::Model *model) {
   MS_ASSERT(model != nullptr);
   auto lite_model = reinterpret_cast<const lite::LiteModel *>(model);
@@ -229,23 +271,38 @@ int LiteSession::ConvertTensors(const lite::Model *model) {
   auto model_input_indices = model->input_indices_;
   auto model_output_indices = model->output_indices_;
 
+  std::vector<lite::Tensor *> dst_tensors(tensor_count, nullptr);
+  auto free_dst_tensors = [&dst_tensors](size_t begin) {
+    for (auto i = begin; i < dst_tensors.size(); ++i) {
+      delete dst_tensors[i];
+      dst_tensors[i] = nullptr;
+    }
+  };
   for (uint32_t i = 0; i < tensor_count; ++i) {
     auto *src_tensor = model->all_tensors_[i];
     if (src_tensor == nullptr) {
       MS_LOG(ERROR) << i << "th tensor in model is nullptr";
+      free_dst_tensors(0);
       return RET_NULL_PTR;
     }
-    auto *dst_tensor = ConvertTensor(*src_tensor);
-    if (dst_tensor == nullptr) {
+    dst_tensors[i] = ConvertTensor(*src_tensor);
+    if (dst_tensors[i] == nullptr) {
       MS_LOG(ERROR) << "Convert new " << i << "th tensor failed!";
+      free_dst_tensors(0);
       return RET_NULL_PTR;
     }
-    auto ret = ConvertTensorsData(lite_model, i, dst_tensor);
-    if (ret != RET_OK) {
-      MS_LOG(ERROR) << "Convert data of " << i << "th tensor failed";
-      delete dst_tensor;
-      return ret;
-    }
+  }
+  // the weights are decoded by the thread pool, which saves much loading time for the compressed models.
+  auto ret = DecodeTensorsData(lite_model, dst_tensors);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Decode tensors data failed: " << ret;
+    free_dst_tensors(0);
+    return ret;
+  }
+
+  for (uint32_t i = 0; i < tensor_count; ++i) {
+    auto *src_tensor = model->all_tensors_[i];
+    auto *dst_tensor = dst_tensors[i];
     ConvertTensorsQuantParam(src_tensor, dst_tensor);
     if (IsContain(model_input_indices, i)) {
       dst_tensor->set_category(Category::GRAPH_INPUT);
@@ -260,7 +317,7 @@ int LiteSession::ConvertTensors(const lite::Model *model) {
     ret = CheckTensorValid(dst_tensor);
     if (ret != RET_OK) {
       MS_LOG(ERROR) << "Check " << i << "th tensor failed";
-      delete dst_tensor;
+      free_dst_tensors(i);
       return ret;
     }
 
@@ -546,6 +603,12 @@ int LiteSession::CompileGraph(Model *model) {
                       &is_control_flow_, execution_plan_, delegate_, delegate_device_type_);
   scheduler.SetupSchedulerCb(std::move(sched_cb_));
   scheduler.SetConfig(config_info_);
+#ifndef AUTO_PARALLEL_CLIP
+  InitSubGraphProfile();
+  if (sub_graph_profile_ != nullptr && sub_graph_profile_->loaded()) {
+    scheduler.SetSubGraphProfile(sub_graph_profile_.get());
+  }
+#endif
   ret = scheduler.Schedule(&kernels_);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "Schedule kernels failed: " << ret;
@@ -562,6 +625,7 @@ int LiteSession::CompileGraph(Model *model) {
     is_running_.store(false);
     return ret;
   }
+  InitResizePlanCache();
 
   if (is_train_session_) {
     is_running_.store(false);
@@ -729,7 +793,19 @@ int LiteSession::RunGraph(const KernelCallBack &before, const KernelCallBack &af
     return ret;
   }
   MS_ASSERT(this->context_ != nullptr);
+#ifndef AUTO_PARALLEL_CLIP
+  if (sub_graph_profile_ != nullptr && sub_graph_profile_->IsCollecting()) {
+    ret = executor_->Run(this->inputs_, this->outputs_, this->kernels_, sub_graph_profile_->WrapBefore(before),
+                         sub_graph_profile_->WrapAfter(after));
+    if (ret == RET_OK) {
+      (void)sub_graph_profile_->EndRun();
+    }
+  } else {
+    ret = executor_->Run(this->inputs_, this->outputs_, this->kernels_, before, after);
+  }
+#else
   ret = executor_->Run(this->inputs_, this->outputs_, this->kernels_, before, after);
+#endif
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "RunGraph failed : " << ret;
   }
@@ -750,6 +826,7 @@ int LiteSession::ContextInit(InnerContext *context) {
     return ret;
   }
 
+  InitCpuBFloat16();
   ms_context_ = MSContextFromContext(context);
   if (ms_context_ == nullptr) {
     MS_LOG(ERROR) << "transfer context to ms context failed.";
@@ -801,12 +878,15 @@ int LiteSession::CreateTensorRTDelegate() {
     }
   }
 
-  delegate_ =
+  auto tensorrt_delegate =
     std::make_shared<TensorRTDelegate>(ms_context_, cache_model_path, vocab_size, device_cache_size, serialize_path);
-  if (delegate_ == nullptr) {
+  if (tensorrt_delegate == nullptr) {
     MS_LOG(ERROR) << "New tensorrt delegate_ failed";
     return RET_ERROR;
   }
+  // the embedding cache looks up the large batches on the thread pool of the session.
+  tensorrt_delegate->set_thread_pool(context_->thread_pool());
+  delegate_ = tensorrt_delegate;
   delegate_device_type_ = DT_GPU;
   this->context_->delegate = delegate_;
 #endif
@@ -1178,28 +1258,53 @@ int LiteSession::Resize(const std::vector<mindspore::tensor::MSTensor *> &inputs
     return ret;
   }
 
-  ret = ReSizeKernels(kernels_, isolate_input_map_);
-  if (ret != RET_OK) {
-    ResetInputsShape(old_dims);
-    auto resize_ret = ReSizeKernels(kernels_);
-    if (resize_ret != RET_OK) {
-      MS_LOG(ERROR) << "restore kernel size fail!ret: " << resize_ret;
+  ResizePlanPtr plan = nullptr;
+  if (resize_plan_cache_ != nullptr) {
+    plan = resize_plan_cache_->Find(dims);
+    if (plan != nullptr && ApplyResizePlan(plan) != RET_OK) {
+      MS_LOG(WARNING) << "Apply the cached resize plan failed, resize the kernels again.";
+      resize_plan_cache_->Clear();
+      plan = nullptr;
     }
-    is_running_.store(false);
-    return ret;
   }
+  if (plan == nullptr) {
+    ret = ReSizeKernels(kernels_, isolate_input_map_);
+    if (ret != RET_OK) {
+      ResetInputsShape(old_dims);
+      auto resize_ret = ReSizeKernels(kernels_);
+      if (resize_ret != RET_OK) {
+        MS_LOG(ERROR) << "restore kernel size fail!ret: " << resize_ret;
+      }
+      is_running_.store(false);
+      return ret;
+    }
 
-  if (RuntimeAllocatorInit() != RET_OK) {
-    MS_LOG(ERROR) << "Runtime allocator in resize failed.";
-    is_running_.store(false);
-    return RET_ERROR;
+    if (resize_plan_cache_ != nullptr) {
+      // the memory plan of the last shape may be cached, it is kept and a new one is made.
+      RuntimeAllocatorDetach();
+      runtime_allocator_ = nullptr;
+    }
+    if (RuntimeAllocatorInit() != RET_OK) {
+      MS_LOG(ERROR) << "Runtime allocator in resize failed.";
+      is_running_.store(false);
+      return RET_ERROR;
+    }
   }
 
+  auto graph_version = GraphVersion();
   auto status = GraphOptimizePass(&kernels_);
   if (status != RET_OK) {
     MS_LOG(ERROR) << "GraphOptimizePass failed.";
     return RET_ERROR;
   }
+  if (resize_plan_cache_ != nullptr) {
+    if (GraphVersion() != graph_version) {
+      // the cached plans are made for the graph before the optimization.
+      resize_plan_cache_->Clear();
+    } else if (plan == nullptr) {
+      resize_plan_cache_->Insert(dims, RecordResizePlan());
+    }
+  }
 
   is_running_.store(false);
 #if defined(LINUX_RUNTIME)
@@ -1407,6 +1512,23 @@ void LiteSession::RuntimeAllocatorInitSubgraph() {
   return;
 }
 
+void LiteSession::RuntimeAllocatorDetach() {
+  if (runtime_allocator_ == nullptr) {
+    return;
+  }
+  AllocatorPtr default_allocator = context_->allocator;
+  for (auto &iter : runtime_allocator_->GetOffsetMap()) {
+    iter.first->set_allocator(default_allocator);
+    iter.first->set_data(nullptr);
+  }
+  for (auto &graph_out : isolate_graph_output_map_) {
+    if (graph_out.second->allocator() == runtime_allocator_) {
+      graph_out.second->set_allocator(default_allocator);
+      graph_out.second->set_data(nullptr);
+    }
+  }
+}
+
 int LiteSession::RuntimeAllocatorInit() {
   if (RuntimeAllocatorValid() != RET_OK) {
     return RET_OK;
@@ -1423,6 +1545,7 @@ int LiteSession::RuntimeAllocatorInit() {
     MS_LOG(ERROR) << "RuntimeAllocator is null.";
     return RET_ERROR;
   }
+  runtime_allocator_->set_arena(runtime_arena_);
 
   RuntimeAllocatorInitSubgraph();
 
@@ -1455,6 +1578,160 @@ int LiteSession::RuntimeAllocatorSetData() {
   return RET_OK;
 }
 
+void LiteSession::InitResizePlanCache() {
+  if (config_info_ == nullptr) {
+    return;
+  }
+  auto section = config_info_->find(kResizePlanCache);
+  if (section == config_info_->end()) {
+    return;
+  }
+  auto cache_size_iter = section->second.find(kResizePlanCacheSize);
+  if (cache_size_iter == section->second.end()) {
+    return;
+  }
+  auto cache_size = GenericParseValue<size_t>(cache_size_iter->second);
+  if (cache_size.IsNone() || cache_size.Get() == 0) {
+    MS_LOG(WARNING) << "Invalid " << kResizePlanCacheSize << " of " << kResizePlanCache << ": "
+                    << cache_size_iter->second << ", the resize plan cache is disabled.";
+    return;
+  }
+  if (!ResizePlanCacheValid()) {
+    MS_LOG(INFO) << "The resize plan cache is not supported by the graph.";
+    return;
+  }
+  resize_plan_cache_ = std::make_unique<ResizePlanCache>(cache_size.Get());
+  runtime_arena_ = std::make_shared<RuntimeArena>();
+}
+
+void LiteSession::InitCpuBFloat16() {
+  context_->enable_cpu_bf16_ = false;
+  if (config_info_ == nullptr) {
+    return;
+  }
+  auto section = config_info_->find(kCpuBFloat16);
+  if (section == config_info_->end()) {
+    return;
+  }
+  auto enable_iter = section->second.find(kCpuBFloat16Enable);
+  if (enable_iter == section->second.end()) {
+    return;
+  }
+  context_->enable_cpu_bf16_ = enable_iter->second == "true";
+  MS_LOG(INFO) << "The bfloat16 matmul is " << (context_->IsCpuBFloat16Enabled() ? "enabled." : "disabled.");
+}
+
+#ifndef AUTO_PARALLEL_CLIP
+void LiteSession::InitSubGraphProfile() {
+  sub_graph_profile_ = nullptr;
+  // the kernels are only timed and the profile is only written when the file is configured.
+  if (!context_->enable_parallel_ || is_train_session_ || config_info_ == nullptr) {
+    return;
+  }
+  auto section = config_info_->find(kSubGraphProfile);
+  if (section == config_info_->end()) {
+    return;
+  }
+  auto file_iter = section->second.find(kSubGraphProfileFile);
+  if (file_iter == section->second.end() || file_iter->second.empty()) {
+    return;
+  }
+  const auto &profile_file = file_iter->second;
+  sub_graph_profile_ = std::make_unique<SubGraphProfile>(profile_file);
+  if (sub_graph_profile_->Load() == RET_OK) {
+    MS_LOG(INFO) << "The subgraph split is guided by the profile " << profile_file;
+  }
+}
+#endif
+
+bool LiteSession::ResizePlanCacheValid() const {
+  if (is_control_flow_) {
+    return false;
+  }
+  // the gpu subgraphs resize the kernels with the device memory together.
+  return std::all_of(kernels_.begin(), kernels_.end(), [](const kernel::KernelExec *kernel) {
+    return kernel->desc().arch != kernel::kDelegate && kernel->subgraph_type() != kernel::kGpuFp16SubGraph &&
+           kernel->subgraph_type() != kernel::kGpuFp32SubGraph;
+  });
+}
+
+size_t LiteSession::GraphVersion() const {
+  size_t graph_version = 0;
+  for (auto kernel : kernels_) {
+    graph_version += reinterpret_cast<kernel::SubGraphKernel *>(kernel)->graph_version();
+  }
+  return graph_version;
+}
+
+ResizePlanPtr LiteSession::RecordResizePlan() const {
+  auto plan = std::make_shared<ResizePlan>();
+  std::unordered_set<Tensor *> recorded;
+  auto record = [&plan, &recorded](const std::vector<Tensor *> &tensors) {
+    for (auto tensor : tensors) {
+      if (tensor->IsConst() || !recorded.insert(tensor).second) {
+        continue;
+      }
+      plan->tensor_shapes.emplace_back(tensor, tensor->shape());
+    }
+  };
+  for (auto kernel : kernels_) {
+    auto subgraph = reinterpret_cast<kernel::SubGraphKernel *>(kernel);
+    record(subgraph->in_tensors());
+    record(subgraph->out_tensors());
+    for (auto node : subgraph->nodes()) {
+      record(node->in_tensors());
+      record(node->out_tensors());
+      auto state = node->SaveResizeState();
+      if (state != nullptr) {
+        plan->kernel_states[node] = state;
+      }
+    }
+  }
+  for (auto &shape : plan->tensor_shapes) {
+    if (std::any_of(shape.second.begin(), shape.second.end(), [](int dim) { return dim < 0; })) {
+      MS_LOG(DEBUG) << "The shape of " << shape.first->tensor_name() << " is inferred at runtime, not cached.";
+      return nullptr;
+    }
+  }
+  plan->runtime_allocator = runtime_allocator_;
+  if (runtime_allocator_ != nullptr) {
+    for (auto &iter : runtime_allocator_->GetOffsetMap()) {
+      plan->runtime_allocator_tensors.push_back(iter.first);
+    }
+    for (auto &graph_out : isolate_graph_output_map_) {
+      if (graph_out.second->allocator() == runtime_allocator_) {
+        plan->runtime_allocator_tensors.push_back(graph_out.second);
+      }
+    }
+  }
+  return plan;
+}
+
+int LiteSession::ApplyResizePlan(const ResizePlanPtr &plan) {
+  for (auto &shape : plan->tensor_shapes) {
+    shape.first->set_shape(shape.second);
+  }
+  for (auto kernel : kernels_) {
+    auto ret = reinterpret_cast<kernel::SubGraphKernel *>(kernel)->ReSizeNodes(plan->kernel_states);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "ReSize node " << kernel->name() << " failed";
+      return ret;
+    }
+  }
+  if (plan->runtime_allocator == runtime_allocator_) {
+    return RET_OK;
+  }
+  RuntimeAllocatorDetach();
+  runtime_allocator_ = plan->runtime_allocator;
+  if (runtime_allocator_ == nullptr) {
+    return RET_OK;
+  }
+  for (auto tensor : plan->runtime_allocator_tensors) {
+    tensor->set_allocator(runtime_allocator_);
+  }
+  return RuntimeAllocatorSetData();
+}
+
 int LiteSession::InitGPURuntime() {
   if (context_->IsDeviceTypeEnabled(DT_CPU)) {
     CpuBindMode cpu_bind_mode = context_->GetDeviceInfo(DT_CPU).cpu_device_info_.cpu_bind_mode_;
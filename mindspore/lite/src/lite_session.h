@@ -29,6 +29,7 @@
 #include "src/lite_model.h"
 #include "src/inner_context.h"
 #include "src/runtime/runtime_allocator.h"
+#include "src/runtime/resize_plan_cache.h"
 #include "schema/model_generated.h"
 #include "src/executor.h"
 #include "src/tensor.h"
@@ -38,6 +39,9 @@
 #include "src/runtime/gpu/opencl/opencl_runtime.h"
 #endif
 #include "src/scheduler_cb.h"
+#ifndef AUTO_PARALLEL_CLIP
+#include "src/sub_graph_profile.h"
+#endif
 
 namespace mindspore {
 namespace lite {
@@ -83,11 +87,15 @@ class LiteSession : public session::LiteSession {
     config_info_ = config_info;
   }
   const std::vector<Tensor *> &GetTensors() const { return this->tensors_; }
+  // nullptr if the resize plan cache isn't enabled by the config.
+  ResizePlanCache *resize_plan_cache() const { return this->resize_plan_cache_.get(); }
+  const RuntimeArena *runtime_arena() const { return this->runtime_arena_.get(); }
 
  protected:
   static void ConvertTensorsQuantParam(const schema::Tensor *src_tensor, lite::Tensor *dst_tensor);
   int CheckTensorValid(lite::Tensor *dst_tensor);
   int ConvertTensorsData(const lite::LiteModel *model, size_t tensor_index, lite::Tensor *dst_tensor);
+  int DecodeTensorsData(const lite::LiteModel *model, const std::vector<lite::Tensor *> &dst_tensors);
   lite::Tensor *ConvertTensor(const schema::Tensor &src_tensor);
   int ConvertTensors(const lite::Model *model);
   void InitGraphInOutTensorsMap(const lite::Model *model);
@@ -134,8 +142,29 @@ class LiteSession : public session::LiteSession {
   void RuntimeAllocatorInitGraphOutput();
   void RuntimeAllocatorInitSubgraph();
   virtual int RuntimeAllocatorValid();
+  void RuntimeAllocatorDetach();
   RuntimeAllocatorPtr runtime_allocator_ = nullptr;
 
+ private:
+  void InitResizePlanCache();
+  void InitCpuBFloat16();
+  bool ResizePlanCacheValid() const;
+  // sum of the versions of the subgraphs, changes whenever a node is added or removed after the graph is compiled.
+  size_t GraphVersion() const;
+  ResizePlanPtr RecordResizePlan() const;
+  int ApplyResizePlan(const ResizePlanPtr &plan);
+  // shape signature -> inferred shapes and memory plan, nullptr if the cache isn't enabled by the config.
+  std::unique_ptr<ResizePlanCache> resize_plan_cache_ = nullptr;
+  // the memory block of the runtime allocators of the cached plans.
+  RuntimeArenaPtr runtime_arena_ = nullptr;
+
+#ifndef AUTO_PARALLEL_CLIP
+ private:
+  void InitSubGraphProfile();
+  // node latency which guides the parallel subgraph split, collected by the first runs if there's no profile file.
+  std::unique_ptr<SubGraphProfile> sub_graph_profile_ = nullptr;
+#endif
+
  protected:
   InnerContext *context_ = nullptr;
   mindspore::Context *ms_context_ = nullptr;
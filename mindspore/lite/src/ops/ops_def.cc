@@ -228,6 +228,7 @@ OP_TYPE(NLLLoss)
 OP_TYPE(NLLLossGrad)
 OP_TYPE(FormatTranspose)
 OP_TYPE(GatherD)
+OP_TYPE(ScaledDotProductAttention)
 OP_TYPE_DEF_END(PrimitiveType)
 
 OP_SCHEMA_DEF(Abs)
@@ -1276,3 +1277,8 @@ OP_SCHEMA_DEF_END(FormatTranspose)
 
 OP_SCHEMA_DEF(GatherD)
 OP_SCHEMA_DEF_END(GatherD)
+
+OP_SCHEMA_DEF(ScaledDotProductAttention)
+OP_ATTR(scale, float)
+OP_ATTR_WITH_VALUE(is_causal, bool, false)
+OP_SCHEMA_DEF_END(ScaledDotProductAttention)
@@ -258,6 +258,7 @@
 #include "ops/grad/nllloss_grad.h"
 #include "ops/format_transpose.h"
 #include "ops/gather_d.h"
+#include "ops/scaled_dot_product_attention.h"
 
 namespace mindspore::lite::ops {
 #define FUNC_MSOP2SCHEMAOP_DECLARE(OP) std::unique_ptr<schema::PrimitiveT> MSOp2SchemaOp(const mindspore::ops::OP *op);
@@ -483,6 +484,7 @@ FUNC_MSOP2SCHEMAOP_DECLARE(NLLLoss)
 FUNC_MSOP2SCHEMAOP_DECLARE(NLLLossGrad)
 FUNC_MSOP2SCHEMAOP_DECLARE(FormatTranspose)
 FUNC_MSOP2SCHEMAOP_DECLARE(GatherD)
+FUNC_MSOP2SCHEMAOP_DECLARE(ScaledDotProductAttention)
 #endif
 }  // namespace mindspore::lite::ops
 #else
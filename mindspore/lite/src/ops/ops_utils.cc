@@ -269,6 +269,7 @@ REG_MINDSPORE_OPERATOR(NLLLoss)
 REG_MINDSPORE_OPERATOR(NLLLossGrad)
 REG_MINDSPORE_OPERATOR(FormatTranspose)
 REG_MINDSPORE_OPERATOR(GatherD)
+REG_MINDSPORE_OPERATOR(ScaledDotProductAttention)
 }  // namespace lite
 }  // namespace mindspore
 
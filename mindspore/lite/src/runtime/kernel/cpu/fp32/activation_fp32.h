@@ -38,6 +38,8 @@ class ActivationCPUKernel : public LiteKernel {
 
   int Prepare() override;
   int ReSize() override;
+  ResizeStatePtr SaveResizeState() const override { return SaveThreadNum(); }
+  int RestoreResizeState(const ResizeState &state) override { return RestoreThreadNum(state); }
   int Run() override;
   int DoActivation(int task_id);
 
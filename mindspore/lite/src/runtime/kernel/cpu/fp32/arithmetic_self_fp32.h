@@ -51,6 +51,8 @@ class ArithmeticSelfCPUKernel : public LiteKernel {
 
   int Prepare() override;
   int ReSize() override;
+  ResizeStatePtr SaveResizeState() const override { return SaveThreadNum(); }
+  int RestoreResizeState(const ResizeState &state) override { return RestoreThreadNum(state); }
   int Run() override;
   virtual int DoExecute(int task_id);
 
@@ -16,6 +16,8 @@
 
 #include "src/runtime/kernel/cpu/fp32/fullconnection_fp32.h"
 #include "src/kernel_registry.h"
+#include "src/runtime/kernel/cpu/fp32/matmul_weight_quant_fp32.h"
+#include "src/weight_decoder.h"
 
 using mindspore::kernel::KERNEL_ARCH;
 using mindspore::lite::KernelRegistrar;
@@ -75,5 +77,16 @@ int FullconnectionCPUKernel::ReSize() {
   return MatmulFp32BaseCPUKernel::ReSize();
 }
 
-REG_KERNEL(kCPU, kNumberTypeFloat32, PrimitiveType_FullConnection, LiteKernelCreator<FullconnectionCPUKernel>)
+kernel::LiteKernel *CpuFullconnectionFp32KernelCreator(const std::vector<lite::Tensor *> &inputs,
+                                                       const std::vector<lite::Tensor *> &outputs,
+                                                       OpParameter *op_parameter, const lite::Context *ctx,
+                                                       const kernel::KernelKey &desc) {
+  MS_ASSERT(desc.type == PrimitiveType_FullConnection);
+  if (op_parameter != nullptr && lite::WeightDecoder::IsQuantWeightComputable(op_parameter, inputs, kWeightIndex)) {
+    return LiteKernelCreator<MatmulWeightQuantCPUKernel>(inputs, outputs, op_parameter, ctx, desc);
+  }
+  return LiteKernelCreator<FullconnectionCPUKernel>(inputs, outputs, op_parameter, ctx, desc);
+}
+
+REG_KERNEL(kCPU, kNumberTypeFloat32, PrimitiveType_FullConnection, CpuFullconnectionFp32KernelCreator)
 }  // namespace mindspore::kernel
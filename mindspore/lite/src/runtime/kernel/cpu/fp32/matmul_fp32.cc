@@ -19,6 +19,8 @@
 #include "include/errorcode.h"
 #include "nnacl/fp32/matmul_fp32.h"
 #include "src/kernel_registry.h"
+#include "src/runtime/kernel/cpu/fp32/matmul_weight_quant_fp32.h"
+#include "src/weight_decoder.h"
 
 using mindspore::lite::kCHWDimNumber;
 using mindspore::lite::KernelRegistrar;
@@ -165,5 +167,15 @@ int MatmulCPUKernel::Run() {
   return ret;
 }
 
-REG_KERNEL(kCPU, kNumberTypeFloat32, PrimitiveType_MatMulFusion, LiteKernelCreator<MatmulCPUKernel>)
+kernel::LiteKernel *CpuMatmulFp32KernelCreator(const std::vector<lite::Tensor *> &inputs,
+                                               const std::vector<lite::Tensor *> &outputs, OpParameter *op_parameter,
+                                               const lite::Context *ctx, const kernel::KernelKey &desc) {
+  MS_ASSERT(desc.type == PrimitiveType_MatMulFusion);
+  if (op_parameter != nullptr && lite::WeightDecoder::IsQuantWeightComputable(op_parameter, inputs, kWeightIndex)) {
+    return LiteKernelCreator<MatmulWeightQuantCPUKernel>(inputs, outputs, op_parameter, ctx, desc);
+  }
+  return LiteKernelCreator<MatmulCPUKernel>(inputs, outputs, op_parameter, ctx, desc);
+}
+
+REG_KERNEL(kCPU, kNumberTypeFloat32, PrimitiveType_MatMulFusion, CpuMatmulFp32KernelCreator)
 }  // namespace mindspore::kernel
@@ -18,6 +18,7 @@
 #include "src/runtime/kernel/cpu/fp32/matmul_fp32_avx512.h"
 #include "src/runtime/kernel/cpu/fp32/matmul_fp32_base.h"
 #include "nnacl/fp32/matmul_avx512_fp32.h"
+#include "nnacl/fp32/matmul_avx512_bf16_fp32.h"
 #include "nnacl/fp32/pack_fp32.h"
 
 namespace mindspore::kernel {
@@ -31,6 +32,45 @@ void MatmulFp32BaseCPUKernel::InitGlobalVariable() {
   col_tile_ = C16NUM;
   col_min_unit_ = C64NUM;
   out_need_aligned_ = true;
+#ifdef ENABLE_AVX512_BF16
+  use_bf16_ = ms_context_->IsCpuBFloat16Enabled() && !op_parameter_->is_train_session_ && params_->row_ != 1 &&
+              params_->col_ != 1;
+  deep_bf16_ = UP_ROUND(params_->deep_, MATMUL_BF16_DEEP_TILE);
+#endif
+}
+
+int MatmulFp32BaseCPUKernel::PackMatrixBf16() {
+#ifdef ENABLE_AVX512_BF16
+  // the constant matrix-b is converted only once.
+  if (b_bf16_ == nullptr) {
+    size_t b_size = static_cast<size_t>(b_batch_) * params_->col_align_ * deep_bf16_ * sizeof(uint16_t);
+    b_bf16_ = reinterpret_cast<uint16_t *>(params_->b_const_ ? malloc(b_size) : ms_context_->allocator->Malloc(b_size));
+    MS_CHECK_TRUE_MSG(b_bf16_ != nullptr, RET_ERROR, "malloc bf16 matrix-b failed.");
+    for (int i = 0; i < b_batch_; ++i) {
+      Row64MajorFp32ToBf16(matrix_b_.pack_ptr + i * params_->deep_ * params_->col_align_,
+                           b_bf16_ + i * deep_bf16_ * params_->col_align_, params_->deep_, params_->col_align_);
+    }
+  }
+  int a_row = a_batch_ * params_->row_align_;
+  a_bf16_ = reinterpret_cast<uint16_t *>(
+    ms_context_->allocator->Malloc(static_cast<size_t>(a_row) * deep_bf16_ * sizeof(uint16_t)));
+  MS_CHECK_TRUE_MSG(a_bf16_ != nullptr, RET_ERROR, "malloc bf16 matrix-a failed.");
+  RowMajorFp32ToBf16(matrix_a_.pack_ptr, a_bf16_, a_row, params_->deep_);
+  return RET_OK;
+#else
+  return RET_ERROR;
+#endif
+}
+
+void MatmulFp32BaseCPUKernel::FreePackedMatrixBf16() {
+  if (a_bf16_ != nullptr) {
+    ms_context_->allocator->Free(a_bf16_);
+    a_bf16_ = nullptr;
+  }
+  if (!params_->b_const_ && b_bf16_ != nullptr) {
+    ms_context_->allocator->Free(b_bf16_);
+    b_bf16_ = nullptr;
+  }
 }
 
 int MatmulFp32BaseCPUKernel::PackMatrixAImplOpt() {
@@ -48,6 +88,14 @@ int MatmulFp32BaseCPUKernel::ParallelRunByBatch(int task_id) const {
     float *c = output_data_ + index * params_->row_ * col_step_;
 
     auto bias = (matrix_c_.pack_ptr == nullptr) ? nullptr : matrix_c_.pack_ptr;
+#ifdef ENABLE_AVX512_BF16
+    if (use_bf16_) {
+      MatMulAvx512Bf16(a_bf16_ + a_offset_[index] * params_->row_align_ * deep_bf16_,
+                       b_bf16_ + b_offset_[index] * deep_bf16_ * params_->col_align_, c, bias, params_->act_type_,
+                       deep_bf16_, col_step_, params_->col_align_, params_->row_);
+      continue;
+    }
+#endif
     if (params_->row_ == 1) {
       MatVecMulAvx512Fp32(a, b, c, bias, params_->act_type_, params_->deep_, col_step_, params_->col_align_);
     } else {
@@ -68,8 +116,15 @@ int MatmulFp32BaseCPUKernel::ParallelRunByRow(int task_id) const {
   if (row_num <= 0) {
     return RET_OK;
   }
-  const float *input = matrix_a_.pack_ptr + start_row * params_->deep_;
   float *output = output_data_ + start_row * params_->col_align_;
+#ifdef ENABLE_AVX512_BF16
+  if (use_bf16_) {
+    MatMulAvx512Bf16(a_bf16_ + start_row * deep_bf16_, b_bf16_, output, matrix_c_.pack_ptr, params_->act_type_,
+                     deep_bf16_, params_->col_align_, params_->col_align_, row_num);
+    return RET_OK;
+  }
+#endif
+  const float *input = matrix_a_.pack_ptr + start_row * params_->deep_;
   MatMulAvx512Fp32(input, matrix_b_.pack_ptr, output, matrix_c_.pack_ptr, params_->act_type_, params_->deep_,
                    params_->col_align_, params_->col_align_, row_num);
   return RET_OK;
@@ -90,6 +145,14 @@ int MatmulFp32BaseCPUKernel::ParallelRunByOC(int task_id) const {
     auto b = matrix_b_.pack_ptr + b_offset_[i] * params_->deep_ * params_->col_align_ + start_oc * params_->deep_;
     auto c = output_data_ + i * params_->row_ * col_step_ + start_oc;
     auto bias = (matrix_c_.pack_ptr == nullptr) ? nullptr : matrix_c_.pack_ptr + start_oc;
+#ifdef ENABLE_AVX512_BF16
+    if (use_bf16_) {
+      MatMulAvx512Bf16(a_bf16_ + a_offset_[i] * params_->row_align_ * deep_bf16_,
+                       b_bf16_ + (b_offset_[i] * params_->col_align_ + start_oc) * deep_bf16_, c, bias,
+                       params_->act_type_, deep_bf16_, compute_oc, params_->col_align_, params_->row_);
+      continue;
+    }
+#endif
     if (params_->row_ == 1) {
       MatVecMulAvx512Fp32(a, b, c, bias, params_->act_type_, params_->deep_, compute_oc, params_->col_align_);
     } else {
@@ -56,6 +56,12 @@ MatmulFp32BaseCPUKernel::~MatmulFp32BaseCPUKernel() {
   if (params_->b_const_) {
     lite::PackWeightManager::GetInstance()->Free(matrix_b_.pack_ptr);
   }
+#ifdef ENABLE_AVX512
+  if (params_->b_const_ && b_bf16_ != nullptr) {
+    free(b_bf16_);
+    b_bf16_ = nullptr;
+  }
+#endif
 }
 
 int MatmulFp32BaseCPUKernel::BackupConstMatrix(MatrixInfo *matrix_info, int index) {
@@ -424,8 +430,17 @@ int MatmulFp32BaseCPUKernel::Run() {
   }
   MS_CHECK_TRUE_MSG(matrix_a_.pack_ptr != nullptr, RET_ERROR, "matrix-a pack ptr is a nullptr.");
   MS_CHECK_TRUE_MSG(matrix_b_.pack_ptr != nullptr, RET_ERROR, "matrix-b pack ptr is a nullptr.");
+#ifdef ENABLE_AVX512
+  if (use_bf16_) {
+    auto ret = PackMatrixBf16();
+    MS_CHECK_TRUE_MSG(ret == RET_OK, RET_ERROR, "pack bf16 matrix failed.");
+  }
+#endif
 
   auto ret = ParallelLaunch(this->ms_context_, MatmulRun, this, thread_count_);
+#ifdef ENABLE_AVX512
+  FreePackedMatrixBf16();
+#endif
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "MatmulRun failed in split by batch";
     return ret;
@@ -76,6 +76,10 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
   int GetThreadCuttingPolicy();
   bool CheckThreadCuttingByRow();
   void GetThreadCuttingInfoByRow();
+#ifdef ENABLE_AVX512
+  int PackMatrixBf16();
+  void FreePackedMatrixBf16();
+#endif
 
  protected:
   MatMulParameter *params_ = nullptr;
@@ -103,6 +107,12 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
   bool pack_opt_{false};  // indicate whether packing can be multi-threads, currently, only support in ARM64 && packA.
   MatrixPackFun matrix_a_pack_fun_ = nullptr;
   MatrixPackFun matrix_b_pack_fun_ = nullptr;
+#ifdef ENABLE_AVX512
+  bool use_bf16_{false};  // compute in bfloat16 when float16 is enabled on the cpu supporting avx512-bf16.
+  int deep_bf16_{0};
+  uint16_t *a_bf16_{nullptr};
+  uint16_t *b_bf16_{nullptr};
+#endif
 };
 }  // namespace mindspore::kernel
 #endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_MATMUL_FP32_BASE_H_
@@ -0,0 +1,202 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/runtime/kernel/cpu/fp32/matmul_weight_quant_fp32.h"
+#include <algorithm>
+#include <numeric>
+#include "nnacl/fp32/matmul_weight_quant_fp32.h"
+#include "src/pack_weight_manager.h"
+
+using mindspore::lite::RET_ERROR;
+using mindspore::lite::RET_MEMORY_FAILED;
+using mindspore::lite::RET_OK;
+using mindspore::schema::PrimitiveType_FullConnection;
+
+namespace mindspore::kernel {
+namespace {
+constexpr int kInt4BitNum = 4;
+constexpr int kInt4Min = -8;
+constexpr int kInt4Max = 7;
+}  // namespace
+
+int MatmulWeightQuantRun(void *cdata, int task_id, float, float) {
+  CHECK_NULL_RETURN(cdata);
+  auto kernel = reinterpret_cast<MatmulWeightQuantCPUKernel *>(cdata);
+  auto ret = kernel->DoMatmul(task_id);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "MatmulWeightQuantRun error task_id[" << task_id << "] error_code[" << ret << "]";
+    return RET_ERROR;
+  }
+  return RET_OK;
+}
+
+MatmulWeightQuantCPUKernel::~MatmulWeightQuantCPUKernel() {
+  if (packed_weight_ != nullptr) {
+    lite::PackWeightManager::GetInstance()->Free(packed_weight_);
+    packed_weight_ = nullptr;
+  }
+}
+
+int MatmulWeightQuantCPUKernel::InitQuantParam() {
+  auto quant_params = in_tensors_[kWeightIndex]->quant_params();
+  MS_CHECK_TRUE_MSG(!quant_params.empty(), RET_ERROR, "weight has no quant param.");
+  auto padded_col = tile_num_ * WEIGHT_QUANT_COL_TILE;
+  scales_.assign(padded_col, 0.0f);
+  zero_points_.assign(padded_col, 0.0f);
+  has_zero_point_ = false;
+  for (int i = 0; i < col_; ++i) {
+    const auto &quant_param = quant_params.size() == 1 ? quant_params.front() : quant_params.at(i);
+    scales_[i] = static_cast<float>(quant_param.scale);
+    zero_points_[i] = static_cast<float>(quant_param.zeroPoint);
+    has_zero_point_ = has_zero_point_ || quant_param.zeroPoint != 0;
+  }
+
+  // the weight of no more than 4 bits is packed two in a byte.
+  bit_num_ = C8NUM;
+  if (quant_params.front().bitNum <= kInt4BitNum) {
+    auto weight = reinterpret_cast<const int8_t *>(in_tensors_[kWeightIndex]->data());
+    auto element_num = in_tensors_[kWeightIndex]->ElementsNum();
+    bool is_int4 = std::all_of(weight, weight + element_num,
+                               [](int8_t value) { return value >= kInt4Min && value <= kInt4Max; });
+    bit_num_ = is_int4 ? kInt4BitNum : C8NUM;
+  }
+  return RET_OK;
+}
+
+int MatmulWeightQuantCPUKernel::InitBias() {
+  bias_.clear();
+  if (in_tensors_.size() <= kBiasIndex) {
+    return RET_OK;
+  }
+  auto bias_tensor = in_tensors_[kBiasIndex];
+  MS_CHECK_TRUE_MSG(bias_tensor->data_type() == kNumberTypeFloat32, RET_ERROR, "bias must be float32.");
+  MS_CHECK_TRUE_MSG(bias_tensor->ElementsNum() == col_, RET_ERROR, "the size of bias is invalid.");
+  auto bias_data = reinterpret_cast<const float *>(bias_tensor->data());
+  CHECK_NULL_RETURN(bias_data);
+  bias_.assign(tile_num_ * WEIGHT_QUANT_COL_TILE, 0.0f);
+  std::copy(bias_data, bias_data + col_, bias_.begin());
+  return RET_OK;
+}
+
+int MatmulWeightQuantCPUKernel::PackWeight() {
+  auto weight_tensor = in_tensors_[kWeightIndex];
+  size_t depth_bytes = bit_num_ == kInt4BitNum ? WEIGHT_QUANT_COL_TILE / C2NUM : WEIGHT_QUANT_COL_TILE;
+  size_t pack_size = static_cast<size_t>(tile_num_) * deep_ * depth_bytes;
+  bool is_packed = false;
+  packed_weight_ = lite::PackWeightManager::GetInstance()->GetPackData(weight_tensor->data(), pack_size, &is_packed);
+  if (packed_weight_ == nullptr) {
+    MS_LOG(ERROR) << "Malloc packed weight failed.";
+    return RET_MEMORY_FAILED;
+  }
+  if (is_packed) {
+    return RET_OK;
+  }
+  auto weight = reinterpret_cast<const int8_t *>(weight_tensor->data());
+  CHECK_NULL_RETURN(weight);
+  bool b_transpose = op_parameter_->type_ == PrimitiveType_FullConnection || params_->b_transpose_;
+  if (bit_num_ == kInt4BitNum) {
+    PackWeightQuantInt4(weight, reinterpret_cast<uint8_t *>(packed_weight_), deep_, col_, b_transpose);
+  } else {
+    PackWeightQuantInt8(weight, reinterpret_cast<int8_t *>(packed_weight_), deep_, col_, b_transpose);
+  }
+  return RET_OK;
+}
+
+int MatmulWeightQuantCPUKernel::Prepare() {
+  CHECK_LESS_RETURN(in_tensors_.size(), C2NUM);
+  CHECK_LESS_RETURN(out_tensors_.size(), 1);
+  auto weight_tensor = in_tensors_[kWeightIndex];
+  MS_CHECK_TRUE_MSG(weight_tensor->IsConst() && weight_tensor->data_type() == kNumberTypeInt8, RET_ERROR,
+                    "weight must be a const int8 tensor.");
+  auto weight_shape = weight_tensor->shape();
+  MS_CHECK_TRUE_MSG(weight_shape.size() == DIMENSION_2D, RET_ERROR, "weight must be 2D.");
+  bool b_transpose = op_parameter_->type_ == PrimitiveType_FullConnection || params_->b_transpose_;
+  col_ = b_transpose ? weight_shape[0] : weight_shape[1];
+  deep_ = b_transpose ? weight_shape[1] : weight_shape[0];
+  MS_CHECK_TRUE_MSG(col_ > 0 && deep_ > 0, RET_ERROR, "weight shape is invalid.");
+  tile_num_ = UP_DIV(col_, WEIGHT_QUANT_COL_TILE);
+
+  auto ret = InitQuantParam();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Init quant param failed.";
+    return ret;
+  }
+  ret = InitBias();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Init bias failed.";
+    return ret;
+  }
+  ret = PackWeight();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Pack weight failed.";
+    return ret;
+  }
+  if (!InferShapeDone()) {
+    return RET_OK;
+  }
+  return ReSize();
+}
+
+int MatmulWeightQuantCPUKernel::ReSize() {
+  auto out_num = out_tensors_.front()->ElementsNum();
+  MS_CHECK_TRUE_MSG(out_num % col_ == 0, RET_ERROR, "output shape is invalid.");
+  row_ = out_num / col_;
+  MS_CHECK_TRUE_MSG(in_tensors_[kInputIndex]->ElementsNum() == row_ * deep_, RET_ERROR, "input shape is invalid.");
+  thread_count_ = MSMAX(MSMIN(op_parameter_->thread_num_, tile_num_), 1);
+  tile_per_thread_ = UP_DIV(tile_num_, thread_count_);
+  thread_count_ = UP_DIV(tile_num_, tile_per_thread_);
+  return RET_OK;
+}
+
+int MatmulWeightQuantCPUKernel::DoMatmul(int task_id) {
+  int start_tile = task_id * tile_per_thread_;
+  int end_tile = MSMIN(tile_num_, start_tile + tile_per_thread_);
+  if (start_tile >= end_tile) {
+    return RET_OK;
+  }
+  auto a = reinterpret_cast<const float *>(in_tensors_[kInputIndex]->data());
+  auto c = reinterpret_cast<float *>(out_tensors_.front()->data());
+  MatmulWeightQuantFp32(a, packed_weight_, c, bias_.empty() ? nullptr : bias_.data(), scales_.data(),
+                        has_zero_point_ ? zero_points_.data() : nullptr, a_sums_, params_->act_type_, row_, deep_,
+                        col_, start_tile, end_tile, bit_num_);
+  return RET_OK;
+}
+
+int MatmulWeightQuantCPUKernel::Run() {
+  auto a = reinterpret_cast<const float *>(in_tensors_[kInputIndex]->data());
+  CHECK_NULL_RETURN(a);
+  CHECK_NULL_RETURN(out_tensors_.front()->data());
+  if (has_zero_point_) {
+    a_sums_ = reinterpret_cast<float *>(ms_context_->allocator->Malloc(row_ * sizeof(float)));
+    if (a_sums_ == nullptr) {
+      MS_LOG(ERROR) << "Malloc a_sums failed.";
+      return RET_MEMORY_FAILED;
+    }
+    for (int r = 0; r < row_; ++r) {
+      a_sums_[r] = std::accumulate(a + r * deep_, a + (r + 1) * deep_, 0.0f);
+    }
+  }
+  auto ret = ParallelLaunch(this->ms_context_, MatmulWeightQuantRun, this, thread_count_);
+  if (a_sums_ != nullptr) {
+    ms_context_->allocator->Free(a_sums_);
+    a_sums_ = nullptr;
+  }
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "MatmulWeightQuantRun failed, ret: " << ret;
+  }
+  return ret;
+}
+}  // namespace mindspore::kernel
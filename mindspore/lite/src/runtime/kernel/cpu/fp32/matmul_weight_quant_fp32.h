@@ -0,0 +1,62 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_MATMUL_WEIGHT_QUANT_FP32_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_MATMUL_WEIGHT_QUANT_FP32_H_
+
+#include <vector>
+#include "src/lite_kernel.h"
+#include "nnacl/matmul_parameter.h"
+#include "include/errorcode.h"
+
+namespace mindspore::kernel {
+// MatMul and FullConnection with the weight quantized to int8 or int4, the weight is kept quantized in memory and
+// dequantized in registers. It's selected when WeightDecoder::IsQuantWeightComputable holds.
+class MatmulWeightQuantCPUKernel : public LiteKernel {
+ public:
+  MatmulWeightQuantCPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                             const std::vector<lite::Tensor *> &outputs, const lite::InnerContext *ctx)
+      : LiteKernel(parameter, inputs, outputs, ctx) {
+    params_ = reinterpret_cast<MatMulParameter *>(op_parameter_);
+  }
+  ~MatmulWeightQuantCPUKernel() override;
+  int Prepare() override;
+  int ReSize() override;
+  int Run() override;
+  int DoMatmul(int task_id);
+
+ private:
+  int InitQuantParam();
+  int InitBias();
+  int PackWeight();
+
+  MatMulParameter *params_ = nullptr;
+  void *packed_weight_ = nullptr;
+  std::vector<float> scales_;
+  std::vector<float> zero_points_;
+  std::vector<float> bias_;
+  float *a_sums_ = nullptr;
+  bool has_zero_point_ = false;
+  int bit_num_ = 8;
+  int row_ = 0;
+  int deep_ = 0;
+  int col_ = 0;
+  int tile_num_ = 0;
+  int tile_per_thread_ = 0;
+  int thread_count_ = 0;
+};
+}  // namespace mindspore::kernel
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_MATMUL_WEIGHT_QUANT_FP32_H_
@@ -0,0 +1,169 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/runtime/kernel/cpu/fp32/scaled_dot_product_attention_fp32.h"
+#include "src/kernel_registry.h"
+#include "nnacl/fp32/flash_attention_fp32.h"
+
+using mindspore::kernel::KERNEL_ARCH;
+using mindspore::lite::KernelRegistrar;
+using mindspore::lite::RET_ERROR;
+using mindspore::lite::RET_MEMORY_FAILED;
+using mindspore::lite::RET_OK;
+using mindspore::schema::PrimitiveType_ScaledDotProductAttention;
+
+namespace mindspore::kernel {
+namespace {
+constexpr size_t kMaskIndex = 3;
+constexpr size_t kLseIndex = 1;
+}  // namespace
+
+int ScaledDotProductAttentionRun(void *cdata, int task_id, float, float) {
+  CHECK_NULL_RETURN(cdata);
+  auto kernel = reinterpret_cast<ScaledDotProductAttentionCPUKernel *>(cdata);
+  auto ret = kernel->DoAttention(task_id);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "ScaledDotProductAttentionRun error task_id[" << task_id << "] error_code[" << ret << "]";
+    return RET_ERROR;
+  }
+  return RET_OK;
+}
+
+int ScaledDotProductAttentionCPUKernel::Prepare() {
+  CHECK_LESS_RETURN(in_tensors_.size(), C3NUM);
+  CHECK_LESS_RETURN(out_tensors_.size(), 1);
+  CHECK_NULL_RETURN(param_);
+  if (!InferShapeDone()) {
+    return RET_OK;
+  }
+  return ReSize();
+}
+
+int ScaledDotProductAttentionCPUKernel::InitMaskOffsets() {
+  mask_offsets_.clear();
+  if (in_tensors_.size() <= kMaskIndex) {
+    return RET_OK;
+  }
+  MS_CHECK_TRUE_MSG(in_tensors_[kMaskIndex]->data_type() == kNumberTypeFloat32, RET_ERROR, "mask must be float32.");
+  auto q_shape = in_tensors_[FIRST_INPUT]->shape();
+  auto mask_shape = in_tensors_[kMaskIndex]->shape();
+  auto mask_rank = mask_shape.size();
+  MS_CHECK_TRUE_MSG(mask_rank >= DIMENSION_2D && mask_rank <= q_shape.size(), RET_ERROR, "mask rank is invalid.");
+  MS_CHECK_TRUE_MSG(mask_shape[mask_rank - C2NUM] == param_->q_seq_ && mask_shape[mask_rank - 1] == param_->kv_seq_,
+                    RET_ERROR, "the last two dims of mask must be [q_seq, kv_seq].");
+  // the leading dims of mask are aligned to the right of those of q, and each of them is 1 or the same as q.
+  auto batch_rank = q_shape.size() - DIMENSION_2D;
+  auto mask_batch_rank = mask_rank - DIMENSION_2D;
+  std::vector<int> mask_strides(batch_rank, 0);
+  int stride = param_->q_seq_ * param_->kv_seq_;
+  for (size_t i = 0; i < mask_batch_rank; ++i) {
+    auto mask_dim = mask_batch_rank - 1 - i;
+    auto q_dim = batch_rank - 1 - i;
+    MS_CHECK_TRUE_MSG(mask_shape[mask_dim] == 1 || mask_shape[mask_dim] == q_shape[q_dim], RET_ERROR,
+                      "mask can not be broadcast to q.");
+    mask_strides[q_dim] = mask_shape[mask_dim] == 1 ? 0 : stride;
+    stride *= mask_shape[mask_dim];
+  }
+  mask_offsets_.resize(batch_);
+  for (int b = 0; b < batch_; ++b) {
+    int offset = 0;
+    int index = b;
+    for (int dim = static_cast<int>(batch_rank) - 1; dim >= 0; --dim) {
+      offset += (index % q_shape[dim]) * mask_strides[dim];
+      index /= q_shape[dim];
+    }
+    mask_offsets_[b] = offset;
+  }
+  return RET_OK;
+}
+
+int ScaledDotProductAttentionCPUKernel::ReSize() {
+  auto q_shape = in_tensors_[FIRST_INPUT]->shape();
+  auto k_shape = in_tensors_[SECOND_INPUT]->shape();
+  MS_CHECK_TRUE_MSG(q_shape.size() >= DIMENSION_2D && k_shape.size() == q_shape.size(), RET_ERROR,
+                    "the shape of q or k is invalid.");
+  param_->q_seq_ = q_shape[q_shape.size() - C2NUM];
+  param_->head_size_ = q_shape.back();
+  param_->kv_seq_ = k_shape[k_shape.size() - C2NUM];
+  MS_CHECK_TRUE_MSG(param_->q_seq_ > 0 && param_->head_size_ > 0 && param_->kv_seq_ >= param_->q_seq_, RET_ERROR,
+                    "the shape of q or k is invalid.");
+  batch_ = in_tensors_[FIRST_INPUT]->ElementsNum() / (param_->q_seq_ * param_->head_size_);
+  auto ret = InitMaskOffsets();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Init mask offsets failed.";
+    return ret;
+  }
+
+  // each thread calculates successive queries, which may cross the heads, so that the decoding of a single query is
+  // still split among the threads by the heads.
+  int row_num = batch_ * param_->q_seq_;
+  thread_count_ = MSMAX(MSMIN(op_parameter_->thread_num_, row_num), 1);
+  row_stride_ = UP_DIV(row_num, thread_count_);
+  thread_count_ = UP_DIV(row_num, row_stride_);
+  buffer_size_ = FlashAttentionBufferSize(param_);
+  return RET_OK;
+}
+
+int ScaledDotProductAttentionCPUKernel::DoAttention(int task_id) {
+  int row_num = batch_ * param_->q_seq_;
+  int row_start = task_id * row_stride_;
+  int row_end = MSMIN(row_num, row_start + row_stride_);
+  auto q = reinterpret_cast<const float *>(in_tensors_[FIRST_INPUT]->data());
+  auto k = reinterpret_cast<const float *>(in_tensors_[SECOND_INPUT]->data());
+  auto v = reinterpret_cast<const float *>(in_tensors_[THIRD_INPUT]->data());
+  auto mask = mask_offsets_.empty() ? nullptr : reinterpret_cast<const float *>(in_tensors_[kMaskIndex]->data());
+  auto out = reinterpret_cast<float *>(out_tensors_.front()->data());
+  auto lse = out_tensors_.size() > kLseIndex ? reinterpret_cast<float *>(out_tensors_[kLseIndex]->data()) : nullptr;
+  float *buffer = buffer_ + task_id * buffer_size_;
+  int q_size = param_->q_seq_ * param_->head_size_;
+  int kv_size = param_->kv_seq_ * param_->head_size_;
+  for (int row = row_start; row < row_end;) {
+    int b = row / param_->q_seq_;
+    int q_start = row % param_->q_seq_;
+    int q_end = MSMIN(param_->q_seq_, q_start + row_end - row);
+    FlashAttentionFp32(q + b * q_size, k + b * kv_size, v + b * kv_size,
+                       mask == nullptr ? nullptr : mask + mask_offsets_[b], out + b * q_size,
+                       lse == nullptr ? nullptr : lse + b * param_->q_seq_, buffer, param_, q_start, q_end);
+    row += q_end - q_start;
+  }
+  return RET_OK;
+}
+
+int ScaledDotProductAttentionCPUKernel::Run() {
+  for (size_t i = 0; i < in_tensors_.size(); ++i) {
+    CHECK_NULL_RETURN(in_tensors_[i]->data());
+  }
+  for (size_t i = 0; i < out_tensors_.size(); ++i) {
+    CHECK_NULL_RETURN(out_tensors_[i]->data());
+  }
+  buffer_ = reinterpret_cast<float *>(
+    ms_context_->allocator->Malloc(static_cast<size_t>(thread_count_) * buffer_size_ * sizeof(float)));
+  if (buffer_ == nullptr) {
+    MS_LOG(ERROR) << "Malloc attention buffer failed.";
+    return RET_MEMORY_FAILED;
+  }
+  auto ret = ParallelLaunch(this->ms_context_, ScaledDotProductAttentionRun, this, thread_count_);
+  ms_context_->allocator->Free(buffer_);
+  buffer_ = nullptr;
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "ScaledDotProductAttentionRun failed, ret: " << ret;
+  }
+  return ret;
+}
+
+REG_KERNEL(kCPU, kNumberTypeFloat32, PrimitiveType_ScaledDotProductAttention,
+           LiteKernelCreator<ScaledDotProductAttentionCPUKernel>)
+}  // namespace mindspore::kernel
@@ -0,0 +1,55 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_SCALED_DOT_PRODUCT_ATTENTION_FP32_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_SCALED_DOT_PRODUCT_ATTENTION_FP32_H_
+
+#include <vector>
+#include "src/lite_kernel.h"
+#include "nnacl/attention_parameter.h"
+
+namespace mindspore::kernel {
+// softmax(q * k^T * scale + mask) * v, fused with the online softmax so that the logits are never materialized.
+// q: [..., q_seq, head_size], k and v: [..., kv_seq, head_size], mask: [..., q_seq, kv_seq] broadcast to q.
+// The optional 2nd output is the log-sum-exp of each query, which the backward of training needs.
+class ScaledDotProductAttentionCPUKernel : public LiteKernel {
+ public:
+  ScaledDotProductAttentionCPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                                     const std::vector<lite::Tensor *> &outputs, const lite::InnerContext *ctx)
+      : LiteKernel(parameter, inputs, outputs, ctx) {
+    param_ = reinterpret_cast<ScaledDotProductAttentionParameter *>(op_parameter_);
+  }
+  ~ScaledDotProductAttentionCPUKernel() override = default;
+
+  int Prepare() override;
+  int ReSize() override;
+  int Run() override;
+  int DoAttention(int task_id);
+
+ private:
+  int InitMaskOffsets();
+
+  ScaledDotProductAttentionParameter *param_ = nullptr;
+  // the offset of the mask of each head, the mask is broadcast to the leading dims of q.
+  std::vector<int> mask_offsets_;
+  float *buffer_ = nullptr;
+  int buffer_size_ = 0;
+  int batch_ = 0;
+  int row_stride_ = 0;
+  int thread_count_ = 0;
+};
+}  // namespace mindspore::kernel
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_ARM_FP32_SCALED_DOT_PRODUCT_ATTENTION_FP32_H_
@@ -0,0 +1,52 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/runtime/resize_plan_cache.h"
+
+namespace mindspore::lite {
+ResizePlanPtr ResizePlanCache::Find(const std::vector<std::vector<int>> &input_shapes) {
+  auto iter = index_.find(input_shapes);
+  if (iter == index_.end()) {
+    return nullptr;
+  }
+  plans_.splice(plans_.begin(), plans_, iter->second);
+  ++hits_;
+  return iter->second->second;
+}
+
+void ResizePlanCache::Insert(const std::vector<std::vector<int>> &input_shapes, const ResizePlanPtr &plan) {
+  if (capacity_ == 0 || plan == nullptr) {
+    return;
+  }
+  auto iter = index_.find(input_shapes);
+  if (iter != index_.end()) {
+    iter->second->second = plan;
+    plans_.splice(plans_.begin(), plans_, iter->second);
+    return;
+  }
+  if (plans_.size() >= capacity_) {
+    index_.erase(plans_.back().first);
+    plans_.pop_back();
+  }
+  plans_.emplace_front(input_shapes, plan);
+  index_[input_shapes] = plans_.begin();
+}
+
+void ResizePlanCache::Clear() {
+  index_.clear();
+  plans_.clear();
+}
+}  // namespace mindspore::lite
@@ -0,0 +1,75 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_RESIZE_PLAN_CACHE_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_RESIZE_PLAN_CACHE_H_
+
+#include <list>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "src/tensor.h"
+#include "src/runtime/runtime_allocator.h"
+
+namespace mindspore::kernel {
+class KernelExec;
+struct ResizeState;
+}  // namespace mindspore::kernel
+
+namespace mindspore::lite {
+// what a resize of the session works out for one group of input shapes.
+struct ResizePlan {
+  // the inferred shape of every tensor in the plan.
+  std::vector<std::pair<Tensor *, std::vector<int>>> tensor_shapes;
+  // the resize states of the kernels which can restore them, the other kernels are resized again.
+  std::unordered_map<kernel::KernelExec *, std::shared_ptr<kernel::ResizeState>> kernel_states;
+  // the memory plan, nullptr if the session doesn't use the runtime allocator. the memory block is shared by the
+  // plans.
+  RuntimeAllocatorPtr runtime_allocator = nullptr;
+  // the tensors which are set to the runtime allocator by the memory plan.
+  std::vector<Tensor *> runtime_allocator_tensors;
+};
+using ResizePlanPtr = std::shared_ptr<ResizePlan>;
+
+// LRU cache of the resize plans, keyed by the shapes of the graph inputs.
+class ResizePlanCache {
+ public:
+  explicit ResizePlanCache(size_t capacity) : capacity_(capacity) {}
+  ~ResizePlanCache() = default;
+
+  // the plan of the input shapes, which becomes the most recently used one. nullptr if not cached.
+  ResizePlanPtr Find(const std::vector<std::vector<int>> &input_shapes);
+  // add the plan, the least recently used plan is evicted when the cache is full.
+  void Insert(const std::vector<std::vector<int>> &input_shapes, const ResizePlanPtr &plan);
+  void Clear();
+  size_t size() const { return plans_.size(); }
+  size_t capacity() const { return capacity_; }
+  // how many times a plan is found since the cache is created.
+  size_t hits() const { return hits_; }
+
+ private:
+  using PlanList = std::list<std::pair<std::vector<std::vector<int>>, ResizePlanPtr>>;
+  size_t capacity_ = 0;
+  size_t hits_ = 0;
+  // the most recently used plan is at the front.
+  PlanList plans_;
+  std::map<std::vector<std::vector<int>>, PlanList::iterator> index_;
+};
+}  // namespace mindspore::lite
+
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_RESIZE_PLAN_CACHE_H_
@@ -17,6 +17,25 @@
 #include "src/runtime/runtime_allocator.h"
 
 namespace mindspore {
+RuntimeArena::~RuntimeArena() {
+  if (data_ != nullptr) {
+    free(data_);
+    data_ = nullptr;
+  }
+}
+
+void *RuntimeArena::Reserve(size_t size) {
+  if (data_ != nullptr && size <= size_) {
+    return data_;
+  }
+  if (data_ != nullptr) {
+    free(data_);
+  }
+  data_ = malloc(size);
+  size_ = data_ == nullptr ? 0 : size;
+  return data_;
+}
+
 RuntimeAllocator::RuntimeAllocator(size_t aligned_size) {
   aligned_size_ = aligned_size;
   return;
@@ -30,6 +49,9 @@ RuntimeAllocator::~RuntimeAllocator() {
 }
 
 void *RuntimeAllocator::MallocOptData() {
+  if (arena_ != nullptr) {
+    return arena_->Reserve(total_size_);
+  }
   if (data_ == nullptr) {
     data_ = malloc(total_size_);
   }
@@ -25,6 +25,22 @@
 #include "src/tensor.h"
 
 namespace mindspore {
+// the memory block shared by several runtime allocators of which only one is used at a time, it grows to the largest
+// size they need.
+class RuntimeArena {
+ public:
+  RuntimeArena() = default;
+  ~RuntimeArena();
+
+  void *Reserve(size_t size);
+  size_t size() const { return size_; }
+
+ private:
+  void *data_ = nullptr;
+  size_t size_ = 0;
+};
+using RuntimeArenaPtr = std::shared_ptr<RuntimeArena>;
+
 class RuntimeAllocator : public Allocator {
  public:
   explicit RuntimeAllocator(size_t aligned_size = 32);
@@ -45,12 +61,15 @@ class RuntimeAllocator : public Allocator {
   void *MallocOptData();
   const std::unordered_map<lite::Tensor *, size_t> &GetOffsetMap() const { return offset_map_; }
   void Clear(AllocatorPtr default_allocator);
+  // the data is taken from the arena instead of being malloced by the allocator itself.
+  void set_arena(const RuntimeArenaPtr &arena) { arena_ = arena; }
 
  private:
   size_t FindMinFree(size_t size);
 
  private:
   void *data_ = nullptr;
+  RuntimeArenaPtr arena_ = nullptr;
   size_t total_size_ = 0;
   std::unordered_map<lite::Tensor *, size_t> offset_map_;
   std::map<size_t, size_t> free_list_; /* offset, size */
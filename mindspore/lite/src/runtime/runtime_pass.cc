@@ -253,15 +253,20 @@ void ConvNormC4PassAct(std::vector<kernel::KernelExec *> *kernels) {
   return;
 }
 
-STATUS DeleteRedundantTrans(std::vector<kernel::KernelExec *> *kernels) {
+STATUS DeleteRedundantTrans(std::vector<kernel::KernelExec *> *kernels, bool *changed) {
   for (auto *pre_kernel : *kernels) {
     if (pre_kernel->subgraph_type() != kernel::kNotSubGraph) {
       auto sub_graph = reinterpret_cast<kernel::SubGraphKernel *>(pre_kernel);
       auto &partial = sub_graph->nodes();
-      if (DeleteRedundantTrans(&partial) != RET_OK) {
+      bool partial_changed = false;
+      if (DeleteRedundantTrans(&partial, &partial_changed) != RET_OK) {
         MS_LOG(ERROR) << "DeleteRedundantTrans failed in subgraph.";
         return RET_ERROR;
       }
+      if (partial_changed) {
+        sub_graph->IncreaseGraphVersion();
+        *changed = true;
+      }
     }
     if (pre_kernel->type() != schema::PrimitiveType_Transpose) {
       continue;
@@ -303,6 +308,7 @@ STATUS DeleteRedundantTrans(std::vector<kernel::KernelExec *> *kernels) {
     post_kernel->set_in_tensor(pre_kernel->in_tensors()[0], 0);
     kernels->erase(find(kernels->begin(), kernels->end(), pre_kernel));
     delete pre_kernel;
+    *changed = true;
   }
   return RET_OK;
 }
@@ -320,11 +326,15 @@ STATUS RuntimePass(std::vector<kernel::KernelExec *> *subgraphs, std::vector<Ten
     auto &kernels = sub->nodes();
     Nc4hw4PassAct(&kernels, tensors, i);
     ConvNormC4PassAct(&kernels);
-    auto status = DeleteRedundantTrans(&kernels);
+    bool changed = false;
+    auto status = DeleteRedundantTrans(&kernels, &changed);
     if (status != RET_OK) {
       MS_LOG(ERROR) << "DeleteRedundantTrans failed.";
       return RET_ERROR;
     }
+    if (changed) {
+      sub->IncreaseGraphVersion();
+    }
   }
 #endif
   return RET_OK;
@@ -338,11 +348,15 @@ STATUS GraphOptimizePass(std::vector<kernel::KernelExec *> *sub_graphs) {
       continue;
     }
     auto &kernels = sub_graph->nodes();
-    auto status = DeleteRedundantTrans(&kernels);
+    bool changed = false;
+    auto status = DeleteRedundantTrans(&kernels, &changed);
     if (status != RET_OK) {
       MS_LOG(ERROR) << "DeleteRedundantTrans failed.";
       return RET_ERROR;
     }
+    if (changed) {
+      sub_graph->IncreaseGraphVersion();
+    }
   }
 #endif
   return RET_OK;
@@ -263,6 +263,7 @@ int Scheduler::SchedulePreProcess() {
       SearchSubGraph(context_, src_model_, src_tensors_, &op_parameters_, &graph_output_node_indexes_);
 
     if (context_->enable_parallel_) {
+      search_sub_graph.SetProfile(sub_graph_profile_);
       if (*is_infershape_ != RET_INFER_INVALID) {
         search_sub_graph.SubGraphSplit();
       }
@@ -1019,8 +1020,10 @@ int Scheduler::FindCpuKernel(const std::vector<Tensor *> &in_tensors, const std:
     }
     cpu_desc.data_type = kNumberTypeFloat16;
   }
-  auto ret =
-    WeightDecoder::DequantNode(op_parameter, in_tensors, kernel_data_type, src_model_->version_, context_->float_mode);
+  // the fp32 kernels which support the quantized weight keep it quantized in memory.
+  bool keep_quant_weight = !is_train_session_ && cpu_desc.data_type == kNumberTypeFloat32;
+  auto ret = WeightDecoder::DequantNode(op_parameter, in_tensors, kernel_data_type, src_model_->version_,
+                                        context_->float_mode, keep_quant_weight);
   if (ret != RET_OK) {
     MS_LOG(DEBUG) << "Dequant input tensors failed: " << ret;
     return RET_NOT_SUPPORT;
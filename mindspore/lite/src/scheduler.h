@@ -34,6 +34,7 @@
 #include "src/runtime/runtime_shape_fusion_pass.h"
 
 namespace mindspore::lite {
+class SubGraphProfile;
 constexpr int kDefaultDeviceType = -1;
 class Scheduler {
  public:
@@ -59,6 +60,7 @@ class Scheduler {
   void SetConfig(const std::map<std::string, std::map<std::string, std::string>> *config_info) {
     config_info_ = config_info;
   }
+  void SetSubGraphProfile(const SubGraphProfile *sub_graph_profile) { sub_graph_profile_ = sub_graph_profile; }
   std::vector<kernel::KernelExec *> NonTailCallNodes();
 
  private:
@@ -154,6 +156,7 @@ class Scheduler {
   std::vector<mindspore::MSTensor> ms_outputs_;
   std::vector<size_t> graph_output_node_indexes_;
   std::map<int, OpParameter *> op_parameters_;
+  const SubGraphProfile *sub_graph_profile_ = nullptr;
   bool is_train_session_ = false;
   bool *is_control_flow_ = nullptr;
   int *is_infershape_ = nullptr;
@@ -132,6 +132,26 @@ int SubGraphKernel::ReSize() {
   }
   return RET_OK;
 }
+
+int SubGraphKernel::ReSizeNodes(const std::unordered_map<KernelExec *, ResizeStatePtr> &resize_states) {
+  for (auto kernel : nodes_) {
+    if (kernel == nullptr) {
+      MS_LOG(ERROR) << "input kernel is nullptr!";
+      return RET_ERROR;
+    }
+    for (auto &output : kernel->out_tensors()) {
+      output->FreeData();
+    }
+    auto state = resize_states.find(kernel);
+    auto ret = state != resize_states.end() ? kernel->RestoreResizeState(*state->second) : kernel->ReSize();
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "kernel " << kernel->name() << " resize fail!ret = " << ret;
+      return ret;
+    }
+  }
+  return RET_OK;
+}
+
 void SubGraphKernel::InitInputOutputTensorInitRefCount() {
   for (auto &input : this->in_tensors()) {
     int input_init_refcount = input->init_ref_count();
@@ -339,6 +359,7 @@ void SubGraphKernel::DropNode(KernelExec *node) {
   lite::VectorErase(&nodes_, node);
   lite::VectorErase(&in_nodes_, node);
   lite::VectorErase(&out_nodes_, node);
+  IncreaseGraphVersion();
 }
 
 int CustomSubGraph::Prepare() {
@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <memory>
 #include "src/kernel_exec.h"
 #include "src/executor.h"
@@ -91,6 +92,10 @@ class SubGraphKernel : public KernelExec {
   // called after Run
   int ReSize() override;
 
+  // resize the nodes by the shapes which are already set to their tensors, the shape inference is skipped. the nodes
+  // which have a state in resize_states restore it instead of running ReSize().
+  int ReSizeNodes(const std::unordered_map<KernelExec *, ResizeStatePtr> &resize_states);
+
   void InitOutTensorInitRefCount(const std::vector<KernelExec *> *mask_kernels) override;
 
   void InitInputOutputTensorInitRefCount();
@@ -99,7 +104,10 @@ class SubGraphKernel : public KernelExec {
 
   std::string ToString() const override;
 
-  void set_nodes(const std::vector<KernelExec *> &node) { this->nodes_ = node; }
+  void set_nodes(const std::vector<KernelExec *> &node) {
+    this->nodes_ = node;
+    IncreaseGraphVersion();
+  }
 
   std::vector<KernelExec *> &nodes() { return this->nodes_; }
 
@@ -129,6 +137,11 @@ class SubGraphKernel : public KernelExec {
 
   int DeleteSingleWayNode(KernelExec *kernel, bool keep_input);
 
+  // bumped whenever the nodes are changed after the subgraph is built, which invalidates what is planned on them.
+  size_t graph_version() const { return graph_version_; }
+
+  void IncreaseGraphVersion() { ++graph_version_; }
+
  protected:
   std::vector<KernelExec *> nodes_{};
   // entry nodes in nodes
@@ -137,6 +150,7 @@ class SubGraphKernel : public KernelExec {
   std::vector<KernelExec *> out_nodes_{};
   mindspore::lite::Executor *executor_ = nullptr;
   int schema_version_ = lite::SCHEMA_VERSION::SCHEMA_CUR;
+  size_t graph_version_ = 0;
 };
 
 class CpuSubGraph : public SubGraphKernel {
@@ -0,0 +1,170 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/sub_graph_profile.h"
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include "include/errorcode.h"
+#include "src/common/log_adapter.h"
+
+namespace mindspore::lite {
+int SubGraphProfile::Load() {
+  std::ifstream in_file(file_path_);
+  if (!in_file.is_open()) {
+    MS_LOG(INFO) << "No sub graph profile " << file_path_ << ", it is collected by the first runs.";
+    return RET_ERROR;
+  }
+  latencies_.clear();
+  std::string line;
+  while (std::getline(in_file, line)) {
+    if (line.empty() || line.front() == '#') {
+      continue;
+    }
+    // a line is the latency in us and the name of the node, which may contain spaces.
+    std::istringstream line_stream(line);
+    float latency = -1.0f;
+    std::string node_name;
+    line_stream >> latency;
+    (void)line_stream.get();
+    std::getline(line_stream, node_name);
+    if (line_stream.fail() || latency < 0 || node_name.empty()) {
+      MS_LOG(WARNING) << "Invalid line of sub graph profile " << file_path_ << ": " << line;
+      latencies_.clear();
+      return RET_ERROR;
+    }
+    latencies_[node_name] = latency;
+  }
+  loaded_ = !latencies_.empty();
+  return loaded_ ? RET_OK : RET_ERROR;
+}
+
+int SubGraphProfile::Save() const {
+  std::ofstream out_file(file_path_, std::ios::out | std::ios::trunc);
+  if (!out_file.is_open()) {
+    MS_LOG(WARNING) << "Open sub graph profile " << file_path_ << " failed.";
+    return RET_ERROR;
+  }
+  out_file << "# latency(us) node_name" << std::endl;
+  std::map<std::string, float> sorted_latencies(latencies_.begin(), latencies_.end());
+  for (const auto &latency : sorted_latencies) {
+    out_file << latency.second << " " << latency.first << std::endl;
+  }
+  if (!out_file.good()) {
+    MS_LOG(WARNING) << "Write sub graph profile " << file_path_ << " failed.";
+    return RET_ERROR;
+  }
+  MS_LOG(INFO) << "Save the latency of " << sorted_latencies.size() << " nodes to sub graph profile " << file_path_;
+  return RET_OK;
+}
+
+float SubGraphProfile::GetLatency(const std::string &node_name) const {
+  auto iter = latencies_.find(node_name);
+  return iter == latencies_.end() ? -1.0f : iter->second;
+}
+
+KernelCallBack SubGraphProfile::WrapBefore(const KernelCallBack &before) {
+  return [this, before](const Vector<tensor::MSTensor *> &inputs, const Vector<tensor::MSTensor *> &outputs,
+                        const CallBackParam &call_param) {
+    auto ret = before == nullptr ? true : before(inputs, outputs, call_param);
+    if (run_count_ >= kProfileWarmUpRuns) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      start_times_[call_param.node_name] = std::chrono::steady_clock::now();
+    }
+    return ret;
+  };
+}
+
+KernelCallBack SubGraphProfile::WrapAfter(const KernelCallBack &after) {
+  return [this, after](const Vector<tensor::MSTensor *> &inputs, const Vector<tensor::MSTensor *> &outputs,
+                       const CallBackParam &call_param) {
+    if (run_count_ >= kProfileWarmUpRuns) {
+      auto end_time = std::chrono::steady_clock::now();
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto iter = start_times_.find(call_param.node_name);
+      if (iter != start_times_.end()) {
+        total_latencies_[call_param.node_name] +=
+          std::chrono::duration<double, std::micro>(end_time - iter->second).count();
+      }
+    }
+    return after == nullptr ? true : after(inputs, outputs, call_param);
+  };
+}
+
+int SubGraphProfile::EndRun() {
+  if (!IsCollecting()) {
+    return RET_OK;
+  }
+  run_count_++;
+  if (IsCollecting()) {
+    return RET_OK;
+  }
+  latencies_.clear();
+  for (const auto &latency : total_latencies_) {
+    latencies_[latency.first] = static_cast<float>(latency.second / kProfileRuns);
+  }
+  total_latencies_.clear();
+  start_times_.clear();
+  return Save();
+}
+
+std::vector<size_t> ListScheduleBranches(const std::vector<size_t> &costs, size_t group_num) {
+  std::vector<size_t> groups(costs.size(), 0);
+  if (group_num == 0) {
+    return groups;
+  }
+  std::vector<size_t> order(costs.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&costs](size_t a, size_t b) { return costs[a] > costs[b]; });
+  std::vector<size_t> loads(group_num, 0);
+  for (auto index : order) {
+    auto group = static_cast<size_t>(std::min_element(loads.begin(), loads.end()) - loads.begin());
+    groups[index] = group;
+    loads[group] += costs[index];
+  }
+  return groups;
+}
+
+std::vector<size_t> AllocateGroupThreads(const std::vector<size_t> &loads, size_t thread_num) {
+  std::vector<size_t> threads(loads.size(), 1);
+  if (loads.empty() || thread_num <= loads.size()) {
+    return threads;
+  }
+  auto total_load = std::accumulate(loads.begin(), loads.end(), static_cast<size_t>(0));
+  size_t spare_threads = thread_num - loads.size();
+  size_t assigned = 0;
+  // the spare threads are split by the largest remainder method.
+  std::vector<std::pair<double, size_t>> remainders;
+  for (size_t i = 0; i < loads.size(); i++) {
+    double share = total_load == 0 ? static_cast<double>(spare_threads) / loads.size()
+                                   : static_cast<double>(spare_threads) * loads[i] / total_load;
+    auto whole = static_cast<size_t>(share);
+    threads[i] += whole;
+    assigned += whole;
+    remainders.emplace_back(share - whole, i);
+  }
+  std::stable_sort(remainders.begin(), remainders.end(),
+                   [](const std::pair<double, size_t> &a, const std::pair<double, size_t> &b) {
+                     return a.first > b.first;
+                   });
+  for (size_t i = 0; i < spare_threads - assigned && i < remainders.size(); i++) {
+    threads[remainders[i].second]++;
+  }
+  return threads;
+}
+}  // namespace mindspore::lite
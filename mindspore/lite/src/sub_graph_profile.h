@@ -0,0 +1,71 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_SUB_GRAPH_PROFILE_H_
+#define MINDSPORE_LITE_SRC_SUB_GRAPH_PROFILE_H_
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "include/lite_utils.h"
+
+namespace mindspore::lite {
+constexpr int kProfileWarmUpRuns = 1;
+constexpr int kProfileRuns = 3;
+
+// the measured latency of the nodes of a model, which guides the subgraph split for the parallel execution.
+class SubGraphProfile {
+ public:
+  explicit SubGraphProfile(std::string file_path) : file_path_(std::move(file_path)) {}
+  ~SubGraphProfile() = default;
+
+  // load the latency measured by a previous session of the model, RET_OK if loaded.
+  int Load();
+  int Save() const;
+  bool loaded() const { return loaded_; }
+  // the mean latency of the node in us, negative if the node is not profiled.
+  float GetLatency(const std::string &node_name) const;
+
+  // the kernels of the first runs are timed by the callbacks, and the warm up runs are not recorded.
+  bool IsCollecting() const { return !loaded_ && run_count_ < kProfileWarmUpRuns + kProfileRuns; }
+  KernelCallBack WrapBefore(const KernelCallBack &before);
+  KernelCallBack WrapAfter(const KernelCallBack &after);
+  // count a finished run, the profile is saved after the last profile run.
+  int EndRun();
+
+ private:
+  std::string file_path_;
+  bool loaded_ = false;
+  int run_count_ = 0;
+  // the kernels of the parallel subgraphs are timed by different threads.
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::chrono::steady_clock::time_point> start_times_;
+  std::unordered_map<std::string, double> total_latencies_;
+  std::unordered_map<std::string, float> latencies_;
+};
+
+// assign the branches to the groups by list scheduling: the branch of the longest critical path goes first, to the
+// group which is the least loaded. returns the group of each branch.
+std::vector<size_t> ListScheduleBranches(const std::vector<size_t> &costs, size_t group_num);
+
+// split the threads among the groups in proportion to their loads, each group has one thread at least.
+std::vector<size_t> AllocateGroupThreads(const std::vector<size_t> &loads, size_t thread_num);
+}  // namespace mindspore::lite
+
+#endif  // MINDSPORE_LITE_SRC_SUB_GRAPH_PROFILE_H_
@@ -683,7 +683,49 @@ void SearchSubGraph::InitSearchTensor() {
   return;
 }
 
+void SearchSubGraph::InitProfileRuntimeInfo(std::vector<Subgraph> *sub_graphs) {
+  std::vector<size_t> costs;
+  for (auto &sub_graph : *sub_graphs) {
+    costs.push_back(static_cast<size_t>(sub_graph.cost_.cost()));
+  }
+  auto groups = ListScheduleBranches(costs, kDefaultSubGraphSize);
+  std::vector<size_t> loads(kDefaultSubGraphSize, 0);
+  for (size_t i = 0; i < groups.size(); i++) {
+    loads.at(groups.at(i)) += costs.at(i);
+  }
+
+  /* the heavier group goes to major device */
+  uint32_t major_group = loads.at(kDefaultFirstSubgraph) >= loads.at(kDefaultSecondSubgraph) ? kDefaultFirstSubgraph
+                                                                                              : kDefaultSecondSubgraph;
+  std::vector<size_t> threads = {major_thread_, minor_thread_};
+  if (major_dt_ == DT_CPU && minor_dt_ == DT_CPU) {
+    std::vector<size_t> major_minor_loads = {loads.at(major_group), loads.at(1 - major_group)};
+    threads = AllocateGroupThreads(major_minor_loads, static_cast<size_t>(context_->thread_num_));
+  }
+  for (size_t i = 0; i < sub_graphs->size(); i++) {
+    bool is_major = groups.at(i) == major_group;
+    sub_graphs->at(i).device_ = is_major ? major_dt_ : minor_dt_;
+    sub_graphs->at(i).thread_ = is_major ? threads.at(kDefaultFirstSubgraph) : threads.at(kDefaultSecondSubgraph);
+    sub_graphs->at(i).tid_ = is_major ? 0 : 1;
+  }
+}
+
+bool SearchSubGraph::IsSplitProfitable(std::vector<Subgraph> *sub_graphs) {
+  if (profile_ == nullptr) {
+    return sub_graphs->at(kDefaultFirstSubgraph).cost_.cost() >= kMinSubgraphCost &&
+           sub_graphs->at(kDefaultSecondSubgraph).cost_.cost() >= kMinSubgraphCost;
+  }
+  /* the parallel latency is bounded by the longer subgraph */
+  size_t first_cost = static_cast<size_t>(sub_graphs->at(kDefaultFirstSubgraph).cost_.cost());
+  size_t second_cost = static_cast<size_t>(sub_graphs->at(kDefaultSecondSubgraph).cost_.cost());
+  return MSMIN(first_cost, second_cost) >= kMinParallelGain;
+}
+
 void SearchSubGraph::InitSubgraphRuntimeInfo(std::vector<Subgraph> *sub_graphs) {
+  if (profile_ != nullptr) {
+    InitProfileRuntimeInfo(sub_graphs);
+    return;
+  }
   std::vector<bool> tmp_group;
   std::vector<bool> cor_group;
 
@@ -780,7 +822,10 @@ void SearchSubGraph::CalculateCostModel(std::vector<Subgraph> *sub_graphs) {
       cost.mul_cost_ = 1;
 
       Model::Node *node = model_->all_nodes_[node_index];
-      if (GetPrimitiveType(node->primitive_, SCHEMA_VERSION::SCHEMA_CUR) == schema::PrimitiveType_Conv2DFusion) {
+      if (profile_ != nullptr) {
+        cost.mul_cost_ = static_cast<size_t>(profile_->GetLatency(node->name_) * kProfileCostScale);
+      } else if (GetPrimitiveType(node->primitive_, SCHEMA_VERSION::SCHEMA_CUR) ==
+                 schema::PrimitiveType_Conv2DFusion) {
         cost = CalculateConv2DFusion(node);
       }
 
@@ -803,8 +848,7 @@ void SearchSubGraph::SubGraphSplitByOutput() {
     CheckSubHeadEnd(&sub);
   }
 
-  if (sub_graphs_.at(kDefaultFirstSubgraph).cost_.cost() < kMinSubgraphCost ||
-      sub_graphs_.at(kDefaultSecondSubgraph).cost_.cost() < kMinSubgraphCost) {
+  if (!IsSplitProfitable(&sub_graphs_)) {
     return;
   }
 
@@ -836,8 +880,7 @@ void SearchSubGraph::SubGraphSplitByMiddle() {
 
     /* redo cost-model and pre-set-info after optimize */
     CalculateCostModel(&subgraphs);
-    if (subgraphs.at(kDefaultFirstSubgraph).cost_.cost() < kMinSubgraphCost ||
-        subgraphs.at(kDefaultSecondSubgraph).cost_.cost() < kMinSubgraphCost) {
+    if (!IsSplitProfitable(&subgraphs)) {
       continue;
     }
 
@@ -1054,6 +1097,21 @@ bool SearchSubGraph::ValidInParallel() {
   return true;
 }
 
+void SearchSubGraph::SetProfile(const SubGraphProfile *profile) {
+  if (profile == nullptr || !profile->loaded() || model_->sub_graphs_.empty()) {
+    return;
+  }
+  Model::SubGraph *main_graph = model_->sub_graphs_.front();
+  for (uint32_t node_index : main_graph->node_indices_) {
+    if (profile->GetLatency(model_->all_nodes_[node_index]->name_) < 0) {
+      MS_LOG(INFO) << "Node " << model_->all_nodes_[node_index]->name_
+                   << " is not in the sub graph profile, the profile is ignored.";
+      return;
+    }
+  }
+  profile_ = profile;
+}
+
 void SearchSubGraph::SubGraphSplit() {
   if (!ValidInParallel()) {
     return;
@@ -27,6 +27,7 @@
 #include "src/lite_model.h"
 #include "src/inner_context.h"
 #include "src/common/prim_util.h"
+#include "src/sub_graph_profile.h"
 #include "nnacl/conv_parameter.h"
 
 namespace mindspore::lite {
@@ -38,6 +39,9 @@ constexpr int kMaxMultyInNode = 20;
 constexpr int kMaxSubGraphCount = 10;
 constexpr int kMinSubgraphCost = 50;
 constexpr double kDefaultGpu = 0.5;
+/* the profiled cost is in 0.1us, and the split must save 50us of the serial latency at least */
+constexpr float kProfileCostScale = 10.0f;
+constexpr size_t kMinParallelGain = 500;
 class SearchSubGraph {
   enum TensorType { NORMAL, CONST, INPUT };
 
@@ -89,6 +93,7 @@ class SearchSubGraph {
  public:
   void SubGraphSplit();
   void SubGraphSplitByOperator();
+  void SetProfile(const SubGraphProfile *profile);
   void InsertNodeBegin(uint32_t index, Subgraph *subgraph, std::vector<size_t> *outputs);
 
  private: /* split by output */
@@ -131,6 +136,8 @@ class SearchSubGraph {
 
  private: /* public cost-model func  */
   CostModel CalculateConv2DFusion(const Model::Node *node);
+  void InitProfileRuntimeInfo(std::vector<Subgraph> *sub_graphs);
+  bool IsSplitProfitable(std::vector<Subgraph> *sub_graphs);
   void dfs(int i, int n, int current_sum, int except_value, int *min_value, std::vector<bool> *tmp_group,
            std::vector<bool> *cor_group, std::vector<Subgraph> *sub_graphs);
 
@@ -150,6 +157,7 @@ class SearchSubGraph {
   size_t minor_thread_;
   size_t total_cost_ = 0;
   bool offline_parallel_enable_ = false;
+  const SubGraphProfile *profile_ = nullptr; /* used only if all nodes of the main graph are profiled */
 };
 }  // namespace mindspore::lite
 
@@ -25,6 +25,7 @@
 #include <queue>
 #include <map>
 #include <set>
+#include <functional>
 #include "include/errorcode.h"
 #include "src/lite_model.h"
 #include "src/kernel_exec_util.h"
@@ -288,7 +289,23 @@ int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels)
     }
   }
   // Set Tensor data
-  auto size = allocator.total_size();
+  planned_tensors_size_ = allocator.total_size();
+  auto ret = ReallocTensorsData(allocator.total_size());
+  if (ret != RET_OK) {
+    return ret;
+  }
+  for (auto kernel : train_kernels_) {
+    for (auto tensor : kernel->out_tensors()) {
+      auto it = offset_map.find(tensor);
+      if (it != offset_map.end()) {
+        tensor->set_data(reinterpret_cast<void *>(reinterpret_cast<char *>(tensors_data_) + it->second));
+      }
+    }
+  }
+  return RET_OK;
+}
+
+int TrainSession::ReallocTensorsData(size_t size) {
   if (size > tensors_data_size_) {
     free(tensors_data_);
     tensors_data_ = nullptr;
@@ -304,12 +321,249 @@ int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels)
     tensors_data_ = buf;
     tensors_data_size_ = size;
   }
-  for (auto kernel : train_kernels_) {
+  return RET_OK;
+}
+
+int TrainSession::AllocTrainTensors() {
+  train_steps_.clear();
+  recompute_kernel_num_ = 0;
+  if ((cfg_.recompute_memory_budget_ == 0 && cfg_.recompute_names_.empty()) || !IS_STATIC_ALLOCATOR(allocator_)) {
+    return AllocTensors(train_kernels_);
+  }
+  if (context_->IsCpuFloat16Enabled()) {
+    MS_LOG(WARNING) << "Recompute is not supported in mix precision training, all the activations are kept.";
+    return AllocTensors(train_kernels_);
+  }
+  return CompileRecompute();
+}
+
+bool TrainSession::IsRecomputeKernel(kernel::KernelExec *kernel) {
+  // the kernels which have states or random outputs can not run twice in a step.
+  static const std::set<schema::PrimitiveType> kNotRecomputeKernels = {
+    schema::PrimitiveType_Dropout, schema::PrimitiveType_RandomNormal, schema::PrimitiveType_RandomStandardNormal,
+    schema::PrimitiveType_UniformReal, schema::PrimitiveType_AssignAdd};
+  if (IsGradKernel(kernel) || IsLossKernel(kernel) || IsMaskOutput(kernel) || IsBN(kernel) ||
+      kNotRecomputeKernels.find(kernel->type()) != kNotRecomputeKernels.end()) {
+    return false;
+  }
+  auto is_output = [](const std::unordered_map<std::string, mindspore::tensor::MSTensor *> &output_map,
+                      const lite::Tensor *tensor) {
+    return std::any_of(output_map.begin(), output_map.end(),
+                       [tensor](const auto &output) { return output.second == tensor; });
+  };
+  for (auto tensor : kernel->out_tensors()) {
+    if (tensor->category() != lite::Category::VAR || is_output(train_output_tensor_map_, tensor) ||
+        is_output(eval_output_tensor_map_, tensor)) {
+      return false;
+    }
+  }
+  return std::any_of(kernel->out_kernels().begin(), kernel->out_kernels().end(),
+                     [this](const kernel::KernelExec *post_kernel) { return IsGradKernel(post_kernel); });
+}
+
+int TrainSession::BuildRecomputeSchedule(const std::set<kernel::KernelExec *> &recompute_kernels,
+                                         std::vector<kernel::KernelExec *> *schedule) {
+  std::unordered_map<lite::Tensor *, kernel::KernelExec *> producers;
+  for (auto kernel : recompute_kernels) {
     for (auto tensor : kernel->out_tensors()) {
-      auto it = offset_map.find(tensor);
-      if (it != offset_map.end()) {
-        tensor->set_data(reinterpret_cast<void *>(reinterpret_cast<char *>(tensors_data_) + it->second));
+      producers[tensor] = kernel;
+    }
+  }
+  std::set<kernel::KernelExec *> recomputed;
+  // the weights updated by the optimizers, the kernels reading them can not be recomputed after the update.
+  std::set<lite::Tensor *> updated_tensors;
+  std::function<int(kernel::KernelExec *)> recompute = [&](kernel::KernelExec *kernel) {
+    if (recomputed.find(kernel) != recomputed.end()) {
+      return RET_OK;
+    }
+    for (auto tensor : kernel->in_tensors()) {
+      if (updated_tensors.find(tensor) != updated_tensors.end()) {
+        MS_LOG(DEBUG) << kernel->name() << " can not be recomputed after its input " << tensor->tensor_name()
+                      << " is updated.";
+        return RET_NOT_SUPPORT;
+      }
+      auto iter = producers.find(tensor);
+      if (iter != producers.end()) {
+        auto ret = recompute(iter->second);
+        if (ret != RET_OK) {
+          return ret;
+        }
+      }
+    }
+    schedule->push_back(kernel);
+    (void)recomputed.insert(kernel);
+    return RET_OK;
+  };
+
+  schedule->clear();
+  for (auto kernel : train_kernels_) {
+    // the dropped activations are recomputed right before the first grad kernel which uses them.
+    if (IsGradKernel(kernel)) {
+      for (auto tensor : kernel->in_tensors()) {
+        auto iter = producers.find(tensor);
+        if (iter == producers.end()) {
+          continue;
+        }
+        auto ret = recompute(iter->second);
+        if (ret != RET_OK) {
+          return ret;
+        }
+      }
+    }
+    schedule->push_back(kernel);
+    if (IsMaskOutput(kernel)) {
+      updated_tensors.insert(kernel->in_tensors().begin(), kernel->in_tensors().end());
+    }
+  }
+  return RET_OK;
+}
+
+void TrainSession::PlanTrainSteps(const std::vector<kernel::KernelExec *> &schedule, std::vector<TrainStep> *steps,
+                                  size_t *size) {
+  // a tensor produced again by a recomputed kernel starts a new lifetime, which ends at the last use of the new data.
+  std::vector<std::unordered_map<lite::Tensor *, int>> uses(schedule.size());
+  std::unordered_map<lite::Tensor *, size_t> producers;
+  std::unordered_map<lite::Tensor *, int> total_uses;
+  for (size_t i = 0; i < schedule.size(); i++) {
+    for (auto tensor : schedule[i]->in_tensors()) {
+      auto iter = producers.find(tensor);
+      if (iter != producers.end()) {
+        uses[iter->second][tensor]++;
+      }
+    }
+    for (auto tensor : schedule[i]->out_tensors()) {
+      producers[tensor] = i;
+    }
+  }
+  for (auto kernel : train_kernels_) {
+    for (auto tensor : kernel->in_tensors()) {
+      total_uses[tensor]++;
+    }
+  }
+
+  OptAllocator allocator;
+  std::unordered_map<lite::Tensor *, int> ref_count;
+  std::unordered_map<lite::Tensor *, size_t> offset_map;
+  std::set<kernel::KernelExec *> executed;
+  steps->clear();
+  for (size_t i = 0; i < schedule.size(); i++) {
+    auto kernel = schedule[i];
+    bool is_recompute = !executed.insert(kernel).second;
+    TrainStep step;
+    step.kernel = kernel;
+    for (size_t j = 0; j < kernel->out_tensors().size(); j++) {
+      auto tensor = kernel->out_tensors().at(j);
+      uint32_t input_idx = 0;
+      // the input is reused only at its last use, as it may be read again by a recomputed kernel.
+      bool in_place = (i != 0) && IsInPlaceTensor(kernel, j, ref_count, &input_idx) &&
+                      ref_count.at(kernel->in_tensors().at(input_idx)) == 1;
+      size_t offset = in_place ? GetInplaceTensorOffset(kernel, offset_map, &ref_count, input_idx)
+                               : allocator.Malloc(tensor->Size());
+      offset_map[tensor] = offset;
+      ref_count[tensor] = uses[i][tensor];
+      if (producers.at(tensor) == i) {
+        // the outputs of the graph are kept alive by the extra reference counts.
+        ref_count[tensor] += std::max(tensor->init_ref_count() - total_uses[tensor], 0);
+      }
+      step.out_offsets.emplace_back(tensor, offset);
+    }
+    for (auto tensor : kernel->in_tensors()) {
+      auto iter = ref_count.find(tensor);
+      if (tensor->category() != lite::Category::VAR || iter == ref_count.end()) {
+        continue;
+      }
+      if (--iter->second == 0) {
+        allocator.Free(offset_map[tensor]);
+      }
+    }
+    if (is_recompute) {
+      // the recomputed outputs which no grad kernel uses are released at once.
+      for (auto &out_offset : step.out_offsets) {
+        if (ref_count[out_offset.first] == 0) {
+          allocator.Free(out_offset.second);
+        }
+      }
+    }
+    steps->push_back(step);
+  }
+  *size = allocator.total_size();
+}
+
+int TrainSession::CompileRecompute() {
+  std::vector<TrainStep> steps;
+  size_t size = 0;
+  PlanTrainSteps(train_kernels_, &steps, &size);
+  auto origin_size = size;
+  std::set<kernel::KernelExec *> recompute_kernels;
+  // a kernel is recomputed only if the schedule is valid, and for the budget, only if the tensors take less memory.
+  auto try_recompute = [&](kernel::KernelExec *kernel, bool force) {
+    (void)recompute_kernels.insert(kernel);
+    std::vector<kernel::KernelExec *> schedule;
+    if (BuildRecomputeSchedule(recompute_kernels, &schedule) == RET_OK) {
+      std::vector<TrainStep> new_steps;
+      size_t new_size = 0;
+      PlanTrainSteps(schedule, &new_steps, &new_size);
+      if (force || new_size < size) {
+        steps = std::move(new_steps);
+        size = new_size;
+        return;
+      }
+    }
+    (void)recompute_kernels.erase(kernel);
+  };
+
+  std::vector<kernel::KernelExec *> candidates;
+  for (auto kernel : train_kernels_) {
+    if (!IsRecomputeKernel(kernel)) {
+      continue;
+    }
+    auto &names = cfg_.recompute_names_;
+    bool selected = std::any_of(names.begin(), names.end(), [kernel](const std::string &name) {
+      return kernel->name().find(name) != std::string::npos;
+    });
+    if (selected) {
+      try_recompute(kernel, true);
+    } else {
+      candidates.push_back(kernel);
+    }
+  }
+  if (cfg_.recompute_memory_budget_ > 0) {
+    // the kernels with the largest outputs are recomputed first, till the tensors fit the budget.
+    auto output_size = [](const kernel::KernelExec *kernel) {
+      size_t total = 0;
+      for (auto tensor : kernel->out_tensors()) {
+        total += tensor->Size();
+      }
+      return total;
+    };
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [&output_size](const kernel::KernelExec *a, const kernel::KernelExec *b) {
+                       return output_size(a) > output_size(b);
+                     });
+    for (auto kernel : candidates) {
+      if (size <= cfg_.recompute_memory_budget_) {
+        break;
       }
+      try_recompute(kernel, false);
+    }
+    if (size > cfg_.recompute_memory_budget_) {
+      MS_LOG(WARNING) << "The train tensors take " << size << " bytes, which exceeds the recompute memory budget "
+                      << cfg_.recompute_memory_budget_ << " bytes.";
+    }
+  }
+  MS_LOG(INFO) << "Recompute " << recompute_kernels.size() << " kernels, the train tensors take " << size
+               << " bytes instead of " << origin_size << " bytes.";
+
+  planned_tensors_size_ = size;
+  recompute_kernel_num_ = recompute_kernels.size();
+  auto ret = ReallocTensorsData(size);
+  if (ret != RET_OK) {
+    return ret;
+  }
+  train_steps_ = std::move(steps);
+  for (auto &step : train_steps_) {
+    for (auto &out_offset : step.out_offsets) {
+      out_offset.first->set_data(reinterpret_cast<void *>(reinterpret_cast<char *>(tensors_data_) + out_offset.second));
     }
   }
   return RET_OK;
@@ -383,6 +637,22 @@ int TrainSession::ExecKernels(const KernelCallBack &before, const KernelCallBack
   return RET_OK;
 }
 
+int TrainSession::ExecTrainSteps(const KernelCallBack &before, const KernelCallBack &after) {
+  for (auto &step : train_steps_) {
+    MS_ASSERT(step.kernel != nullptr);
+    // the out tensors of a recomputed kernel are placed at a new offset from the forward ones.
+    for (auto &out_offset : step.out_offsets) {
+      out_offset.first->set_data(reinterpret_cast<void *>(reinterpret_cast<char *>(tensors_data_) + out_offset.second));
+    }
+    auto ret = step.kernel->Execute(before, after);
+    if (RET_OK != ret) {
+      MS_LOG(ERROR) << "Execute kernel failed, name: " << step.kernel->name();
+      return ret;
+    }
+  }
+  return RET_OK;
+}
+
 void TrainSession::RestoreTensorData() {
   for (auto &restored_origin_tensor : restored_origin_tensors_) {
     auto *origin_tensor = restored_origin_tensor.first;
@@ -558,6 +828,8 @@ int TrainSession::RunGraph(const KernelCallBack &before, const KernelCallBack &a
   auto &run_kernels = (train_mode_) ? train_kernels_ : inference_kernels_;
   if (context_->IsCpuFloat16Enabled()) {
     ret = MixPrecisionExecKernels(before, after, run_kernels);
+  } else if (train_mode_ && !train_steps_.empty()) {
+    ret = ExecTrainSteps(before, after);
   } else {
     ret = ExecKernels(before, after, run_kernels);
   }
@@ -604,7 +876,7 @@ int TrainSession::Train() {
     }
   }
   // allocate tensors
-  auto ret = AllocTensors(train_kernels_);
+  auto ret = AllocTrainTensors();
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "failed to allocate tensor space";
     return RET_ERROR;
@@ -1078,7 +1350,7 @@ int TrainSession::Resize(const std::vector<tensor::MSTensor *> &inputs, const st
     MS_LOG(ERROR) << "failed to allocate space";
     return RET_ERROR;
   }
-  ret = AllocTensors(train_kernels_);
+  ret = train_mode_ ? AllocTrainTensors() : AllocTensors(train_kernels_);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "train alloc failed after resize.";
     return RET_ERROR;
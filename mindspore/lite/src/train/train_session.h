@@ -21,6 +21,8 @@
 #include <unordered_map>
 #include <memory>
 #include <map>
+#include <set>
+#include <utility>
 #include "include/train/train_cfg.h"
 #include "include/train/train_session.h"
 #include "src/lite_session.h"
@@ -62,6 +64,9 @@ class TrainSession : virtual public lite::LiteSession {
   bool IsEval() override { return !train_mode_; }
   int SetLearningRate(float learning_rate) override;
   float GetLearningRate() override;
+  size_t GetPlannedTensorsSize() const override { return planned_tensors_size_; }
+  // how many forward kernels run again in backward, 0 if the activations are not recomputed.
+  size_t recompute_kernel_num() const { return recompute_kernel_num_; }
   std::vector<tensor::MSTensor *> GetGradients() const override;
   std::vector<tensor::MSTensor *> GetOptimizerParams() const override;
   int SetOptimizerParams(const std::vector<tensor::MSTensor *> &params) override;
@@ -142,6 +147,12 @@ class TrainSession : virtual public lite::LiteSession {
   TrainCfg cfg_;
 
  private:
+  // a kernel of the train step, and the offsets in tensors_data_ of its out tensors, which are set before it runs.
+  struct TrainStep {
+    kernel::KernelExec *kernel = nullptr;
+    std::vector<std::pair<lite::Tensor *, size_t>> out_offsets;
+  };
+
   std::vector<std::string> get_loss_name() const { return cfg_.loss_name_; }
   void BuildInferenceKernelsRecursive(kernel::KernelExec *ker, std::vector<kernel::KernelExec *> *req_kernels);
   int AdminSetupVirtualBatch(int virtual_batch_multiplier, float lr, float momentum);
@@ -158,6 +169,14 @@ class TrainSession : virtual public lite::LiteSession {
   bool AllInputsNeedScale(kernel::KernelExec *kernel);
   void FreeWorkSpace();
   int AllocTensors(const std::vector<kernel::KernelExec *> &kernels);
+  int AllocTrainTensors();
+  int ReallocTensorsData(size_t size);
+  bool IsRecomputeKernel(kernel::KernelExec *kernel);
+  int BuildRecomputeSchedule(const std::set<kernel::KernelExec *> &recompute_kernels,
+                             std::vector<kernel::KernelExec *> *schedule);
+  void PlanTrainSteps(const std::vector<kernel::KernelExec *> &schedule, std::vector<TrainStep> *steps, size_t *size);
+  int CompileRecompute();
+  int ExecTrainSteps(const KernelCallBack &before, const KernelCallBack &after);
   bool IsInPlaceKernel(kernel::KernelExec *kernel);
   bool IsInPlaceTensor(kernel::KernelExec *kernel, uint32_t idx,
                        const std::unordered_map<lite::Tensor *, int> &ref_count, uint32_t *input_idx);
@@ -174,6 +193,10 @@ class TrainSession : virtual public lite::LiteSession {
   bool train_mode_ = false;
   void *tensors_data_ = nullptr;
   unsigned int tensors_data_size_ = 0;
+  size_t planned_tensors_size_ = 0;
+  size_t recompute_kernel_num_ = 0;
+  // the train kernels with the recomputed forward ones, empty if the activations are not recomputed.
+  std::vector<TrainStep> train_steps_;
   std::shared_ptr<Allocator> allocator_;
 };
 
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include "src/weight_decoder.h"
@@ -103,7 +104,6 @@ int WeightDecoder::DecodeHuffmanCode(const SchemaTensorWrapper &src_tensor, lite
   if (data == nullptr) {
     return RET_NO_CHANGE;
   }
-  std::string encode_str(data, src_tensor.length());
   dst_tensor->FreeData();
   dst_tensor->set_data(nullptr);
   auto ret = dst_tensor->MallocData();
@@ -113,7 +113,7 @@ int WeightDecoder::DecodeHuffmanCode(const SchemaTensorWrapper &src_tensor, lite
   }
   auto dst_data = dst_tensor->data();
   MS_ASSERT(dst_data != nullptr);
-  ret = HuffmanDecode::DoHuffmanDecode(encode_str, dst_data, dst_tensor->Size());
+  ret = HuffmanDecode::DoHuffmanDecode(data, src_tensor.length(), dst_data, dst_tensor->Size());
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "DoHuffmanDecode failed.";
     return ret;
@@ -455,8 +455,48 @@ bool NeedBitUppackCheck(const SchemaTensorWrapper &src_tensor) {
   return need_bit_unpack;
 }
 
+bool WeightDecoder::IsQuantWeightComputable(const OpParameter *op_parameter, const std::vector<Tensor *> &in_tensors,
+                                            int index) {
+#if !defined(WEIGHT_DECODE_CLIP) && defined(ENABLE_AVX)
+  MS_ASSERT(op_parameter != nullptr);
+  auto op_type = op_parameter->type_;
+  if (op_parameter->quant_type_ != schema::QuantType_QUANT_WEIGHT || op_parameter->is_train_session_ ||
+      index != kWeightIndex || static_cast<int>(in_tensors.size()) <= index ||
+      (op_type != schema::PrimitiveType_MatMulFusion && op_type != schema::PrimitiveType_FullConnection)) {
+    return false;
+  }
+  auto param = reinterpret_cast<const MatMulParameter *>(op_parameter);
+  bool is_matmul = op_type == schema::PrimitiveType_MatMulFusion;
+  if ((is_matmul && param->a_transpose_) ||
+      (param->act_type_ != ActType_No && param->act_type_ != ActType_Relu && param->act_type_ != ActType_Relu6)) {
+    return false;
+  }
+  auto weight = in_tensors.at(index);
+  if (weight == nullptr || !weight->IsConst() || weight->data() == nullptr ||
+      weight->data_type() != kNumberTypeInt8 || weight->shape().size() != DIMENSION_2D) {
+    return false;
+  }
+  if (static_cast<int>(in_tensors.size()) > kBiasIndex && !in_tensors.at(kBiasIndex)->IsConst()) {
+    return false;
+  }
+  // only the per-channel or per-layer affine quantization, the kmeans clusters and the bias correction are left to
+  // the dequantization.
+  auto quant_params = weight->quant_params();
+  auto col = (!is_matmul || param->b_transpose_) ? weight->shape().front() : weight->shape().back();
+  if (quant_params.size() != kPerTensor && static_cast<int>(quant_params.size()) != col) {
+    return false;
+  }
+  return std::all_of(quant_params.begin(), quant_params.end(), [](const LiteQuantParam &quant_param) {
+    return quant_param.inited && quant_param.clusters.empty() && quant_param.var_corr == 1 &&
+           quant_param.mean_corr == 0;
+  });
+#else
+  return false;
+#endif
+}
+
 int WeightDecoder::DequantNode(OpParameter *op_parameter, const std::vector<Tensor *> &in_tensors, TypeId dst_data_type,
-                               const std::string &model_version, bool float_mode) {
+                               const std::string &model_version, bool float_mode, bool keep_quant_weight) {
 #ifndef WEIGHT_DECODE_CLIP
   if (op_parameter->quant_type_ != schema::QuantType_QUANT_WEIGHT &&
       !(op_parameter->quant_type_ == schema::QuantType_QUANT_ALL && float_mode)) {
@@ -465,6 +505,10 @@ int WeightDecoder::DequantNode(OpParameter *op_parameter, const std::vector<Tens
   int index = 0;
   for (auto &tensor : in_tensors) {
     MS_CHECK_TRUE_RET(tensor != nullptr, RET_ERROR);
+    if (keep_quant_weight && IsQuantWeightComputable(op_parameter, in_tensors, index)) {
+      index++;
+      continue;
+    }
     auto preferred_dim = GetPreferredDim(in_tensors, op_parameter, index++, tensor->shape(), model_version);
     auto ret = WeightDecoder::DequantTensor(tensor, preferred_dim, dst_data_type);
     if (ret != RET_OK && ret != RET_NO_CHANGE) {
@@ -41,7 +41,11 @@ namespace mindspore::lite {
 class WeightDecoder {
  public:
   static int DequantNode(OpParameter *op_parameter, const std::vector<Tensor *> &in_tensors, TypeId dst_data_type,
-                         const std::string &model_version, bool float_mode);
+                         const std::string &model_version, bool float_mode, bool keep_quant_weight = false);
+  // Whether the fp32 cpu kernel of the node computes with the int8/int4 weight directly, so that the weight is kept
+  // quantized in memory instead of being dequantized at load time.
+  static bool IsQuantWeightComputable(const OpParameter *op_parameter, const std::vector<Tensor *> &in_tensors,
+                                      int index);
   static int DecompressTensor(const SchemaTensorWrapper &src_tensor, lite::Tensor *dst_tensor);
 
   template <typename T>
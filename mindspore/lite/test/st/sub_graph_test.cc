@@ -315,7 +315,7 @@ TEST_F(SubGraphTest, RecursiveSubGraphTest) {
   meta_graph->version = lite::Version();
   //  -----------------------------------------------------------------------
   lite::MetaGraphSerializer::Save(
-    *meta_graph, "/mnt/data/workspace/OpenAI/Huawei/mindspore/mindspore/lite/my_test/models/recursive_subgraph");
+    meta_graph.get(), "/mnt/data/workspace/OpenAI/Huawei/mindspore/mindspore/lite/my_test/models/recursive_subgraph");
   //  -----------------------------------------------------------------------
   size_t size = 0;
   char *graph_buf = lite::ReadFile(
@@ -0,0 +1,160 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/int8/matmul_int8.h"
+#include "nnacl/int8/fixed_point.h"
+#if defined(ENABLE_AVX512_VNNI_INT8) || defined(ENABLE_AVX_VNNI_INT8)
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
+
+namespace mindspore {
+class TestMatmulInt8Opt : public mindspore::CommonTest {
+ public:
+  TestMatmulInt8Opt() {}
+
+  void SetUp() override {
+#if defined(ENABLE_AVX512_VNNI_INT8) || defined(ENABLE_AVX_VNNI_INT8)
+    (void)IntelX86CpuInfoInit();
+#endif
+  }
+};
+
+namespace {
+struct MatmulInt8OptData {
+  int row = 0;
+  int col = 0;
+  int deep16 = 0;
+  size_t stride = 0;
+  bool peroc = false;
+  int act_min = INT8_MIN;
+  int act_max = INT8_MAX;
+  int out_zp = 0;
+  std::vector<int8_t> a;
+  std::vector<int8_t> b;
+  std::vector<int> a_sums;
+  std::vector<int> bias;
+  std::vector<int32_t> multiplier;
+  std::vector<int32_t> left_shift;
+  std::vector<int32_t> right_shift;
+  std::vector<int32_t> filter_zp;
+};
+
+MatmulInt8OptData GenMatmulInt8OptData(int row, int col, int deep, bool peroc, std::mt19937 *gen) {
+  std::uniform_int_distribution<int> int8_dist(INT8_MIN, INT8_MAX);
+  std::uniform_int_distribution<int> sum_dist(-10000, 10000);
+  std::uniform_int_distribution<int> bias_dist(-100000, 100000);
+  std::uniform_int_distribution<int32_t> multiplier_dist(1 << 30, INT32_MAX);
+  std::uniform_int_distribution<int> shift_dist(0, 11);
+  MatmulInt8OptData data;
+  data.row = row;
+  data.col = col;
+  data.deep16 = UP_ROUND(deep, C16NUM);
+  data.stride = col + 1;
+  data.peroc = peroc;
+  data.act_min = INT8_MIN + shift_dist(*gen);
+  data.act_max = INT8_MAX - shift_dist(*gen);
+  data.out_zp = shift_dist(*gen) - C4NUM;
+  // a and b are generated in the packed layout directly
+  data.a.resize(UP_ROUND(row, C4NUM) * data.deep16);
+  data.b.resize(UP_ROUND(col, C4NUM) * data.deep16);
+  for (auto &value : data.a) {
+    value = static_cast<int8_t>(int8_dist(*gen));
+  }
+  for (auto &value : data.b) {
+    value = static_cast<int8_t>(int8_dist(*gen));
+  }
+  for (int r = 0; r < row; r++) {
+    data.a_sums.push_back(sum_dist(*gen));
+  }
+  for (int c = 0; c < col; c++) {
+    data.bias.push_back(bias_dist(*gen));
+    data.multiplier.push_back(multiplier_dist(*gen));
+    data.left_shift.push_back(shift_dist(*gen) % C2NUM);
+    data.right_shift.push_back(-shift_dist(*gen));
+    data.filter_zp.push_back(shift_dist(*gen) - C4NUM);
+  }
+  return data;
+}
+
+// the scalar version of MatmulInt8Opt, which is used as the reference of the simd kernels
+void MatmulInt8OptRef(const MatmulInt8OptData &data, int8_t *dst) {
+  for (int r = 0; r < data.row; r++) {
+    for (int c = 0; c < data.col; c++) {
+      int r4div = r / C4NUM, r4mod = r % C4NUM;
+      int c4div = c / C4NUM, c4mod = c % C4NUM;
+      int32_t value = 0;
+      for (int d = 0; d < data.deep16; d++) {
+        int d16div = d / C16NUM, d16mod = d % C16NUM;
+        int ai = r4div * data.deep16 * C4NUM + d16div * C4NUM * C16NUM + r4mod * C16NUM + d16mod;
+        int bi = c4div * data.deep16 * C4NUM + d16div * C4NUM * C16NUM + c4mod * C16NUM + d16mod;
+        value += data.a[ai] * data.b[bi];
+      }
+      int param_index = data.peroc ? c : 0;
+      value -= data.peroc ? data.a_sums[r] * data.filter_zp[c] : data.a_sums[r];
+      value += data.bias[c];
+      value = MultiplyByQuantizedMultiplier(value, data.multiplier[param_index], data.left_shift[param_index],
+                                            data.right_shift[param_index]) +
+              data.out_zp;
+      value = MSMIN(data.act_max, value);
+      value = MSMAX(data.act_min, value);
+      dst[r * data.stride + c] = static_cast<int8_t>(value);
+    }
+  }
+}
+
+void RunMatmulInt8Opt(const MatmulInt8OptData &data, int8_t *dst) {
+  MatmulInt8Opt(data.a.data(), data.b.data(), dst, data.row, data.col, data.deep16, data.a_sums.data(),
+                data.bias.data(), data.act_min, data.act_max, data.out_zp, data.multiplier.data(),
+                data.left_shift.data(), data.right_shift.data(), data.stride, data.peroc, data.filter_zp.data());
+}
+}  // namespace
+
+TEST_F(TestMatmulInt8Opt, RandomShape) {
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<int> row_dist(1, 37);
+  std::uniform_int_distribution<int> col_dist(1, 45);
+  std::uniform_int_distribution<int> deep_dist(1, 100);
+  constexpr int kTestNum = 100;
+  for (int i = 0; i < kTestNum; i++) {
+    auto data = GenMatmulInt8OptData(row_dist(gen), col_dist(gen), deep_dist(gen), i % C2NUM == 0, &gen);
+    // the padding of each output row must not be written
+    std::vector<int8_t> expect(data.row * data.stride, 0);
+    std::vector<int8_t> output(data.row * data.stride, 0);
+    MatmulInt8OptRef(data, expect.data());
+    RunMatmulInt8Opt(data, output.data());
+    ASSERT_EQ(0, CompareOutputData(output.data(), expect.data(), output.size(), 0));
+  }
+}
+
+// a deep enough matmul to run many blocks of the vnni kernels, with both the per channel and the per layer params.
+TEST_F(TestMatmulInt8Opt, LargeShape) {
+  constexpr int kRow = 64;
+  constexpr int kCol = 96;
+  constexpr int kDeep = 1024;
+  std::mt19937 gen(2);
+  for (bool peroc : {true, false}) {
+    auto data = GenMatmulInt8OptData(kRow, kCol, kDeep, peroc, &gen);
+    data.stride = kCol;
+    std::vector<int8_t> expect(kRow * kCol, 0);
+    std::vector<int8_t> output(kRow * kCol, 0);
+    MatmulInt8OptRef(data, expect.data());
+    RunMatmulInt8Opt(data, output.data());
+    ASSERT_EQ(0, CompareOutputData(output.data(), expect.data(), output.size(), 0));
+  }
+}
+}  // namespace mindspore
@@ -0,0 +1,195 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "src/inner_context.h"
+#include "src/delegate/parameter_cache/lfu_cache.h"
+#include "src/delegate/parameter_cache/flat_lfu_cache.h"
+
+namespace mindspore {
+class ParameterCacheTest : public mindspore::CommonTest {
+ public:
+  ParameterCacheTest() {}
+};
+
+namespace {
+constexpr int kVocabSize = 200000;
+constexpr int kCacheSize = 20000;
+constexpr size_t kBatchSize = 16000;
+constexpr int kBatchNum = 50;
+
+// the ids of recommendation models follow a zipfian distribution.
+std::vector<int> ZipfianIds(int vocab_size, double skew, size_t count, uint32_t seed) {
+  std::vector<double> cdf(vocab_size);
+  double sum = 0;
+  for (int i = 0; i < vocab_size; i++) {
+    sum += 1.0 / std::pow(i + 1, skew);
+    cdf[i] = sum;
+  }
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(0, sum);
+  // the popular ids are scattered over the vocab instead of being the smallest ones.
+  std::vector<int> permutation(vocab_size);
+  for (int i = 0; i < vocab_size; i++) {
+    permutation[i] = i;
+  }
+  std::shuffle(permutation.begin(), permutation.end(), gen);
+  std::vector<int> ids(count);
+  for (auto &id : ids) {
+    auto rank = std::lower_bound(cdf.begin(), cdf.end(), dist(gen)) - cdf.begin();
+    id = permutation[std::min(static_cast<int>(rank), vocab_size - 1)];
+  }
+  return ids;
+}
+
+std::shared_ptr<cache::CacheAlgorithm> CreateCache(bool flat) {
+  std::shared_ptr<cache::CacheAlgorithm> cache;
+  if (flat) {
+    cache = std::make_shared<cache::FlatLFUCacheAlgorithm>();
+  } else {
+    cache = std::make_shared<cache::LFUCacheAlgorithm>();
+  }
+  if (cache->Init(kCacheSize, 0, kVocabSize) != kSuccess) {
+    return nullptr;
+  }
+  for (int i = 0; i < kCacheSize; i++) {
+    cache->Put(i, i);
+  }
+  return cache;
+}
+
+// run the batches and check that every id gets the cache index which holds it, returns the hit rate.
+double RunBatches(cache::CacheAlgorithm *cache, const std::vector<int> &ids) {
+  std::vector<int> cache_index(kBatchSize);
+  std::vector<int> holders(kCacheSize);
+  for (int i = 0; i < kCacheSize; i++) {
+    holders[i] = i;
+  }
+  size_t swap_num = 0;
+  for (int batch = 0; batch < kBatchNum; batch++) {
+    const int *batch_ids = ids.data() + batch * kBatchSize;
+    std::vector<int> swap_ids;
+    std::vector<int> swap_index;
+    auto ret = cache->CheckCacheHit(batch_ids, kBatchSize, cache_index.data(), &swap_ids, &swap_index);
+    if (ret != kSuccess || swap_ids.size() != swap_index.size()) {
+      return -1;
+    }
+    for (size_t i = 0; i < swap_ids.size(); i++) {
+      holders[swap_index[i]] = swap_ids[i];
+    }
+    for (size_t i = 0; i < kBatchSize; i++) {
+      if (cache_index[i] < 0 || cache_index[i] >= kCacheSize || holders[cache_index[i]] != batch_ids[i]) {
+        return -1;
+      }
+    }
+    swap_num += swap_ids.size();
+  }
+  return 1.0 - static_cast<double>(swap_num) / (kBatchSize * kBatchNum);
+}
+}  // namespace
+
+TEST_F(ParameterCacheTest, FlatLFUEvict) {
+  cache::FlatLFUCacheAlgorithm cache;
+  ASSERT_EQ(cache.Init(2, 10, 20), kSuccess);
+  cache.Put(10, 0);
+  cache.Put(11, 1);
+  ASSERT_EQ(cache.Get(10), 0);
+  ASSERT_EQ(cache.Get(10), 0);
+  ASSERT_EQ(cache.Get(11), 1);
+  // 11 is used less than 10
+  cache.Put(12, 1);
+  ASSERT_EQ(cache.Get(11), -1);
+  ASSERT_EQ(cache.Get(12), 1);
+  ASSERT_EQ(cache.Get(10), 0);
+  ASSERT_EQ(cache.Get(20), -1);
+}
+
+TEST_F(ParameterCacheTest, FlatLFUCheckCacheHit) {
+  cache::FlatLFUCacheAlgorithm cache;
+  ASSERT_EQ(cache.Init(3, 0, 100), kSuccess);
+  for (int i = 0; i < 3; i++) {
+    cache.Put(i, i);
+  }
+  ASSERT_EQ(cache.Get(0), 0);
+  // 1 is hit, so 2 is swapped out for 50 which is used twice, 200 is out of range.
+  std::vector<int> batch_ids = {50, 1, 200, 50};
+  std::vector<int> cache_index(batch_ids.size());
+  std::vector<int> swap_ids;
+  std::vector<int> swap_index;
+  ASSERT_EQ(cache.CheckCacheHit(batch_ids.data(), batch_ids.size(), cache_index.data(), &swap_ids, &swap_index),
+            kSuccess);
+  ASSERT_EQ(cache_index, std::vector<int>({2, 1, -1, 2}));
+  ASSERT_EQ(swap_ids, std::vector<int>({50}));
+  ASSERT_EQ(swap_index, std::vector<int>({2}));
+
+  // the batch needs more slots than the ones not hit by it.
+  batch_ids = {0, 60, 61, 62};
+  swap_ids.clear();
+  swap_index.clear();
+  ASSERT_NE(cache.CheckCacheHit(batch_ids.data(), batch_ids.size(), cache_index.data(), &swap_ids, &swap_index),
+            kSuccess);
+  ASSERT_EQ(cache.Get(60), -1);
+}
+
+TEST_F(ParameterCacheTest, ZipfianBatches) {
+  auto ids = ZipfianIds(kVocabSize, 1.05, kBatchSize * kBatchNum, 1);
+  std::map<bool, double> hit_rates;
+  for (bool flat : {false, true}) {
+    auto cache = CreateCache(flat);
+    ASSERT_NE(cache, nullptr);
+    auto hit_rate = RunBatches(cache.get(), ids);
+    ASSERT_GE(hit_rate, 0);
+    hit_rates[flat] = hit_rate;
+  }
+  // the flat one swaps out the least recently used slot of the same frequency, so the hit rate is close.
+  ASSERT_GT(hit_rates[true], hit_rates[false] - 0.05);
+}
+
+// the batches are looked up on the thread pool of the context, which gives the same cache indexes.
+TEST_F(ParameterCacheTest, FlatLFUThreadPool) {
+  lite::InnerContext ctx;
+  ctx.thread_num_ = 4;
+  ASSERT_EQ(lite::RET_OK, ctx.Init());
+  auto ids = ZipfianIds(kVocabSize, 1.05, kBatchSize * kBatchNum, 2);
+  auto serial_cache = CreateCache(true);
+  auto pool_cache = CreateCache(true);
+  ASSERT_NE(serial_cache, nullptr);
+  ASSERT_NE(pool_cache, nullptr);
+  pool_cache->set_thread_pool(ctx.thread_pool());
+  std::vector<int> serial_index(kBatchSize);
+  std::vector<int> pool_index(kBatchSize);
+  for (int batch = 0; batch < kBatchNum; batch++) {
+    const int *batch_ids = ids.data() + batch * kBatchSize;
+    std::vector<int> serial_swap_ids;
+    std::vector<int> serial_swap_index;
+    std::vector<int> pool_swap_ids;
+    std::vector<int> pool_swap_index;
+    ASSERT_EQ(serial_cache->CheckCacheHit(batch_ids, kBatchSize, serial_index.data(), &serial_swap_ids,
+                                          &serial_swap_index),
+              kSuccess);
+    ASSERT_EQ(pool_cache->CheckCacheHit(batch_ids, kBatchSize, pool_index.data(), &pool_swap_ids, &pool_swap_index),
+              kSuccess);
+    ASSERT_EQ(pool_index, serial_index);
+    ASSERT_EQ(pool_swap_ids, serial_swap_ids);
+    ASSERT_EQ(pool_swap_index, serial_swap_index);
+  }
+}
+}  // namespace mindspore
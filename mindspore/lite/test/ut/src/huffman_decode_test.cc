@@ -0,0 +1,138 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cmath>
+#include <map>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "src/huffman_decode.h"
+
+namespace mindspore {
+class TestHuffmanDecode : public mindspore::CommonTest {
+ public:
+  TestHuffmanDecode() {}
+};
+
+namespace {
+// the same format as the HuffmanEncode of the converter: "keys#codes#encoded bits".
+std::string HuffmanEncodeRef(const std::vector<int8_t> &data) {
+  std::map<int, size_t> frequency;
+  for (auto value : data) {
+    frequency[value]++;
+  }
+  frequency[lite::PSEUDO_EOF] = 1;
+  // a node is a key or the list of the keys under it.
+  using Node = std::pair<size_t, std::vector<int>>;
+  auto cmp = [](const Node &a, const Node &b) { return a.first > b.first; };
+  std::priority_queue<Node, std::vector<Node>, decltype(cmp)> queue(cmp);
+  for (const auto &item : frequency) {
+    queue.push({item.second, {item.first}});
+  }
+  std::map<int, std::string> table;
+  while (queue.size() > 1) {
+    auto first = queue.top();
+    queue.pop();
+    auto second = queue.top();
+    queue.pop();
+    for (auto key : first.second) {
+      table[key] = "0" + table[key];
+    }
+    for (auto key : second.second) {
+      table[key] = "1" + table[key];
+    }
+    first.second.insert(first.second.end(), second.second.begin(), second.second.end());
+    queue.push({first.first + second.first, first.second});
+  }
+  std::string keys;
+  std::string codes;
+  for (const auto &item : table) {
+    keys += std::to_string(item.first) + " ";
+    codes += item.second + " ";
+  }
+  std::string bits;
+  for (auto value : data) {
+    bits += table[value];
+  }
+  bits += table[lite::PSEUDO_EOF];
+  std::string encoded;
+  unsigned char out = 0;
+  for (size_t i = 0; i < bits.size(); ++i) {
+    out |= (bits[i] == '1' ? 1 : 0) << (7 - i % 8);
+    if (i % 8 == 7 || i == bits.size() - 1) {
+      encoded += static_cast<char>(out);
+      out = 0;
+    }
+  }
+  return keys + "#" + codes + "#" + encoded;
+}
+
+std::vector<int8_t> GenerateData(size_t size, double exponent, std::mt19937 *gen) {
+  std::vector<double> weights;
+  for (int i = 0; i < 256; ++i) {
+    weights.push_back(1.0 / std::pow(i + 1, exponent));
+  }
+  std::discrete_distribution<int> dist(weights.begin(), weights.end());
+  std::vector<int8_t> data(size);
+  for (auto &value : data) {
+    value = static_cast<int8_t>(dist(*gen) - 128);
+  }
+  return data;
+}
+}  // namespace
+
+TEST_F(TestHuffmanDecode, Decode) {
+  std::mt19937 gen(1);
+  // the large exponent makes the codes of the rare values longer than the lookup bits.
+  for (double exponent : {0.0, 1.0, 3.0}) {
+    for (size_t size : {1, 7, 1000, 65537}) {
+      auto data = GenerateData(size, exponent, &gen);
+      auto encoded = HuffmanEncodeRef(data);
+      std::vector<int8_t> decoded(size);
+      auto ret = lite::HuffmanDecode::DoHuffmanDecode(encoded.data(), encoded.size(), decoded.data(), decoded.size());
+      ASSERT_EQ(ret, lite::RET_OK);
+      ASSERT_EQ(decoded, data);
+    }
+  }
+}
+
+TEST_F(TestHuffmanDecode, InvalidInput) {
+  std::vector<int8_t> data = {1, 2, 3, 3, 3};
+  auto encoded = HuffmanEncodeRef(data);
+  std::vector<int8_t> decoded(data.size() - 1);
+  // the decoded data exceeds the output.
+  auto ret = lite::HuffmanDecode::DoHuffmanDecode(encoded.data(), encoded.size(), decoded.data(), decoded.size());
+  ASSERT_NE(ret, lite::RET_OK);
+  std::string no_code = "1 2 ";
+  ret = lite::HuffmanDecode::DoHuffmanDecode(no_code.data(), no_code.size(), decoded.data(), decoded.size());
+  ASSERT_NE(ret, lite::RET_OK);
+}
+
+#ifndef ENABLE_DEBUG
+// a large input, which refills the bit buffer of the decoder many times.
+TEST_F(TestHuffmanDecode, LargeData) {
+  constexpr size_t kSize = 1 << 22;
+  std::mt19937 gen(2);
+  auto data = GenerateData(kSize, 1.0, &gen);
+  auto encoded = HuffmanEncodeRef(data);
+  std::vector<int8_t> decoded(kSize);
+  auto ret = lite::HuffmanDecode::DoHuffmanDecode(encoded.data(), encoded.size(), decoded.data(), decoded.size());
+  ASSERT_EQ(ret, lite::RET_OK);
+  ASSERT_EQ(decoded, data);
+}
+#endif
+}  // namespace mindspore
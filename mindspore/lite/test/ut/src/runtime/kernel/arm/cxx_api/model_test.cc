@@ -19,6 +19,8 @@
 #include "include/api/context.h"
 #include "include/api/serialization.h"
 #include "include/api/metrics/accuracy.h"
+#include "include/train/train_session.h"
+#include "src/train/train_session.h"
 
 namespace mindspore {
 class TestCxxApiLiteModel : public mindspore::CommonTest {
@@ -251,4 +253,55 @@ TEST_F(TestCxxApiLiteModel, set_get_lr_SUCCESS) {
   ASSERT_TRUE(model.GetLearningRate() == learn_rate);
 }
 
+TEST_F(TestCxxApiLiteModel, test_recompute_SUCCESS) {
+  // the gradients with the activations recomputed are the same as the ones with all the activations kept, and the
+  // tensors are planned to take less memory.
+  std::vector<std::vector<float>> grads[2];
+  size_t tensors_sizes[2] = {0, 0};
+  for (int i = 0; i < 2; i++) {
+    Model model;
+    Graph graph;
+    auto context = std::make_shared<Context>();
+    auto cpu_context = std::make_shared<mindspore::CPUDeviceInfo>();
+    context->MutableDeviceInfo().push_back(cpu_context);
+    auto train_cfg = std::make_shared<TrainCfg>();
+    train_cfg->accumulate_gradients_ = true;
+    train_cfg->recompute_memory_budget_ = (i == 0) ? 0 : 1;
+
+    ASSERT_TRUE(Serialization::Load("./nets/conv_train_model.ms", ModelType::kMindIR, &graph) == kSuccess);
+    ASSERT_TRUE(model.Build(GraphCell(graph), context, train_cfg) == kSuccess);
+    for (auto &input : model.GetInputs()) {
+      auto data = static_cast<uint8_t *>(input.MutableData());
+      ASSERT_NE(data, nullptr);
+      for (size_t j = 0; j < input.DataSize(); j++) {
+        data[j] = static_cast<uint8_t>(j % 7);
+      }
+    }
+    ASSERT_TRUE(model.RunStep() == kSuccess);
+    tensors_sizes[i] = model.GetPlannedTensorsSize();
+    for (auto &grad : model.GetGradients()) {
+      auto data = static_cast<const float *>(grad.Data().get());
+      ASSERT_NE(data, nullptr);
+      grads[i].emplace_back(data, data + grad.ElementNum());
+    }
+  }
+  ASSERT_EQ(grads[0].size(), grads[1].size());
+  for (size_t i = 0; i < grads[0].size(); i++) {
+    ASSERT_EQ(grads[0][i], grads[1][i]);
+  }
+  ASSERT_GT(tensors_sizes[0], 0);
+  ASSERT_LT(tensors_sizes[1], tensors_sizes[0]);
+
+  // the budget of 1 byte can't be met, so the forward kernels are recomputed as long as the tensors take less memory.
+  lite::Context lite_context;
+  lite::TrainCfg lite_cfg;
+  lite_cfg.recompute_memory_budget_ = 1;
+  auto session = std::unique_ptr<session::LiteSession>(
+    session::TrainSession::CreateTrainSession("./nets/conv_train_model.ms", &lite_context, true, &lite_cfg));
+  ASSERT_NE(session, nullptr);
+  auto train_session = static_cast<lite::TrainSession *>(session.get());
+  ASSERT_GT(train_session->recompute_kernel_num(), 0);
+  ASSERT_LT(train_session->GetPlannedTensorsSize(), tensors_sizes[0]);
+}
+
 }  // namespace mindspore
@@ -0,0 +1,198 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "src/common/log_adapter.h"
+#ifdef ENABLE_AVX512
+#include "nnacl/errorcode.h"
+#include "nnacl/fp32/matmul_avx512_jit_fp32.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
+
+namespace mindspore {
+class TestMatMulAvx512JitFp32 : public mindspore::CommonTest {
+ public:
+  TestMatMulAvx512JitFp32() {}
+};
+
+#ifdef ENABLE_GEMM_AVX512_JIT
+namespace {
+constexpr int kBlock = 16;
+
+bool Avx512Supported() {
+  if (IntelX86CpuInfoInit() != NNACL_OK || !X86_Avx512_Support()) {
+    MS_LOG(INFO) << "The cpu doesn't support avx512, skip the test.";
+    return false;
+  }
+  return true;
+}
+
+void RandomFill(std::vector<float> *data, std::mt19937 *gen) {
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  for (auto &value : *data) {
+    value = dist(*gen);
+  }
+}
+
+// the same as the pre-generated kernels: weight is [depth, col_block * 16].
+void GemmTileRef(float *dst, const float *src, const float *weight, const float *bias,
+                 const GemmAvx512JitParam &param) {
+  int col = param.col_block_ * kBlock;
+  for (int i = 0; i < param.row_block_; ++i) {
+    for (int j = 0; j < col; ++j) {
+      float *out = dst + i * param.dst_stride_ + j;
+      float value = (param.inc_flag_ & 0x1) ? *out : (bias != nullptr ? bias[j] : 0.0f);
+      for (int k = 0; k < param.depth_; ++k) {
+        value += src[i * param.src_stride_ + k] * weight[k * col + j];
+      }
+      if (param.inc_flag_ & 0x2) {
+        value = (param.act_flag_ & 0x1) ? std::min(value, 6.0f) : value;
+        value = (param.act_flag_ & 0x2) ? std::max(value, 0.0f) : value;
+      }
+      *out = value;
+    }
+  }
+}
+
+// b of MatMulAvx512Fp32 is packed in blocks of 64 columns, and each block is [depth, block].
+std::vector<float> PackWeight(const std::vector<float> &b, int depth, int col) {
+  std::vector<float> packed(depth * col);
+  for (int col_index = 0; col_index < col; col_index += C64NUM) {
+    int col_block = std::min(C64NUM, col - col_index);
+    for (int k = 0; k < depth; ++k) {
+      for (int j = 0; j < col_block; ++j) {
+        packed[col_index * depth + k * col_block + j] = b[k * col + col_index + j];
+      }
+    }
+  }
+  return packed;
+}
+}  // namespace
+
+TEST_F(TestMatMulAvx512JitFp32, Kernel) {
+  if (!Avx512Supported()) {
+    return;
+  }
+  std::mt19937 gen(1);
+  for (int col_block = 1; col_block <= GEMM_AVX512_JIT_MAX_COL_BLOCK; ++col_block) {
+    for (int row_block = 1; row_block <= GemmAvx512JitMaxRow(col_block); ++row_block) {
+      for (int depth : {1, 3, 4, 9, 100}) {
+        for (int flag = 0; flag < C4NUM * C2NUM; ++flag) {
+          int src_stride = depth + row_block;
+          int dst_stride = (col_block + 1) * kBlock;
+          GemmAvx512JitParam param = {row_block, col_block, depth, src_stride, dst_stride, C3NUM, flag % C4NUM,
+                                      flag / C4NUM};
+          std::vector<float> src(row_block * src_stride);
+          std::vector<float> weight(depth * col_block * kBlock);
+          std::vector<float> bias(col_block * kBlock);
+          std::vector<float> dst(row_block * dst_stride);
+          RandomFill(&src, &gen);
+          RandomFill(&weight, &gen);
+          RandomFill(&bias, &gen);
+          RandomFill(&dst, &gen);
+          std::vector<float> expect = dst;
+          const float *bias_data = param.has_bias_ ? bias.data() : nullptr;
+          GemmTileRef(expect.data(), src.data(), weight.data(), bias_data, param);
+          auto kernel = GetGemmAvx512JitKernel(&param);
+          ASSERT_NE(kernel, nullptr);
+          kernel(dst.data(), src.data(), weight.data(), bias_data, param.act_flag_, row_block, col_block, depth,
+                 src_stride, dst_stride, param.inc_flag_);
+          ASSERT_EQ(0, CompareOutputData(dst.data(), expect.data(), static_cast<int>(dst.size()), 1e-4));
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestMatMulAvx512JitFp32, MatMul) {
+  if (!Avx512Supported()) {
+    return;
+  }
+  std::mt19937 gen(2);
+  // the depth of 1600 is split into the blocks of 1500 which accumulate to dst.
+  for (auto shape : std::vector<std::vector<int>>{{1, 100, 48}, {7, 16, 16}, {50, 1600, 80}, {100, 33, 256}}) {
+    int row = shape[0];
+    int depth = shape[1];
+    int col = shape[2];
+    std::vector<float> a(row * depth);
+    std::vector<float> b(depth * col);
+    std::vector<float> bias(col);
+    RandomFill(&a, &gen);
+    RandomFill(&b, &gen);
+    RandomFill(&bias, &gen);
+    std::vector<float> expect(row * col);
+    for (int i = 0; i < row; ++i) {
+      for (int j = 0; j < col; ++j) {
+        float value = bias[j];
+        for (int k = 0; k < depth; ++k) {
+          value += a[i * depth + k] * b[k * col + j];
+        }
+        expect[i * col + j] = std::max(value, 0.0f);
+      }
+    }
+    auto packed = PackWeight(b, depth, col);
+    std::vector<float> c(row * col);
+    if (row == 1) {
+      MatVecMulAvx512Fp32(a.data(), packed.data(), c.data(), bias.data(), ActType_Relu, depth, col, col);
+    } else {
+      MatMulAvx512Fp32(a.data(), packed.data(), c.data(), bias.data(), ActType_Relu, depth, col, col, row);
+    }
+    ASSERT_EQ(0, CompareOutputData(c.data(), expect.data(), static_cast<int>(c.size()), 1e-3));
+  }
+}
+
+// the generated kernels replace the pre-generated ones of the same tile, so they must give the same results.
+TEST_F(TestMatMulAvx512JitFp32, PreGenerated) {
+  if (!Avx512Supported()) {
+    return;
+  }
+  std::mt19937 gen(3);
+  struct Tile {
+    int row_block;
+    int col_block;
+    GemmAvx512Kernel kernel;
+  };
+  std::vector<Tile> tiles = {{1, 4, nnacl_gemm_avx512_1x64_kernel_nhwc_fp32},
+                             {6, 4, nnacl_gemm_avx512_6x64_kernel_nhwc_fp32},
+                             {8, 3, nnacl_gemm_avx512_8x48_kernel_nhwc_fp32},
+                             {12, 2, nnacl_gemm_avx512_12x32_kernel_nhwc_fp32},
+                             {12, 1, nnacl_gemm_avx512_12x16_kernel_nhwc_fp32}};
+  for (const auto &tile : tiles) {
+    for (int depth : {16, 64, 256, 1024}) {
+      GemmAvx512JitParam param = {tile.row_block, tile.col_block, depth, depth, tile.col_block * kBlock, 0, C3NUM, 1};
+      std::vector<float> src(tile.row_block * depth);
+      std::vector<float> weight(depth * tile.col_block * kBlock);
+      std::vector<float> bias(tile.col_block * kBlock);
+      RandomFill(&src, &gen);
+      RandomFill(&weight, &gen);
+      RandomFill(&bias, &gen);
+      auto jit_kernel = GetGemmAvx512JitKernel(&param);
+      ASSERT_NE(jit_kernel, nullptr);
+      std::vector<float> expect(tile.row_block * tile.col_block * kBlock);
+      std::vector<float> dst(tile.row_block * tile.col_block * kBlock);
+      tile.kernel(expect.data(), src.data(), weight.data(), bias.data(), 0, tile.row_block, tile.col_block, depth,
+                  depth, tile.col_block * kBlock, C3NUM);
+      jit_kernel(dst.data(), src.data(), weight.data(), bias.data(), 0, tile.row_block, tile.col_block, depth, depth,
+                 tile.col_block * kBlock, C3NUM);
+      ASSERT_EQ(0, CompareOutputData(dst.data(), expect.data(), static_cast<int>(dst.size()), 1e-4));
+    }
+  }
+}
+#endif
+#endif
+}  // namespace mindspore
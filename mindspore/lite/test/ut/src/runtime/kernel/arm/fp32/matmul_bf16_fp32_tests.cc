@@ -0,0 +1,125 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "mindspore/lite/src/runtime/kernel/cpu/fp32/matmul_fp32.h"
+#include "src/tensor_category.h"
+#include "src/common/log_adapter.h"
+#ifdef ENABLE_AVX512
+#include "nnacl/errorcode.h"
+#include "nnacl/fp32/matmul_avx512_bf16_fp32.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
+
+namespace mindspore {
+class TestMatMulBf16Fp32 : public mindspore::CommonTest {
+ public:
+  TestMatMulBf16Fp32() {}
+};
+
+#ifdef ENABLE_AVX512_BF16
+namespace {
+float RoundToBf16(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  bits += 0x7FFF + ((bits >> 16) & 1);
+  bits &= 0xFFFF0000;
+  memcpy(&value, &bits, sizeof(bits));
+  return value;
+}
+
+void MatmulBf16Ref(const std::vector<float> &a, const std::vector<float> &b, const std::vector<float> &bias, int row,
+                   int deep, int col, float *c) {
+  for (int r = 0; r < row; ++r) {
+    for (int n = 0; n < col; ++n) {
+      float value = bias[n];
+      for (int k = 0; k < deep; ++k) {
+        value += RoundToBf16(a[r * deep + k]) * RoundToBf16(b[k * col + n]);
+      }
+      c[r * col + n] = value > 0 ? value : 0;
+    }
+  }
+}
+
+void RunMatmulBf16(int row, int deep, int col, int thread_num) {
+  std::mt19937 gen(row * deep + col);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> a(row * deep);
+  std::vector<float> b(deep * col);
+  std::vector<float> bias(col);
+  for (auto &value : a) value = dist(gen);
+  for (auto &value : b) value = dist(gen);
+  for (auto &value : bias) value = dist(gen);
+
+  auto a_tensor = new lite::Tensor(kNumberTypeFloat32, {row, deep}, mindspore::NHWC, lite::Category::VAR);
+  auto b_tensor = new lite::Tensor(kNumberTypeFloat32, {deep, col}, mindspore::NHWC, lite::Category::CONST_TENSOR);
+  auto bias_tensor = new lite::Tensor(kNumberTypeFloat32, {col}, mindspore::NHWC, lite::Category::CONST_TENSOR);
+  auto c_tensor = new lite::Tensor(kNumberTypeFloat32, {row, col}, mindspore::NHWC, lite::Category::VAR);
+  std::vector<lite::Tensor *> inputs = {a_tensor, b_tensor, bias_tensor};
+  std::vector<lite::Tensor *> outputs = {c_tensor};
+  ASSERT_EQ(lite::RET_OK, a_tensor->MallocData());
+  ASSERT_EQ(lite::RET_OK, b_tensor->MallocData());
+  ASSERT_EQ(lite::RET_OK, bias_tensor->MallocData());
+  ASSERT_EQ(lite::RET_OK, c_tensor->MallocData());
+  memcpy(a_tensor->data(), a.data(), a.size() * sizeof(float));
+  memcpy(b_tensor->data(), b.data(), b.size() * sizeof(float));
+  memcpy(bias_tensor->data(), bias.data(), bias.size() * sizeof(float));
+
+  auto param = reinterpret_cast<MatMulParameter *>(malloc(sizeof(MatMulParameter)));
+  ASSERT_NE(param, nullptr);
+  memset(param, 0, sizeof(MatMulParameter));
+  param->op_parameter_.thread_num_ = thread_num;
+  param->act_type_ = ActType_Relu;
+  param->has_bias_ = true;
+  auto ctx = new lite::InnerContext;
+  ctx->thread_num_ = thread_num;
+  ctx->device_list_[0].device_info_.cpu_device_info_.enable_float16_ = true;
+  ASSERT_EQ(lite::RET_OK, ctx->Init());
+  // enabling float16 doesn't change the precision of the fp32 matmul on x86.
+  ASSERT_FALSE(ctx->IsCpuBFloat16Enabled());
+  ctx->enable_cpu_bf16_ = true;
+  ASSERT_TRUE(ctx->IsCpuBFloat16Enabled());
+  auto kernel = new kernel::MatmulCPUKernel(reinterpret_cast<OpParameter *>(param), inputs, outputs, ctx);
+  ASSERT_EQ(lite::RET_OK, kernel->Prepare());
+  ASSERT_EQ(lite::RET_OK, kernel->Run());
+
+  std::vector<float> expect(row * col);
+  MatmulBf16Ref(a, b, bias, row, deep, col, expect.data());
+  // the products of bf16 are exact, only the order of accumulation differs from the reference.
+  ASSERT_EQ(0, CompareOutputData(reinterpret_cast<float *>(c_tensor->data()), expect.data(), row * col, 1e-3));
+
+  delete kernel;
+  delete ctx;
+  for (auto tensor : inputs) delete tensor;
+  for (auto tensor : outputs) delete tensor;
+}
+}  // namespace
+
+TEST_F(TestMatMulBf16Fp32, RandomShape) {
+  if (IntelX86CpuInfoInit() != NNACL_OK || !X86_Avx512_Bf16_Support()) {
+    MS_LOG(INFO) << "The cpu doesn't support avx512-bf16, skip the test.";
+    return;
+  }
+  // cover the amx tiles, the remaining rows and the narrow column blocks.
+  RunMatmulBf16(2, 7, 5, 1);
+  RunMatmulBf16(37, 100, 70, 1);
+  RunMatmulBf16(64, 256, 128, 2);
+  RunMatmulBf16(50, 33, 200, 4);
+}
+#endif
+}  // namespace mindspore
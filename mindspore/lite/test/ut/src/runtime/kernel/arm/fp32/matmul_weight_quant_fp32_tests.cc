@@ -0,0 +1,189 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/fp32/matmul_weight_quant_fp32.h"
+#include "schema/ops_generated.h"
+#include "src/tensor_category.h"
+#include "src/weight_decoder.h"
+#include "mindspore/lite/src/runtime/kernel/cpu/fp32/matmul_weight_quant_fp32.h"
+
+namespace mindspore {
+class TestMatmulWeightQuantFp32 : public mindspore::CommonTest {
+ public:
+  TestMatmulWeightQuantFp32() {}
+};
+
+#ifdef ENABLE_AVX
+namespace {
+struct WeightQuantCase {
+  int row;
+  int deep;
+  int col;
+  int bit_num;
+  bool per_channel;
+  bool b_transpose;
+  schema::PrimitiveType op_type;
+};
+
+MatMulParameter *CreateMatMulParameter(const WeightQuantCase &test_case, int thread_num) {
+  auto param = reinterpret_cast<MatMulParameter *>(malloc(sizeof(MatMulParameter)));
+  if (param == nullptr) {
+    return nullptr;
+  }
+  memset(param, 0, sizeof(MatMulParameter));
+  param->op_parameter_.type_ = test_case.op_type;
+  param->op_parameter_.quant_type_ = schema::QuantType_QUANT_WEIGHT;
+  param->op_parameter_.thread_num_ = thread_num;
+  param->b_transpose_ = test_case.b_transpose;
+  param->act_type_ = ActType_Relu6;
+  param->has_bias_ = true;
+  return param;
+}
+
+// runs the kernel with the quantized weight and compares it with the dequantized weight.
+void RunMatmulWeightQuant(const WeightQuantCase &test_case, int thread_num) {
+  int row = test_case.row, deep = test_case.deep, col = test_case.col;
+  bool b_transpose = test_case.op_type == schema::PrimitiveType_FullConnection || test_case.b_transpose;
+  std::mt19937 gen(row * deep + col);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  int quant_max = (1 << (test_case.bit_num - 1)) - 1;
+  std::uniform_int_distribution<int> quant_dist(-quant_max - 1, quant_max);
+  std::uniform_int_distribution<int> zp_dist(-2, 2);
+  std::vector<float> a(row * deep);
+  std::vector<int8_t> b(deep * col);
+  std::vector<float> bias(col);
+  for (auto &value : a) value = dist(gen);
+  for (auto &value : b) value = static_cast<int8_t>(quant_dist(gen));
+  for (auto &value : bias) value = dist(gen);
+  std::vector<lite::LiteQuantParam> quant_params(test_case.per_channel ? col : 1);
+  for (auto &quant_param : quant_params) {
+    quant_param.scale = 0.01 + 0.01 * (dist(gen) + 1.0f);
+    quant_param.zeroPoint = zp_dist(gen);
+    quant_param.bitNum = test_case.bit_num;
+    quant_param.inited = true;
+  }
+
+  std::vector<int> b_shape = b_transpose ? std::vector<int>{col, deep} : std::vector<int>{deep, col};
+  auto a_tensor = new lite::Tensor(kNumberTypeFloat32, {row, deep}, mindspore::NHWC, lite::Category::VAR);
+  auto b_tensor = new lite::Tensor(kNumberTypeInt8, b_shape, mindspore::NHWC, lite::Category::CONST_TENSOR);
+  auto bias_tensor = new lite::Tensor(kNumberTypeFloat32, {col}, mindspore::NHWC, lite::Category::CONST_TENSOR);
+  auto c_tensor = new lite::Tensor(kNumberTypeFloat32, {row, col}, mindspore::NHWC, lite::Category::VAR);
+  std::vector<lite::Tensor *> inputs = {a_tensor, b_tensor, bias_tensor};
+  std::vector<lite::Tensor *> outputs = {c_tensor};
+  ASSERT_EQ(lite::RET_OK, a_tensor->MallocData());
+  ASSERT_EQ(lite::RET_OK, b_tensor->MallocData());
+  ASSERT_EQ(lite::RET_OK, bias_tensor->MallocData());
+  ASSERT_EQ(lite::RET_OK, c_tensor->MallocData());
+  memcpy(a_tensor->data(), a.data(), a.size() * sizeof(float));
+  memcpy(b_tensor->data(), b.data(), b.size());
+  memcpy(bias_tensor->data(), bias.data(), bias.size() * sizeof(float));
+  b_tensor->set_quant_params(quant_params);
+
+  auto param = CreateMatMulParameter(test_case, thread_num);
+  ASSERT_NE(param, nullptr);
+  ASSERT_TRUE(lite::WeightDecoder::IsQuantWeightComputable(&param->op_parameter_, inputs, kWeightIndex));
+  auto ctx = new lite::InnerContext;
+  ctx->thread_num_ = thread_num;
+  ASSERT_EQ(lite::RET_OK, ctx->Init());
+  auto kernel =
+    new kernel::MatmulWeightQuantCPUKernel(reinterpret_cast<OpParameter *>(param), inputs, outputs, ctx);
+  ASSERT_EQ(lite::RET_OK, kernel->Prepare());
+  ASSERT_EQ(lite::RET_OK, kernel->Run());
+
+  std::vector<float> expect(row * col);
+  for (int r = 0; r < row; ++r) {
+    for (int n = 0; n < col; ++n) {
+      const auto &quant_param = quant_params[test_case.per_channel ? n : 0];
+      float value = bias[n];
+      for (int k = 0; k < deep; ++k) {
+        int q = b_transpose ? b[n * deep + k] : b[k * col + n];
+        value += a[r * deep + k] * static_cast<float>((q - quant_param.zeroPoint) * quant_param.scale);
+      }
+      expect[r * col + n] = std::min(std::max(value, 0.0f), 6.0f);
+    }
+  }
+  ASSERT_EQ(0, CompareOutputData(reinterpret_cast<float *>(c_tensor->data()), expect.data(), row * col, 1e-4));
+
+  delete kernel;
+  delete ctx;
+  for (auto tensor : inputs) delete tensor;
+  for (auto tensor : outputs) delete tensor;
+}
+}  // namespace
+
+TEST_F(TestMatmulWeightQuantFp32, RandomShape) {
+  // cover the decoding of one row, the remaining rows and the narrow column tiles.
+  RunMatmulWeightQuant({1, 64, 100, 8, true, false, schema::PrimitiveType_MatMulFusion}, 1);
+  RunMatmulWeightQuant({1, 33, 70, 4, true, true, schema::PrimitiveType_MatMulFusion}, 2);
+  RunMatmulWeightQuant({7, 100, 37, 8, false, true, schema::PrimitiveType_MatMulFusion}, 2);
+  RunMatmulWeightQuant({13, 45, 200, 4, false, false, schema::PrimitiveType_MatMulFusion}, 4);
+  RunMatmulWeightQuant({5, 128, 64, 8, true, true, schema::PrimitiveType_FullConnection}, 3);
+  RunMatmulWeightQuant({2, 17, 9, 4, true, true, schema::PrimitiveType_FullConnection}, 1);
+}
+
+TEST_F(TestMatmulWeightQuantFp32, Unsupported) {
+  auto param = CreateMatMulParameter({1, 16, 16, 8, true, false, schema::PrimitiveType_MatMulFusion}, 1);
+  ASSERT_NE(param, nullptr);
+  lite::Tensor a_tensor(kNumberTypeFloat32, {1, 16}, mindspore::NHWC, lite::Category::VAR);
+  lite::Tensor b_tensor(kNumberTypeInt8, {16, 16}, mindspore::NHWC, lite::Category::CONST_TENSOR);
+  ASSERT_EQ(lite::RET_OK, b_tensor.MallocData());
+  lite::LiteQuantParam quant_param;
+  quant_param.scale = 0.1;
+  quant_param.zeroPoint = 0;
+  quant_param.inited = true;
+  b_tensor.AddQuantParam(quant_param);
+  std::vector<lite::Tensor *> inputs = {&a_tensor, &b_tensor};
+  ASSERT_TRUE(lite::WeightDecoder::IsQuantWeightComputable(&param->op_parameter_, inputs, kWeightIndex));
+  // the kmeans clusters and the transposed input are left to the dequantization.
+  param->a_transpose_ = true;
+  ASSERT_FALSE(lite::WeightDecoder::IsQuantWeightComputable(&param->op_parameter_, inputs, kWeightIndex));
+  param->a_transpose_ = false;
+  quant_param.clusters = {0.1f, 0.2f};
+  b_tensor.set_quant_params({quant_param});
+  ASSERT_FALSE(lite::WeightDecoder::IsQuantWeightComputable(&param->op_parameter_, inputs, kWeightIndex));
+  free(param);
+}
+
+// the decoding step of a language model is a matmul of one row with a deep weight, the sums must not overflow.
+TEST_F(TestMatmulWeightQuantFp32, DeepWeight) {
+  constexpr int kDeep = 4096;
+  constexpr int kCol = 256;
+  constexpr float kScale = 0.01f;
+  std::vector<int8_t> b(kDeep * kCol, 1);
+  std::vector<uint8_t> packed_b(kDeep * kCol);
+  std::vector<float> a(C4NUM * C4NUM * kDeep, 0.5f);
+  std::vector<float> scales(kCol, kScale);
+  std::vector<float> expect(C4NUM * C4NUM * kCol, 0.5f * kScale * kDeep);
+  for (int row : {1, C4NUM * C4NUM}) {
+    for (int bit_num : {C4NUM, C8NUM}) {
+      if (bit_num == C4NUM) {
+        PackWeightQuantInt4(b.data(), packed_b.data(), kDeep, kCol, false);
+      } else {
+        PackWeightQuantInt8(b.data(), reinterpret_cast<int8_t *>(packed_b.data()), kDeep, kCol, false);
+      }
+      std::vector<float> c(row * kCol, 0.0f);
+      MatmulWeightQuantFp32(a.data(), packed_b.data(), c.data(), nullptr, scales.data(), nullptr, nullptr, ActType_No,
+                            row, kDeep, kCol, 0, kCol / WEIGHT_QUANT_COL_TILE, bit_num);
+      ASSERT_EQ(0, CompareOutputData(c.data(), expect.data(), row * kCol, 1e-3));
+    }
+  }
+}
+#endif
+}  // namespace mindspore
@@ -0,0 +1,159 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "schema/ops_generated.h"
+#include "src/tensor_category.h"
+#include "mindspore/lite/src/runtime/kernel/cpu/fp32/scaled_dot_product_attention_fp32.h"
+
+namespace mindspore {
+class TestScaledDotProductAttentionFp32 : public mindspore::CommonTest {
+ public:
+  TestScaledDotProductAttentionFp32() {}
+};
+
+namespace {
+struct AttentionCase {
+  int batch;
+  int head;
+  int q_seq;
+  int kv_seq;
+  int head_size;
+  bool is_causal;
+  // the mask is [batch, 1, q_seq, kv_seq] if it's used.
+  bool with_mask;
+};
+
+// softmax(q * k^T / sqrt(head_size) + mask) * v, the logits of one query are calculated at a time.
+void NaiveAttention(const AttentionCase &test_case, const std::vector<float> &q, const std::vector<float> &k,
+                    const std::vector<float> &v, const std::vector<float> &mask, std::vector<float> *out,
+                    std::vector<float> *lse) {
+  int q_seq = test_case.q_seq, kv_seq = test_case.kv_seq, head_size = test_case.head_size;
+  float scale = 1.0f / std::sqrt(static_cast<float>(head_size));
+  std::vector<float> logits(kv_seq);
+  for (int b = 0; b < test_case.batch * test_case.head; ++b) {
+    for (int i = 0; i < q_seq; ++i) {
+      int kv_end = test_case.is_causal ? kv_seq - q_seq + i + 1 : kv_seq;
+      float max = -INFINITY;
+      for (int j = 0; j < kv_end; ++j) {
+        float logit = 0.0f;
+        for (int d = 0; d < head_size; ++d) {
+          logit += q[(b * q_seq + i) * head_size + d] * k[(b * kv_seq + j) * head_size + d];
+        }
+        logits[j] = logit * scale + (test_case.with_mask ? mask[((b / test_case.head) * q_seq + i) * kv_seq + j] : 0);
+        max = std::max(max, logits[j]);
+      }
+      float sum = 0.0f;
+      for (int j = 0; j < kv_end; ++j) {
+        logits[j] = std::exp(logits[j] - max);
+        sum += logits[j];
+      }
+      for (int d = 0; d < head_size; ++d) {
+        float value = 0.0f;
+        for (int j = 0; j < kv_end; ++j) {
+          value += logits[j] * v[(b * kv_seq + j) * head_size + d];
+        }
+        (*out)[(b * q_seq + i) * head_size + d] = value / sum;
+      }
+      (*lse)[b * q_seq + i] = max + std::log(sum);
+    }
+  }
+}
+
+void RunAttention(const AttentionCase &test_case, int thread_num) {
+  int batch = test_case.batch, head = test_case.head, head_size = test_case.head_size;
+  std::vector<int> q_shape = {batch, head, test_case.q_seq, head_size};
+  std::vector<int> kv_shape = {batch, head, test_case.kv_seq, head_size};
+  std::vector<int> mask_shape = {batch, 1, test_case.q_seq, test_case.kv_seq};
+  std::mt19937 gen(test_case.q_seq * test_case.kv_seq + head_size);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> q(batch * head * test_case.q_seq * head_size);
+  std::vector<float> k(batch * head * test_case.kv_seq * head_size);
+  std::vector<float> v(k.size());
+  std::vector<float> mask(batch * test_case.q_seq * test_case.kv_seq);
+  for (auto &value : q) value = dist(gen);
+  for (auto &value : k) value = dist(gen);
+  for (auto &value : v) value = dist(gen);
+  for (auto &value : mask) value = dist(gen) > 0.8f ? -10000.0f : dist(gen);
+
+  std::vector<lite::Tensor *> inputs = {
+    new lite::Tensor(kNumberTypeFloat32, q_shape, mindspore::NHWC, lite::Category::VAR),
+    new lite::Tensor(kNumberTypeFloat32, kv_shape, mindspore::NHWC, lite::Category::VAR),
+    new lite::Tensor(kNumberTypeFloat32, kv_shape, mindspore::NHWC, lite::Category::VAR)};
+  std::vector<const std::vector<float> *> input_data = {&q, &k, &v};
+  if (test_case.with_mask) {
+    inputs.push_back(new lite::Tensor(kNumberTypeFloat32, mask_shape, mindspore::NHWC, lite::Category::VAR));
+    input_data.push_back(&mask);
+  }
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    ASSERT_EQ(lite::RET_OK, inputs[i]->MallocData());
+    memcpy(inputs[i]->data(), input_data[i]->data(), input_data[i]->size() * sizeof(float));
+  }
+  std::vector<lite::Tensor *> outputs = {
+    new lite::Tensor(kNumberTypeFloat32, q_shape, mindspore::NHWC, lite::Category::VAR),
+    new lite::Tensor(kNumberTypeFloat32, {batch, head, test_case.q_seq}, mindspore::NHWC, lite::Category::VAR)};
+  for (auto tensor : outputs) {
+    ASSERT_EQ(lite::RET_OK, tensor->MallocData());
+  }
+
+  auto param = reinterpret_cast<ScaledDotProductAttentionParameter *>(
+    malloc(sizeof(ScaledDotProductAttentionParameter)));
+  ASSERT_NE(param, nullptr);
+  memset(param, 0, sizeof(ScaledDotProductAttentionParameter));
+  param->op_parameter_.type_ = schema::PrimitiveType_ScaledDotProductAttention;
+  param->op_parameter_.thread_num_ = thread_num;
+  param->is_causal_ = test_case.is_causal;
+  auto ctx = new lite::InnerContext;
+  ctx->thread_num_ = thread_num;
+  ASSERT_EQ(lite::RET_OK, ctx->Init());
+  auto kernel = new kernel::ScaledDotProductAttentionCPUKernel(reinterpret_cast<OpParameter *>(param), inputs,
+                                                                outputs, ctx);
+  ASSERT_EQ(lite::RET_OK, kernel->Prepare());
+  ASSERT_EQ(lite::RET_OK, kernel->Run());
+
+  std::vector<float> expect_out(q.size());
+  std::vector<float> expect_lse(batch * head * test_case.q_seq);
+  NaiveAttention(test_case, q, k, v, mask, &expect_out, &expect_lse);
+  ASSERT_EQ(0, CompareOutputData(reinterpret_cast<float *>(outputs[0]->data()), expect_out.data(), expect_out.size(),
+                                 1e-4));
+  ASSERT_EQ(0, CompareOutputData(reinterpret_cast<float *>(outputs[1]->data()), expect_lse.data(), expect_lse.size(),
+                                 1e-4));
+
+  delete kernel;
+  delete ctx;
+  for (auto tensor : inputs) delete tensor;
+  for (auto tensor : outputs) delete tensor;
+}
+}  // namespace
+
+TEST_F(TestScaledDotProductAttentionFp32, Prefill) {
+  RunAttention({1, 2, 7, 7, 16, false, false}, 1);
+  RunAttention({2, 3, 33, 33, 64, true, false}, 2);
+  RunAttention({2, 4, 100, 100, 40, false, true}, 4);
+  RunAttention({1, 1, 130, 130, 17, true, true}, 3);
+}
+
+// the new queries attend to the past keys/values of kv-cache and themselves.
+TEST_F(TestScaledDotProductAttentionFp32, KVCache) {
+  RunAttention({1, 8, 1, 200, 64, true, false}, 4);
+  RunAttention({2, 4, 1, 65, 32, false, true}, 3);
+  RunAttention({1, 2, 5, 129, 24, true, true}, 2);
+}
+}  // namespace mindspore
@@ -0,0 +1,177 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "schema/inner/model_generated.h"
+#include "include/version.h"
+#include "src/common/common.h"
+#include "src/lite_session.h"
+#include "src/runtime/resize_plan_cache.h"
+
+namespace mindspore {
+namespace {
+constexpr int kChannel = 4;
+const std::vector<float> kBias = {-1.0f, 0.5f, -2.0f, 3.0f};
+
+std::unique_ptr<schema::TensorT> CreateTensor(const std::vector<int> &dims, const std::vector<float> &data = {}) {
+  auto tensor = std::make_unique<schema::TensorT>();
+  tensor->nodeType = data.empty() ? lite::NodeType_Parameter : lite::NodeType_ValueNode;
+  tensor->format = schema::Format_NHWC;
+  tensor->dataType = TypeId::kNumberTypeFloat32;
+  tensor->dims = dims;
+  tensor->offset = -1;
+  if (!data.empty()) {
+    tensor->data.resize(data.size() * sizeof(float));
+    memcpy(tensor->data.data(), data.data(), tensor->data.size());
+  }
+  return tensor;
+}
+
+// x[N, 4] -> Add(bias[4]) -> Relu -> y[N, 4]
+lite::Model *CreateAddReluModel() {
+  auto meta_graph = std::make_shared<schema::MetaGraphT>();
+  meta_graph->name = "graph";
+  meta_graph->version = lite::Version();
+
+  auto add = std::make_unique<schema::CNodeT>();
+  add->inputIndex = {0, 1};
+  add->outputIndex = {2};
+  add->primitive = std::make_unique<schema::PrimitiveT>();
+  add->primitive->value.type = schema::PrimitiveType_AddFusion;
+  add->primitive->value.value = new schema::AddFusionT;
+  add->name = "add";
+
+  auto relu = std::make_unique<schema::CNodeT>();
+  relu->inputIndex = {2};
+  relu->outputIndex = {3};
+  relu->primitive = std::make_unique<schema::PrimitiveT>();
+  relu->primitive->value.type = schema::PrimitiveType_Activation;
+  auto relu_primitive = new schema::ActivationT;
+  relu_primitive->activation_type = schema::ActivationType_RELU;
+  relu->primitive->value.value = relu_primitive;
+  relu->name = "relu";
+
+  meta_graph->nodes.emplace_back(std::move(add));
+  meta_graph->nodes.emplace_back(std::move(relu));
+  meta_graph->allTensors.emplace_back(CreateTensor({1, kChannel}));
+  meta_graph->allTensors.emplace_back(CreateTensor({kChannel}, kBias));
+  meta_graph->allTensors.emplace_back(CreateTensor({1, kChannel}));
+  meta_graph->allTensors.emplace_back(CreateTensor({1, kChannel}));
+  meta_graph->inputIndex = {0};
+  meta_graph->outputIndex = {3};
+
+  flatbuffers::FlatBufferBuilder builder(1024);
+  auto offset = schema::MetaGraph::Pack(builder, meta_graph.get());
+  builder.Finish(offset);
+  schema::FinishMetaGraphBuffer(builder, offset);
+  return lite::Model::Import(reinterpret_cast<char *>(builder.GetBufferPointer()), builder.GetSize());
+}
+}  // namespace
+
+class ResizePlanCacheTest : public mindspore::CommonTest {
+ public:
+  ResizePlanCacheTest() = default;
+
+  // resize the session to batch rows, run it and check the output against relu(x + bias).
+  void ResizeAndRun(lite::LiteSession *session, int batch) {
+    auto inputs = session->GetInputs();
+    ASSERT_EQ(inputs.size(), 1);
+    ASSERT_EQ(session->Resize(inputs, {{batch, kChannel}}), lite::RET_OK);
+    auto input = inputs.front();
+    ASSERT_EQ(input->ElementsNum(), batch * kChannel);
+    auto input_data = reinterpret_cast<float *>(input->MutableData());
+    ASSERT_NE(input_data, nullptr);
+    for (int i = 0; i < batch * kChannel; ++i) {
+      input_data[i] = static_cast<float>(i % 7) - 3.0f;
+    }
+    ASSERT_EQ(session->RunGraph(), lite::RET_OK);
+    auto outputs = session->GetOutputs();
+    ASSERT_EQ(outputs.size(), 1);
+    auto output = outputs.begin()->second;
+    ASSERT_EQ(output->shape(), std::vector<int>({batch, kChannel}));
+    auto output_data = reinterpret_cast<float *>(output->MutableData());
+    ASSERT_NE(output_data, nullptr);
+    for (int i = 0; i < batch * kChannel; ++i) {
+      auto expect = std::max(static_cast<float>(i % 7) - 3.0f + kBias[i % kChannel], 0.0f);
+      ASSERT_FLOAT_EQ(output_data[i], expect);
+    }
+  }
+};
+
+TEST_F(ResizePlanCacheTest, LeastRecentlyUsedEvicted) {
+  lite::ResizePlanCache cache(2);
+  auto plan_a = std::make_shared<lite::ResizePlan>();
+  auto plan_b = std::make_shared<lite::ResizePlan>();
+  auto plan_c = std::make_shared<lite::ResizePlan>();
+  cache.Insert({{1, 32}}, plan_a);
+  cache.Insert({{1, 64}}, plan_b);
+  ASSERT_EQ(cache.Find({{1, 32}}), plan_a);
+  // {1, 64} is the least recently used one.
+  cache.Insert({{1, 128}}, plan_c);
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_EQ(cache.Find({{1, 64}}), nullptr);
+  ASSERT_EQ(cache.Find({{1, 32}}), plan_a);
+  ASSERT_EQ(cache.Find({{1, 128}}), plan_c);
+  cache.Clear();
+  ASSERT_EQ(cache.Find({{1, 32}}), nullptr);
+}
+
+TEST_F(ResizePlanCacheTest, SessionResizeBackToCachedShape) {
+  auto model = CreateAddReluModel();
+  ASSERT_NE(model, nullptr);
+  auto context = new lite::InnerContext();
+  ASSERT_EQ(context->Init(), lite::RET_OK);
+  auto session = std::make_unique<lite::LiteSession>();
+  ASSERT_EQ(session->Init(context), lite::RET_OK);
+  std::map<std::string, std::map<std::string, std::string>> config_info = {
+    {lite::kResizePlanCache, {{lite::kResizePlanCacheSize, "2"}}}};
+  session->SetConfigInfo(&config_info);
+  ASSERT_EQ(session->CompileGraph(model), lite::RET_OK);
+  auto cache = session->resize_plan_cache();
+  ASSERT_NE(cache, nullptr);
+  auto arena = session->runtime_arena();
+  ASSERT_NE(arena, nullptr);
+
+  ResizeAndRun(session.get(), 2);
+  ASSERT_EQ(cache->size(), 1);
+  ASSERT_EQ(cache->hits(), 0);
+  ResizeAndRun(session.get(), 5);
+  ASSERT_EQ(cache->size(), 2);
+  ASSERT_EQ(cache->hits(), 0);
+  // the plans share one memory block, which is as large as the largest plan needs.
+  auto arena_size = arena->size();
+  ASSERT_GE(arena_size, 5 * kChannel * sizeof(float));
+  // back to the first shape, the plan recorded by the first resize is applied.
+  ResizeAndRun(session.get(), 2);
+  ASSERT_EQ(cache->size(), 2);
+  ASSERT_EQ(cache->hits(), 1);
+  ASSERT_EQ(arena->size(), arena_size);
+  ResizeAndRun(session.get(), 5);
+  ASSERT_EQ(cache->hits(), 2);
+  ASSERT_EQ(arena->size(), arena_size);
+  // the relu keeps its resize state in the plan, so it isn't resized again on a cache hit.
+  auto plan = cache->Find({{2, kChannel}});
+  ASSERT_NE(plan, nullptr);
+  ASSERT_FALSE(plan->kernel_states.empty());
+  session.reset();
+  delete model;
+}
+}  // namespace mindspore
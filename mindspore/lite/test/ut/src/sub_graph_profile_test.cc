@@ -0,0 +1,89 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+#include "common/common_test.h"
+#include "include/errorcode.h"
+#include "src/sub_graph_profile.h"
+
+namespace mindspore {
+class SubGraphProfileTest : public mindspore::CommonTest {
+ public:
+  SubGraphProfileTest() {}
+};
+
+TEST_F(SubGraphProfileTest, ListScheduleBranches) {
+  // the longest branches are placed first, so the groups end with the loads of 10 and 9.
+  std::vector<size_t> costs = {2, 7, 3, 5, 2};
+  auto groups = lite::ListScheduleBranches(costs, 2);
+  ASSERT_EQ(groups.size(), costs.size());
+  std::vector<size_t> loads(2, 0);
+  for (size_t i = 0; i < costs.size(); i++) {
+    ASSERT_LT(groups[i], loads.size());
+    loads[groups[i]] += costs[i];
+  }
+  ASSERT_EQ(std::max(loads[0], loads[1]), 10u);
+  ASSERT_EQ(std::min(loads[0], loads[1]), 9u);
+  ASSERT_NE(groups[1], groups[3]);
+}
+
+TEST_F(SubGraphProfileTest, AllocateGroupThreads) {
+  ASSERT_EQ(lite::AllocateGroupThreads({300, 100}, 8), std::vector<size_t>({6, 2}));
+  ASSERT_EQ(lite::AllocateGroupThreads({100, 100}, 5), std::vector<size_t>({3, 2}));
+  ASSERT_EQ(lite::AllocateGroupThreads({1000, 1}, 4), std::vector<size_t>({3, 1}));
+  ASSERT_EQ(lite::AllocateGroupThreads({0, 0}, 4), std::vector<size_t>({2, 2}));
+  ASSERT_EQ(lite::AllocateGroupThreads({10, 20}, 1), std::vector<size_t>({1, 1}));
+}
+
+TEST_F(SubGraphProfileTest, CollectAndLoad) {
+  const std::string file_path = "./sub_graph_profile_test.profile";
+  (void)std::remove(file_path.c_str());
+  lite::SubGraphProfile collect_profile(file_path);
+  ASSERT_NE(collect_profile.Load(), lite::RET_OK);
+  auto before = collect_profile.WrapBefore(nullptr);
+  auto after = collect_profile.WrapAfter(nullptr);
+  CallBackParam conv_param = {"conv 1", "Conv2DFusion"};
+  CallBackParam add_param = {"add", "AddFusion"};
+  for (int i = 0; i < lite::kProfileWarmUpRuns + lite::kProfileRuns; i++) {
+    ASSERT_TRUE(collect_profile.IsCollecting());
+    for (const auto &param : {conv_param, add_param}) {
+      ASSERT_TRUE(before({}, {}, param));
+      ASSERT_TRUE(after({}, {}, param));
+    }
+    ASSERT_EQ(collect_profile.EndRun(), lite::RET_OK);
+  }
+  ASSERT_FALSE(collect_profile.IsCollecting());
+
+  lite::SubGraphProfile load_profile(file_path);
+  ASSERT_EQ(load_profile.Load(), lite::RET_OK);
+  ASSERT_TRUE(load_profile.loaded());
+  ASSERT_FALSE(load_profile.IsCollecting());
+  ASSERT_GE(load_profile.GetLatency("conv 1"), 0);
+  ASSERT_GE(load_profile.GetLatency("add"), 0);
+  ASSERT_LT(load_profile.GetLatency("mul"), 0);
+
+  std::ofstream invalid_file(file_path, std::ios::out | std::ios::trunc);
+  invalid_file << "abc conv 1" << std::endl;
+  invalid_file.close();
+  lite::SubGraphProfile invalid_profile(file_path);
+  ASSERT_NE(invalid_profile.Load(), lite::RET_OK);
+  ASSERT_FALSE(invalid_profile.loaded());
+  (void)std::remove(file_path.c_str());
+}
+}  // namespace mindspore
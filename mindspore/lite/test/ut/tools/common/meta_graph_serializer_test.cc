@@ -0,0 +1,100 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#include "schema/inner/model_generated.h"
+#include "tools/common/meta_graph_serializer.h"
+
+namespace mindspore::lite {
+namespace {
+constexpr size_t kWeightNum = 2;
+// more than the overhead of all the weights in the packed model.
+constexpr size_t kOverheadBound = 129;
+}  // namespace
+
+class MetaGraphSerializerTest : public mindspore::CommonTest {
+ public:
+  MetaGraphSerializerTest() = default;
+
+  // x -> MatMul(w0) -> Add(w1) -> y, the weights are 1000 and 333 bytes.
+  void SetUp() override {
+    graph_ = std::make_unique<schema::MetaGraphT>();
+    graph_->name = "graph";
+    std::vector<size_t> weight_sizes = {1000, 333};
+    for (size_t i = 0; i < kWeightNum; ++i) {
+      auto weight = std::make_unique<schema::TensorT>();
+      weight->nodeType = NodeType_ValueNode;
+      weight->dataType = kNumberTypeUInt8;
+      weight->dims = {static_cast<int32_t>(weight_sizes[i])};
+      weight->data.resize(weight_sizes[i]);
+      for (size_t j = 0; j < weight_sizes[i]; ++j) {
+        weight->data[j] = static_cast<uint8_t>(j * (i + 1));
+      }
+      graph_->allTensors.emplace_back(std::move(weight));
+    }
+    for (size_t i = 0; i < 3; ++i) {
+      auto tensor = std::make_unique<schema::TensorT>();
+      tensor->nodeType = NodeType_CNode;
+      tensor->dataType = kNumberTypeFloat32;
+      tensor->dims = {1, 16};
+      graph_->allTensors.emplace_back(std::move(tensor));
+    }
+    auto matmul = std::make_unique<schema::CNodeT>();
+    matmul->name = "matmul";
+    matmul->inputIndex = {2, 0};
+    matmul->outputIndex = {3};
+    graph_->nodes.emplace_back(std::move(matmul));
+    auto add = std::make_unique<schema::CNodeT>();
+    add->name = "add";
+    add->inputIndex = {3, 1};
+    add->outputIndex = {4};
+    graph_->nodes.emplace_back(std::move(add));
+    graph_->inputIndex = {2};
+    graph_->outputIndex = {4};
+    weights_ = {graph_->allTensors[0]->data, graph_->allTensors[1]->data};
+  }
+
+  size_t PackedSize() {
+    flatbuffers::FlatBufferBuilder builder(1024);
+    auto offset = schema::MetaGraph::Pack(builder, graph_.get());
+    builder.Finish(offset);
+    schema::FinishMetaGraphBuffer(builder, offset);
+    return builder.GetSize();
+  }
+
+  std::unique_ptr<schema::MetaGraphT> graph_;
+  std::vector<std::vector<uint8_t>> weights_;
+};
+
+// the model is saved with its weights exactly when the packed model is smaller than the limit, around the limit as
+// well as far from it.
+TEST_F(MetaGraphSerializerTest, ModelSizeLimitBoundary) {
+  auto size = PackedSize();
+  ASSERT_GT(size, kOverheadBound);
+  ASSERT_FALSE(MetaGraphSerializer::IsModelSizeUnderLimit(graph_.get(), size - kOverheadBound));
+  ASSERT_FALSE(MetaGraphSerializer::IsModelSizeUnderLimit(graph_.get(), size));
+  ASSERT_TRUE(MetaGraphSerializer::IsModelSizeUnderLimit(graph_.get(), size + 1));
+  ASSERT_TRUE(MetaGraphSerializer::IsModelSizeUnderLimit(graph_.get(), size + kOverheadBound));
+  // the weights are swapped back after the structure is measured.
+  for (size_t i = 0; i < kWeightNum; ++i) {
+    ASSERT_EQ(graph_->allTensors[i]->data, weights_[i]);
+  }
+  ASSERT_TRUE(graph_->allTensors[kWeightNum]->data.empty());
+  ASSERT_EQ(PackedSize(), size);
+}
+}  // namespace mindspore::lite
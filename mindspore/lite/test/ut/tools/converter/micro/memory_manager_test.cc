@@ -0,0 +1,93 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include "common/common_test.h"
+#include "tools/converter/micro/coder/allocator/memory_manager.h"
+#include "tools/converter/micro/coder/opcoders/op_coder.h"
+
+namespace mindspore::lite::micro {
+namespace {
+// an op which only carries its tensors, the memory manager never codes it.
+class FakeCoder : public OperatorCoder {
+ public:
+  FakeCoder(const std::vector<Tensor *> &in_tensors, const std::vector<Tensor *> &out_tensors, size_t node_index)
+      : OperatorCoder(in_tensors, out_tensors, nullptr, node_index, kX86) {}
+  ~FakeCoder() override = default;
+
+  int Prepare(CoderContext *const context) override { return RET_OK; }
+  int DoCode(CoderContext *const context) override { return RET_OK; }
+};
+}  // namespace
+
+class MemoryManagerTest : public mindspore::CommonTest {
+ public:
+  MemoryManagerTest() = default;
+
+  // a chain of ops, op i reads the output of op i - 1 and writes a float tensor of elements[i], the first op reads
+  // the graph input.
+  void BuildChain(const std::vector<int> &elements) {
+    input_ = std::make_unique<Tensor>(kNumberTypeFloat32, std::vector<int>{kInputElements});
+    input_->set_ref_count(1);
+    Tensor *prev = input_.get();
+    for (size_t i = 0; i < elements.size(); ++i) {
+      auto output = std::make_unique<Tensor>(kNumberTypeFloat32, std::vector<int>{elements[i]});
+      if (i + 1 < elements.size()) {
+        output->set_ref_count(1);
+      }
+      std::vector<Tensor *> in_tensors = {prev};
+      std::vector<Tensor *> out_tensors = {output.get()};
+      nodes_.push_back(std::make_unique<FakeCoder>(in_tensors, out_tensors, i));
+      prev = output.get();
+      outputs_.push_back(std::move(output));
+    }
+  }
+
+  static constexpr int kInputElements = 16;
+  std::unique_ptr<Tensor> input_;
+  std::vector<std::unique_ptr<Tensor>> outputs_;
+  std::vector<std::unique_ptr<OperatorCoder>> nodes_;
+};
+
+// the outputs are 32, 64, 16, 96 and 8 bytes. The greedy plan can't fit the 96 bytes into the freed buffers and
+// ends at 192 bytes, the lifetime plan places it over the outputs of op 0 and op 1, which are dead by then.
+TEST_F(MemoryManagerTest, LifetimePlanNoOverlap) {
+  BuildChain({8, 16, 4, 24, 2});
+  MemoryManager manager;
+  ASSERT_EQ(manager.AssignMemory(nodes_), RET_OK);
+  auto greedy_size = manager.GetAllocatedSize();
+  ASSERT_EQ(greedy_size, 192);
+  ASSERT_EQ(manager.total_size(), 112);
+  ASSERT_LE(manager.total_size(), greedy_size);
+
+  auto offsets = manager.variables_offset();
+  ASSERT_EQ(offsets.size(), outputs_.size());
+  for (size_t i = 0; i < outputs_.size(); ++i) {
+    auto tensor = outputs_[i].get();
+    ASSERT_NE(offsets.find(tensor), offsets.end());
+    ASSERT_LE(offsets[tensor] + tensor->Size(), manager.total_size());
+  }
+  // output i is live from op i to op i + 1, so it overlaps with the lifetime of output i + 1 only.
+  for (size_t i = 0; i + 1 < outputs_.size(); ++i) {
+    auto a = outputs_[i].get();
+    auto b = outputs_[i + 1].get();
+    bool share = offsets[a] < offsets[b] + b->Size() && offsets[b] < offsets[a] + a->Size();
+    ASSERT_FALSE(share) << "output " << i << " and output " << (i + 1) << " are live together but share memory";
+  }
+}
+}  // namespace mindspore::lite::micro
@@ -0,0 +1,139 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USE_DEPRECATED_API
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#include "ir/func_graph.h"
+#include "ops/fusion/activation.h"
+#include "tools/converter/quantizer/calibrator.h"
+
+namespace mindspore::lite::quant {
+namespace {
+constexpr size_t kBitNum = 8;
+constexpr int kQuantMax = 127;
+constexpr int kQuantMin = -128;
+constexpr size_t kBatchNum = 8;
+constexpr size_t kBatchSize = 1000;
+constexpr size_t kSessionNum = 3;
+constexpr auto kNodeName = "act";
+}  // namespace
+
+class CalibratorTest : public mindspore::CommonTest {
+ public:
+  CalibratorTest() = default;
+
+  void SetUp() override {
+    auto graph = std::make_shared<FuncGraph>();
+    auto input = graph->add_parameter();
+    input->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, ShapeVector{kBatchSize}));
+    auto prim = std::make_shared<ops::Activation>();
+    cnode_ = graph->NewCNode({NewValueNode(prim->GetPrim()), input});
+    cnode_->set_fullname_with_scope(kNodeName);
+    cnode_->set_abstract(std::make_shared<abstract::AbstractTensor>(kFloat32, ShapeVector{kBatchSize}));
+    // the samples are not symmetric, and each of them has its own range.
+    batches_.resize(kBatchNum);
+    for (size_t b = 0; b < kBatchNum; ++b) {
+      batches_[b].resize(kBatchSize);
+      for (size_t i = 0; i < kBatchSize; ++i) {
+        batches_[b][i] = static_cast<float>((b * 37 + i * 13) % 1000) / 100.0f - 3.0f - static_cast<float>(b);
+      }
+    }
+  }
+
+  std::unique_ptr<Calibrator> CreateCalibrator(ActivationQuantizedMethod method) {
+    auto calibrator = std::make_unique<Calibrator>(kBitNum, kQuantMax, kQuantMin, method,
+                                                   preprocess::DataPreProcessParam(), true);
+    if (calibrator->AddQuantizedOp(cnode_) != RET_OK) {
+      return nullptr;
+    }
+    return calibrator;
+  }
+
+  // run all the samples in one session, as DoInferenceOnModel does on the calibrator itself.
+  void CollectBySingleSession(Calibrator *calibrator, CollectType collect_type) {
+    auto &info = (*calibrator->GetOutputDivergInfo())[kNodeName].at(0);
+    for (const auto &batch : batches_) {
+      if (collect_type == MIN_MAX) {
+        ASSERT_EQ(calibrator->RecordMaxMinValue(batch.data(), batch.size(), info), RET_OK);
+      } else {
+        ASSERT_EQ(calibrator->UpdateDataFrequency(batch.data(), batch.size(), info), RET_OK);
+      }
+    }
+  }
+
+  // spread the samples over the sessions, which collect into their own copies merged at the end, as DoInference does.
+  void CollectByMultiSessions(Calibrator *calibrator, CollectType collect_type) {
+    std::vector<DivergInfoMap> inputs_diverg_infos(kSessionNum);
+    std::vector<DivergInfoMap> outputs_diverg_infos(kSessionNum);
+    for (size_t i = 0; i < kSessionNum; ++i) {
+      ASSERT_EQ(calibrator->CloneDivergInfo(&inputs_diverg_infos[i], &outputs_diverg_infos[i]), RET_OK);
+    }
+    for (size_t b = 0; b < kBatchNum; ++b) {
+      auto &info = outputs_diverg_infos[b % kSessionNum][kNodeName].at(0);
+      if (collect_type == MIN_MAX) {
+        ASSERT_EQ(calibrator->RecordMaxMinValue(batches_[b].data(), batches_[b].size(), info), RET_OK);
+      } else {
+        ASSERT_EQ(calibrator->UpdateDataFrequency(batches_[b].data(), batches_[b].size(), info), RET_OK);
+      }
+    }
+    for (size_t i = 0; i < kSessionNum; ++i) {
+      ASSERT_EQ(calibrator->MergeDivergInfo(inputs_diverg_infos[i], outputs_diverg_infos[i]), RET_OK);
+    }
+  }
+
+  CNodePtr cnode_ = nullptr;
+  std::vector<std::vector<float>> batches_;
+};
+
+TEST_F(CalibratorTest, MultiSessionsMinMax) {
+  auto single = CreateCalibrator(MAX_MIN);
+  auto multi = CreateCalibrator(MAX_MIN);
+  ASSERT_NE(single, nullptr);
+  ASSERT_NE(multi, nullptr);
+  CollectBySingleSession(single.get(), MIN_MAX);
+  CollectByMultiSessions(multi.get(), MIN_MAX);
+  auto &single_info = (*single->GetOutputDivergInfo())[kNodeName].at(0);
+  auto &multi_info = (*multi->GetOutputDivergInfo())[kNodeName].at(0);
+  EXPECT_EQ(single_info->GetRealMin(), multi_info->GetRealMin());
+  EXPECT_EQ(single_info->GetRealMax(), multi_info->GetRealMax());
+  EXPECT_EQ(single_info->GetScale(), multi_info->GetScale());
+  EXPECT_EQ(single_info->GetZeroPoint(), multi_info->GetZeroPoint());
+}
+
+TEST_F(CalibratorTest, MultiSessionsKL) {
+  auto single = CreateCalibrator(KL);
+  auto multi = CreateCalibrator(KL);
+  ASSERT_NE(single, nullptr);
+  ASSERT_NE(multi, nullptr);
+  CollectBySingleSession(single.get(), MIN_MAX);
+  CollectByMultiSessions(multi.get(), MIN_MAX);
+  ASSERT_EQ(single->UpdateDivergInterval(), RET_OK);
+  ASSERT_EQ(multi->UpdateDivergInterval(), RET_OK);
+  CollectBySingleSession(single.get(), KL_BIN);
+  CollectByMultiSessions(multi.get(), KL_BIN);
+  auto &single_info = (*single->GetOutputDivergInfo())[kNodeName].at(0);
+  auto &multi_info = (*multi->GetOutputDivergInfo())[kNodeName].at(0);
+  ASSERT_EQ(single_info->ComputeThreshold(), RET_OK);
+  ASSERT_EQ(multi_info->ComputeThreshold(), RET_OK);
+  EXPECT_EQ(single_info->GetRealMin(), multi_info->GetRealMin());
+  EXPECT_EQ(single_info->GetRealMax(), multi_info->GetRealMax());
+  // the histograms are summed in another order, which may differ in the last bits.
+  auto single_scale = single_info->GetScale();
+  EXPECT_NEAR(single_scale, multi_info->GetScale(), single_scale * 1e-5);
+}
+}  // namespace mindspore::lite::quant
@@ -0,0 +1,151 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USE_DEPRECATED_API
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include "tools/optimizer/fusion/scaled_dot_product_attention_fusion.h"
+#include "test/ut/tools/optimizer/fusion/fusion_inout_test/fusion_inout_test.h"
+#include "plugin/device/cpu/kernel/nnacl/op_base.h"
+#include "tools/optimizer/common/gllo_utils.h"
+#include "ops/fusion/mat_mul_fusion.h"
+#include "ops/fusion/add_fusion.h"
+#include "ops/softmax.h"
+#include "ops/scaled_dot_product_attention.h"
+#include "ir/graph_utils.h"
+
+namespace mindspore {
+class ScaledDotProductAttentionFusionInoutTest : public FusionInoutTest {
+ public:
+  ScaledDotProductAttentionFusionInoutTest() = default;
+
+  bool IsFused() const {
+    auto attention_prim = std::make_shared<Primitive>(ops::kNameScaledDotProductAttention);
+    auto nodes = TopoSort(graph_->get_return());
+    return std::any_of(nodes.begin(), nodes.end(), [&attention_prim](const AnfNodePtr &node) {
+      return opt::CheckPrimitiveType(node, attention_prim);
+    });
+  }
+
+ protected:
+  void InitPass() override { this->pass_ = std::make_shared<opt::ScaledDotProductAttentionFusion>(); }
+
+  void InitGraph() override {
+    this->graph_ = std::make_shared<FuncGraph>();
+    MS_CHECK_TRUE_MSG(graph_ != nullptr, , "Create FuncGraph failed");
+    auto q = AddParameter(graph_, 0, {batch_, head_, q_seq_, head_size_}, kNumberTypeFloat32, "q");
+    auto k = AddParameter(graph_, 0, {batch_, head_, kv_seq_, head_size_}, kNumberTypeFloat32, "k");
+    auto v = AddParameter(graph_, 0, {batch_, head_, kv_seq_, head_size_}, kNumberTypeFloat32, "v");
+    auto mask = AddParameter(graph_, 0, mask_shape_, kNumberTypeFloat32, "mask");
+    if (q == nullptr || k == nullptr || v == nullptr || mask == nullptr) {
+      this->graph_ = nullptr;
+      return;
+    }
+    auto logits = AddMatMul(graph_, q, k, true, "matmul_qk");
+    if (logits == nullptr) {
+      this->graph_ = nullptr;
+      return;
+    }
+    auto masked_logits = AddAdd(graph_, logits, mask, "add_mask");
+    if (masked_logits == nullptr) {
+      this->graph_ = nullptr;
+      return;
+    }
+    auto probs = AddSoftmax(graph_, masked_logits, "softmax");
+    if (probs == nullptr) {
+      this->graph_ = nullptr;
+      return;
+    }
+    auto out = AddMatMul(graph_, probs, v, false, "matmul_v");
+    if (out == nullptr) {
+      this->graph_ = nullptr;
+      return;
+    }
+    auto ret = AddReturn(graph_, {out});
+    if (ret == nullptr) {
+      this->graph_ = nullptr;
+      return;
+    }
+  }
+
+ private:
+  CNodePtr AddMatMul(const FuncGraphPtr &graph, const AnfNodePtr &input1, const AnfNodePtr &input2, bool transpose_b,
+                     const std::string &name) {
+    auto prim = std::make_unique<ops::MatMulFusion>();
+    MS_CHECK_TRUE_MSG(prim != nullptr, nullptr, "create MatMul primitivec failed");
+    auto prim_c = prim->GetPrim();
+    MS_CHECK_TRUE_MSG(prim_c != nullptr, nullptr, "prim_c is nullptr");
+    prim->Init(false, transpose_b, ActivationType::NO_ACTIVATION);
+    auto matmul_primitive = NewValueNode(prim_c);
+    MS_CHECK_TRUE_RET(matmul_primitive != nullptr, nullptr);
+    auto matmul = graph->NewCNode({matmul_primitive, input1, input2});
+    MS_CHECK_TRUE_MSG(matmul != nullptr, nullptr, "create MatMul failed");
+    matmul->set_fullname_with_scope(name);
+    return matmul;
+  }
+
+  CNodePtr AddAdd(const FuncGraphPtr &graph, const AnfNodePtr &input1, const AnfNodePtr &input2,
+                  const std::string &name) {
+    auto prim = std::make_unique<ops::AddFusion>();
+    MS_CHECK_TRUE_MSG(prim != nullptr, nullptr, "create Add primitivec failed");
+    auto prim_c = prim->GetPrim();
+    MS_CHECK_TRUE_MSG(prim_c != nullptr, nullptr, "prim_c is nullptr");
+    prim->Init(ActivationType::NO_ACTIVATION);
+    auto add_primitive = NewValueNode(prim_c);
+    MS_CHECK_TRUE_RET(add_primitive != nullptr, nullptr);
+    auto add = graph->NewCNode({add_primitive, input1, input2});
+    MS_CHECK_TRUE_MSG(add != nullptr, nullptr, "create Add failed");
+    add->set_fullname_with_scope(name);
+    return add;
+  }
+
+  CNodePtr AddSoftmax(const FuncGraphPtr &graph, const AnfNodePtr &input, const std::string &name) {
+    auto prim = std::make_unique<ops::Softmax>();
+    MS_CHECK_TRUE_MSG(prim != nullptr, nullptr, "create Softmax primitivec failed");
+    auto prim_c = prim->GetPrim();
+    MS_CHECK_TRUE_MSG(prim_c != nullptr, nullptr, "prim_c is nullptr");
+    prim->Init(-1);
+    auto softmax_primitive = NewValueNode(prim_c);
+    MS_CHECK_TRUE_RET(softmax_primitive != nullptr, nullptr);
+    auto softmax = graph->NewCNode({softmax_primitive, input});
+    MS_CHECK_TRUE_MSG(softmax != nullptr, nullptr, "create Softmax failed");
+    softmax->set_fullname_with_scope(name);
+    return softmax;
+  }
+
+ protected:
+  int64_t batch_ = 2;
+  int64_t head_ = 4;
+  int64_t q_seq_ = 8;
+  int64_t kv_seq_ = 8;
+  int64_t head_size_ = 16;
+  std::vector<int64_t> mask_shape_ = {batch_, 1, q_seq_, kv_seq_};
+};
+
+TEST_F(ScaledDotProductAttentionFusionInoutTest, test) {
+  ASSERT_EQ(DoTest(), true);
+  ASSERT_TRUE(IsFused());
+}
+
+// a [B, 1, 1, kv_seq] padding mask is broadcast over the queries by the Add, which the kernel does not support.
+TEST_F(ScaledDotProductAttentionFusionInoutTest, test_mask_broadcast_on_q_seq) {
+  mask_shape_ = {batch_, 1, 1, kv_seq_};
+  ASSERT_EQ(DoTest(), true);
+  ASSERT_FALSE(IsFused());
+}
+}  // namespace mindspore
@@ -250,7 +250,7 @@ int AnfExporter::CreateNewTensorForParameter(const std::unique_ptr<schema::MetaG
   schema_tensor->name = param_node->name();
   schema_tensor->dims = data_info.shape_;
   schema_tensor->dataType = data_info.data_type_;
-  schema_tensor->data = data_info.data_;
+  schema_tensor->data = std::move(data_info.data_);
   schema_tensor->enableHuffmanCode = data_info.enable_huffman_code_;
   schema_tensor->nodeType = NodeType_CNode;
   auto key = std::make_pair(input, 0);
@@ -782,7 +782,7 @@ int AnfExporter::ConvertInputParameter(const CNodePtr &cnode, size_t index, cons
   schema_tensor->name = param_node->name();
   schema_tensor->dims = data_info.shape_;
   schema_tensor->dataType = data_info.data_type_;
-  schema_tensor->data = data_info.data_;
+  schema_tensor->data = std::move(data_info.data_);
   if (param_node->has_default()) {
     schema_tensor->nodeType = NodeType_ValueNode;
   } else {
@@ -815,7 +815,7 @@ int AnfExporter::ConvertInputValueNode(const CNodePtr &cnode, size_t index, cons
   schema_tensor->format = static_cast<schema::Format>(data_info.format_);
   schema_tensor->dataType = data_info.data_type_;
   schema_tensor->dims = data_info.shape_;
-  schema_tensor->data = data_info.data_;
+  schema_tensor->data = std::move(data_info.data_);
 
   auto key = std::make_pair(cnode->input(index), 0);
   node_id_map_[key] = meta_graphT->allTensors.size();
@@ -249,6 +249,34 @@ void BenchmarkFlags::InitResizeDimsList() {
   }
 }
 
+int BenchmarkFlags::InitCycleResizeDimsList() {
+  std::string content = this->cycle_resize_dims_in_;
+  if (content.empty()) {
+    return RET_OK;
+  }
+  auto group_strs = StrSplit(content, std::string(DELIM_SEMICOLON));
+  for (const auto &group_str : group_strs) {
+    std::vector<std::vector<int>> group;
+    auto shape_strs = StrSplit(group_str, std::string(DELIM_COLON));
+    for (const auto &shape_str : shape_strs) {
+      std::vector<int> shape;
+      auto dim_strs = StrSplit(shape_str, std::string(DELIM_COMMA));
+      for (const auto &dim_str : dim_strs) {
+        auto dim = GenericParseValue<int>(dim_str);
+        if (dim.IsNone()) {
+          MS_LOG(ERROR) << "Invalid dim " << dim_str << " in cycleInputShapes: " << content;
+          std::cerr << "Invalid dim " << dim_str << " in cycleInputShapes: " << content << std::endl;
+          return RET_ERROR;
+        }
+        shape.emplace_back(dim.Get());
+      }
+      group.emplace_back(shape);
+    }
+    this->cycle_resize_dims_.emplace_back(group);
+  }
+  return RET_OK;
+}
+
 int BenchmarkBase::CheckModelValid() {
   this->flags_->in_data_type_ = this->flags_->in_data_type_in_ == "img" ? kImage : kBinary;
 
@@ -453,6 +481,9 @@ int BenchmarkBase::Init() {
 
   flags_->InitInputDataList();
   flags_->InitResizeDimsList();
+  if (flags_->InitCycleResizeDimsList() != RET_OK) {
+    return RET_ERROR;
+  }
   if (!flags_->resize_dims_.empty() && !flags_->input_data_list_.empty() &&
       flags_->resize_dims_.size() != flags_->input_data_list_.size()) {
     MS_LOG(ERROR) << "Size of input resizeDims should be equal to size of input inDataPath";
@@ -69,6 +69,7 @@ constexpr int kNumPrintMin = 5;
 constexpr const char *DELIM_COLON = ":";
 constexpr const char *DELIM_COMMA = ",";
 constexpr const char *DELIM_SLASH = "/";
+constexpr const char *DELIM_SEMICOLON = ";";
 constexpr size_t kEncMaxLen = 16;
 
 extern const std::unordered_map<int, std::string> kTypeIdMap;
@@ -140,6 +141,10 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
     AddFlag(&BenchmarkFlags::cosine_distance_threshold_, "cosineDistanceThreshold", "cosine distance threshold", -1.1);
     AddFlag(&BenchmarkFlags::resize_dims_in_, "inputShapes",
             "Shape of input data, the format should be NHWC. e.g. 1,32,32,32:1,1,32,32,1", "");
+    AddFlag(&BenchmarkFlags::cycle_resize_dims_in_, "cycleInputShapes",
+            "Groups of input shapes which the model is resized to in turn to benchmark resize, the groups are "
+            "separated by ';'. e.g. 1,32,32,3:1,32;1,64,64,3:1,64",
+            "");
     AddFlag(&BenchmarkFlags::decrypt_key_str_, "decryptKey",
             "The key used to decrypt the file, expressed in hexadecimal characters. Only support AES-GCM and the key "
             "length is 16.",
@@ -161,6 +166,8 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
 
   void InitResizeDimsList();
 
+  int InitCycleResizeDimsList();
+
  public:
   // common
   bool enable_parallel_predict_ = false;
@@ -191,6 +198,8 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
   // Resize
   std::string resize_dims_in_;
   std::vector<std::vector<int>> resize_dims_;
+  std::string cycle_resize_dims_in_;
+  std::vector<std::vector<std::vector<int>>> cycle_resize_dims_;
 
   std::string device_ = "CPU";
   bool time_profiling_ = false;
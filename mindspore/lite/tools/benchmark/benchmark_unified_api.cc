@@ -1047,6 +1047,60 @@ int BenchmarkUnifiedApi::CompileGraph(ModelType model_type, const std::shared_pt
   return RET_OK;
 }
 
+int BenchmarkUnifiedApi::MarkResizePerformance() {
+  MS_LOG(INFO) << "Running resize benchmark loops...";
+  std::cout << "Running resize benchmark loops..." << std::endl;
+  auto group_num = flags_->cycle_resize_dims_.size();
+  std::vector<std::vector<std::vector<int64_t>>> groups;
+  for (const auto &group : flags_->cycle_resize_dims_) {
+    std::vector<std::vector<int64_t>> dims;
+    (void)std::transform(group.begin(), group.end(), std::back_inserter(dims),
+                         [&](auto &shapes) { return this->ConverterToInt64Vector<int>(shapes); });
+    groups.emplace_back(dims);
+  }
+  std::vector<uint64_t> resize_time(group_num, 0);
+  std::vector<uint64_t> predict_time(group_num, 0);
+  std::vector<MSTensor> outputs;
+  // the first round is the warm up, which resizes to every group for the first time.
+  for (int i = 0; i <= flags_->loop_count_; i++) {
+    for (size_t j = 0; j < group_num; j++) {
+      auto start = GetTimeUs();
+      auto status = ms_model_.Resize(ms_model_.GetInputs(), groups[j]);
+      if (status != kSuccess) {
+        MS_LOG(ERROR) << "Resize error ";
+        std::cerr << "Resize error " << std::endl;
+        return RET_ERROR;
+      }
+      auto resize_end = GetTimeUs();
+      auto inputs = ms_model_.GetInputs();
+      for (auto tensor : inputs) {
+        tensor.MutableData();  // prepare data
+      }
+      auto predict_start = GetTimeUs();
+      status = ms_model_.Predict(inputs, &outputs);
+      if (status != kSuccess) {
+        MS_LOG(ERROR) << "Inference error ";
+        std::cerr << "Inference error " << std::endl;
+        return RET_ERROR;
+      }
+      auto end = GetTimeUs();
+      if (i > 0) {
+        resize_time[j] += resize_end - start;
+        predict_time[j] += end - predict_start;
+      }
+    }
+  }
+  if (flags_->loop_count_ > 0) {
+    for (size_t j = 0; j < group_num; j++) {
+      MS_LOG(INFO) << "Shape group " << j << ", AvgResizeTime = " << resize_time[j] / flags_->loop_count_ / kFloatMSEC
+                   << ", AvgRunTime = " << predict_time[j] / flags_->loop_count_ / kFloatMSEC;
+      printf("Shape group %zu, AvgResizeTime = %f ms, AvgRunTime = %f ms\n", j,
+             resize_time[j] / flags_->loop_count_ / kFloatMSEC, predict_time[j] / flags_->loop_count_ / kFloatMSEC);
+    }
+  }
+  return RET_OK;
+}
+
 int BenchmarkUnifiedApi::RunBenchmark() {
   auto start_prepare_time = GetTimeUs();
 
@@ -1135,6 +1189,13 @@ int BenchmarkUnifiedApi::RunBenchmark() {
       std::cout << "Run MarkAccuracy error: " << status << std::endl;
       return status;
     }
+  } else if (!flags_->cycle_resize_dims_.empty()) {
+    status = MarkResizePerformance();
+    if (status != RET_OK) {
+      MS_LOG(ERROR) << "Run MarkResizePerformance error: " << status;
+      std::cout << "Run MarkResizePerformance error: " << status << std::endl;
+      return status;
+    }
   } else {
     status = MarkPerformance();
     if (status != RET_OK) {
@@ -113,6 +113,9 @@ class MS_API BenchmarkUnifiedApi : public BenchmarkBase {
 
   int MarkPerformance();
 
+  // resize the model to every group of cycle_resize_dims_ in turn, the cost of resize and predict is printed.
+  int MarkResizePerformance();
+
   int MarkAccuracy();
 
   void UpdateDistributionName(const std::shared_ptr<mindspore::Context> &context, std::string *name);
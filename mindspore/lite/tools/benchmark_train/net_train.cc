@@ -280,6 +280,13 @@ int NetTrain::MarkPerformance() {
     printf("Model = %s, NumThreads = %d, MinRunTime = %f ms, MaxRuntime = %f ms, AvgRunTime = %f ms\n",
            flags_->model_file_.substr(flags_->model_file_.find_last_of(DELIM_SLASH) + 1).c_str(), flags_->num_threads_,
            time_min / 1000.0f, time_max / 1000.0f, time_avg / 1000.0f);
+    // the memory planned for the tensors against the step time above, to trade off the recompute memory budget.
+    constexpr float kBytesToMB = 1.0f / (1024 * 1024);
+    auto tensors_size = ms_model_.GetPlannedTensorsSize();
+    MS_LOG(INFO) << "RecomputeBudget = " << flags_->recompute_budget_ << " MB, PlannedTensorsSize = " << tensors_size
+                 << " bytes";
+    printf("RecomputeBudget = %d MB, PlannedTensorsSize = %f MB\n", flags_->recompute_budget_,
+           tensors_size * kBytesToMB);
   }
   return RET_OK;
 }
@@ -402,6 +409,11 @@ void NetTrain::InitMSContext(const std::shared_ptr<Context> &context) {
 }
 
 void NetTrain::InitTrainCfg(const std::shared_ptr<TrainCfg> &train_cfg) {
+  constexpr size_t kMBToBytes = 1024 * 1024;
+  train_cfg->recompute_memory_budget_ = static_cast<size_t>(std::max(flags_->recompute_budget_, 0)) * kMBToBytes;
+  if (!flags_->recompute_names_.empty()) {
+    train_cfg->recompute_names_ = StrSplit(flags_->recompute_names_, ",");
+  }
   if (flags_->loss_name_.empty()) {
     return;
   }
@@ -89,6 +89,10 @@ class MS_API NetTrainFlags : public virtual FlagParser {
     AddFlag(&NetTrainFlags::resize_dims_in_, "inputShapes",
             "Shape of input data, the format should be NHWC. e.g. 1,32,32,32:1,1,32,32,1", "");
     AddFlag(&NetTrainFlags::unified_api_, "unifiedApi", "do unified api test", false);
+    AddFlag(&NetTrainFlags::recompute_budget_, "recomputeBudget",
+            "Memory budget of the activations in MB, which are recomputed in backward to fit it", 0);
+    AddFlag(&NetTrainFlags::recompute_names_, "recomputeNames",
+            "Part of the names of the forward kernels to recompute, separated by comma", "");
   }
 
   ~NetTrainFlags() override = default;
@@ -122,6 +126,9 @@ class MS_API NetTrainFlags : public virtual FlagParser {
   std::string loss_name_ = "";
   std::string inference_file_ = "";
   bool unified_api_ = false;
+  // Recompute
+  int recompute_budget_ = 0;
+  std::string recompute_names_ = "";
 };
 
 class MS_API NetTrain {
@@ -19,6 +19,7 @@
 #ifndef _MSC_VER
 #include <unistd.h>
 #endif
+#include <vector>
 #include "flatbuffers/flatbuffers.h"
 #include "src/common/log_adapter.h"
 #include "nnacl/op_base.h"
@@ -34,6 +35,9 @@ constexpr size_t kModelSizeLimit = static_cast<size_t>(2) * 1024 * 1024 * 1024;
 constexpr size_t kExternalDataHeadSize = 4096;
 constexpr size_t kMagicNumberSize = 4;
 constexpr size_t kFlatbuffersBuilderInitSize = 1024;
+// a weight costs at most this much in the packed model besides its data: the length prefix of the vector and its
+// padding, the offset field in the tensor table and a vtable which may no longer be shared with the other tensors.
+constexpr size_t kPackedWeightOverhead = 64;
 
 void ChangeMod(const std::string &file_path) {
 #ifndef _MSC_VER
@@ -62,8 +66,70 @@ std::fstream *ReopenFile(const std::string &file_path, std::ios_base::openmode o
     return fs;
   }
 }
+
+bool IsWeightTensor(const schema::TensorT &tensor) {
+  // not support control-flow now
+  return tensor.nodeType != NodeType_CNode && tensor.dataType != kObjectTypeTensorType;
+}
+
+size_t GetPackedSize(const schema::MetaGraphT &graph) {
+  flatbuffers::FlatBufferBuilder builder(kFlatbuffersBuilderInitSize);
+  auto offset = schema::MetaGraph::Pack(builder, &graph);
+  builder.Finish(offset);
+  schema::FinishMetaGraphBuffer(builder, offset);
+  return builder.GetSize();
+}
+
+// moves the data of all tensors out of the graph and gives it back when it goes out of scope.
+class WeightsSwapGuard {
+ public:
+  explicit WeightsSwapGuard(schema::MetaGraphT *graph) : graph_(graph), weights_(graph->allTensors.size()) {
+    for (size_t i = 0; i < weights_.size(); ++i) {
+      weights_[i].swap(graph_->allTensors[i]->data);
+    }
+  }
+
+  ~WeightsSwapGuard() {
+    for (size_t i = 0; i < weights_.size(); ++i) {
+      graph_->allTensors[i]->data.swap(weights_[i]);
+    }
+  }
+
+  const std::vector<std::vector<uint8_t>> &weights() const { return weights_; }
+
+ private:
+  schema::MetaGraphT *graph_;
+  std::vector<std::vector<uint8_t>> weights_;
+};
 }  // namespace
 
+bool MetaGraphSerializer::IsModelSizeUnderLimit(schema::MetaGraphT *graph, size_t size_limit) {
+  MS_CHECK_TRUE_MSG(graph != nullptr, false, "graph is nullptr.");
+  size_t structure_size = 0;
+  size_t weight_size = 0;
+  size_t weight_num = 0;
+  {
+    // pack the graph structure with the weights swapped out, which doesn't hold another copy of the weights.
+    WeightsSwapGuard guard(graph);
+    for (const auto &weight : guard.weights()) {
+      weight_size += weight.size();
+      weight_num += weight.empty() ? 0 : 1;
+    }
+    structure_size = GetPackedSize(*graph);
+  }
+  auto min_size = structure_size + weight_size;
+  auto max_size = min_size + weight_num * kPackedWeightOverhead;
+  MS_LOG(DEBUG) << "model structure size: " << structure_size << ", weight size: " << weight_size;
+  if (max_size < size_limit) {
+    return true;
+  }
+  if (min_size >= size_limit) {
+    return false;
+  }
+  // only the layout of the weights decides it, pack the whole model for the exact size.
+  return GetPackedSize(*graph) < size_limit;
+}
+
 bool MetaGraphSerializer::InitPath(const std::string &output_path) {
   if (!ParserPathAndModelName(output_path, &this->save_path_, &this->model_name_)) {
     MS_LOG(ERROR) << "parser save path and model name from output_path failed.";
@@ -159,10 +225,7 @@ bool MetaGraphSerializer::ExtraAndSerializeModelWeight(const schema::MetaGraphT
     return false;
   }
   for (const auto &tensor : graph.allTensors) {
-    if (tensor->nodeType == NodeType_CNode) {
-      continue;
-    }
-    if (tensor->dataType == kObjectTypeTensorType) {  // not support control-flow now
+    if (!IsWeightTensor(*tensor)) {
       continue;
     }
     auto external_data =
@@ -171,7 +234,8 @@ bool MetaGraphSerializer::ExtraAndSerializeModelWeight(const schema::MetaGraphT
       MS_LOG(ERROR) << "Serialized model weight failed";
       return false;
     }
-    tensor->data.clear();
+    // release the weight as soon as it is written, so that the weights never coexist with the model buffer.
+    std::vector<uint8_t>().swap(tensor->data);
     tensor->externalData.emplace_back(external_data);
   }
   return true;
@@ -210,24 +274,26 @@ bool MetaGraphSerializer::SerializeModelAndUpdateWeight(const schema::MetaGraphT
   return true;
 }
 
-int MetaGraphSerializer::Save(const schema::MetaGraphT &graph, const std::string &output_path, const Byte *key,
+int MetaGraphSerializer::Save(schema::MetaGraphT *meta_graph, const std::string &output_path, const Byte *key,
                               const size_t key_len, const std::string &enc_mode) {
-  flatbuffers::FlatBufferBuilder builder(kFlatbuffersBuilderInitSize);
-  auto offset = schema::MetaGraph::Pack(builder, &graph);
-  builder.Finish(offset);
-  schema::FinishMetaGraphBuffer(builder, offset);
-  size_t size = builder.GetSize();
+  MS_CHECK_TRUE_MSG(meta_graph != nullptr, RET_NULL_PTR, "meta_graph is nullptr.");
+  auto save_together = IsModelSizeUnderLimit(meta_graph, kModelSizeLimit);
+  const auto &graph = *meta_graph;
   MetaGraphSerializer meta_graph_serializer;
   if (!meta_graph_serializer.InitPath(output_path)) {
     MS_LOG(ERROR) << "Init path failed";
     return RET_ERROR;
   }
-  auto save_together = (size < kModelSizeLimit);
   if (!meta_graph_serializer.Init(graph, save_together)) {
     MS_LOG(ERROR) << "Init MetaGraphSerializer failed";
     return RET_ERROR;
   }
   if (save_together) {
+    flatbuffers::FlatBufferBuilder builder(kFlatbuffersBuilderInitSize);
+    auto offset = schema::MetaGraph::Pack(builder, &graph);
+    builder.Finish(offset);
+    schema::FinishMetaGraphBuffer(builder, offset);
+    size_t size = builder.GetSize();
     if (!meta_graph_serializer.SerializeModel(builder.GetBufferPointer(), size, key, key_len, enc_mode)) {
       MS_LOG(ERROR) << "Serialize graph failed";
       return RET_ERROR;
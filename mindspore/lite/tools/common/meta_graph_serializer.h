@@ -27,9 +27,13 @@ namespace mindspore::lite {
 class MetaGraphSerializer {
  public:
   // save serialized fb model
-  static int Save(const schema::MetaGraphT &graph, const std::string &output_path, const Byte *key = {},
+  static int Save(schema::MetaGraphT *meta_graph, const std::string &output_path, const Byte *key = {},
                   const size_t key_len = 0, const std::string &enc_mode = "");
 
+  // whether the packed model is smaller than size_limit, so that it is saved together with its weights in one file.
+  // the data of the tensors is moved out of graph while the structure is packed and is restored before returning.
+  static bool IsModelSizeUnderLimit(schema::MetaGraphT *graph, size_t size_limit);
+
  private:
   MetaGraphSerializer() = default;
 
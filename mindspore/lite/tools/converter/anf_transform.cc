@@ -48,6 +48,7 @@
 #include "tools/optimizer/fusion/tensor_dot_fusion.h"
 #include "tools/optimizer/fusion/multi_head_attention_fusion.h"
 #include "tools/optimizer/fusion/glu_fusion.h"
+#include "tools/optimizer/fusion/scaled_dot_product_attention_fusion.h"
 #include "tools/optimizer/fusion/tflite_rel_pos_multi_head_attention_fusion.h"
 #include "tools/optimizer/fusion/matmul_add_fusion.h"
 #include "tools/optimizer/fusion/matmul_mul_fusion.h"
@@ -209,6 +210,9 @@ int AnfTransform::RunFusionPass(const FuncGraphPtr &old_graph, const converter::
   fusion_pm->AddPass(std::make_shared<opt::OnnxGeLUFusion>());
   fusion_pm->AddPass(std::make_shared<opt::TfliteRelPosMultiHeadAttentionFusion>());
   fusion_pm->AddPass(std::make_shared<opt::GLUFusion>());
+  if (!config->trainModel && config->fullQuantParam.target_device != quant::NVGPU) {
+    fusion_pm->AddPass(std::make_shared<opt::ScaledDotProductAttentionFusion>());
+  }
   fusion_pm->AddPass(std::make_shared<opt::ConstFoldPass>(config->fmk, config->trainModel));
   fusion_pm->AddPass(std::make_shared<opt::AffineFusion>());
   fusion_pm->AddPass(std::make_shared<opt::AffineActivationFusion>());
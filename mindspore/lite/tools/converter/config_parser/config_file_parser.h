@@ -56,6 +56,7 @@ struct FullQuantString {
   std::string target_device;
   std::string per_channel;
   std::string cle;
+  std::string calibrate_thread_num;
 };
 
 struct RegistryInfoString {
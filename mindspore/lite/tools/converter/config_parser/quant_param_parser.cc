@@ -161,6 +161,17 @@ int QuantParamParser::ParseFullQuant(const FullQuantString &full_quant_string, q
     MS_LOG(ERROR) << "INPUT ILLEGAL: cle should be true or false.";
     return RET_INPUT_PARAM_INVALID;
   }
+
+  if (!full_quant_string.calibrate_thread_num.empty()) {
+    if (!ConvertIntNum(full_quant_string.calibrate_thread_num, &full_quant->calibrate_thread_num)) {
+      MS_LOG(ERROR) << "INPUT ILLEGAL: calibrate_thread_num should be a valid number.";
+      return RET_INPUT_PARAM_INVALID;
+    }
+    if (full_quant->calibrate_thread_num < 0) {
+      MS_LOG(ERROR) << "INPUT ILLEGAL: calibrate_thread_num should be greater than or equal to 0.";
+      return RET_INPUT_PARAM_INVALID;
+    }
+  }
   return RET_OK;
 }
 
@@ -19,6 +19,7 @@
 #include <memory>
 #include <vector>
 #include <set>
+#include <utility>
 #include "tools/converter/converter_flags.h"
 #include "src/common/log_adapter.h"
 #include "tools/common/meta_graph_serializer.h"
@@ -130,7 +131,7 @@ schema::MetaGraphT *Converter::Convert(const std::unique_ptr<converter::Flags> &
   if (status != RET_OK) {
     MS_LOG(WARNING) << "Export to mindir proto return nullptr.";
   }
-  return TransferFuncGraph(flag, graph);
+  return TransferFuncGraph(flag, std::move(graph));
 }
 
 schema::MetaGraphT *Converter::Convert(const std::unique_ptr<converter::Flags> &flag) {
@@ -174,7 +175,7 @@ schema::MetaGraphT *Converter::Convert(const std::unique_ptr<converter::Flags> &
     MS_LOG(WARNING) << "Export to mindir proto return nullptr.";
   }
 
-  return TransferFuncGraph(flag, graph);
+  return TransferFuncGraph(flag, std::move(graph));
 }
 
 schema::MetaGraphT *Converter::TransferFuncGraph(const std::unique_ptr<converter::Flags> &flag,
@@ -192,6 +193,8 @@ schema::MetaGraphT *Converter::TransferFuncGraph(const std::unique_ptr<converter
     MS_LOG(ERROR) << "Export to meta graph return nullptr";
     return nullptr;
   }
+  // the weights have been copied into the meta graph, release the func graph before the meta graph is compiled.
+  func_graph = nullptr;
 
   // metagraph compile
   metagraph_transform_->SetGraphDef(meta_graph);
@@ -360,7 +363,7 @@ int RunConverter(int argc, const char **argv) {
       return status;
     }
   } else {
-    status = MetaGraphSerializer::Save(*meta_graph, flags->outputFile, flags->encKey, flags->keyLen, flags->encMode);
+    status = MetaGraphSerializer::Save(meta_graph, flags->outputFile, flags->encKey, flags->keyLen, flags->encMode);
     if (status != RET_OK) {
       delete meta_graph;
       oss.clear();
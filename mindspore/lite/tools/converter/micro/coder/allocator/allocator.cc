@@ -130,7 +130,7 @@ int MemoryAllocator::AssignTensors(const std::vector<std::unique_ptr<OperatorCod
   std::map<Tensor *, size_t> offsets = manager->variables_offset();
   RecordTensorsAddr(offsets);
 
-  tensors_size_ = manager->GetAllocatedSize();
+  tensors_size_ = manager->total_size();
   return RET_OK;
 }
 
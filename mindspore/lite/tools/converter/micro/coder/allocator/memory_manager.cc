@@ -15,6 +15,8 @@
  */
 
 #include "tools/converter/micro/coder/allocator/memory_manager.h"
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 #include "mindspore/ccsrc/plugin/device/cpu/kernel/nnacl/op_base.h"
 #include "tools/converter/micro/coder/opcoders/op_coder.h"
@@ -28,14 +30,103 @@ static size_t AlignMemorySize(size_t size) {
 }
 
 int MemoryManager::AssignMemory(const std::vector<std::unique_ptr<OperatorCoder>> &nodes) {
+  // the lifetimes are collected before the greedy plan, which consumes the ref count of the tensors.
+  auto lifetimes = CollectLifetimes(nodes);
+  std::map<Tensor *, size_t> planned_offsets;
+  size_t planned_size = PlanByLifetime(lifetimes, &planned_offsets);
+
   for (const auto &node : nodes) {
     AssignOutputs(node);
     StoreMembufListInfo(node);
     ReleaseInputs(node);
   }
+  total_size_ = GetAllocatedSize();
+  MS_LOG(INFO) << "tensor memory of greedy plan: " << total_size_ << " bytes, lifetime plan: " << planned_size
+               << " bytes";
+  if (planned_size < total_size_) {
+    variables_offset_ = planned_offsets;
+    total_size_ = planned_size;
+  }
   return RET_OK;
 }
 
+std::vector<TensorLifetime> MemoryManager::CollectLifetimes(
+  const std::vector<std::unique_ptr<OperatorCoder>> &nodes) const {
+  std::vector<TensorLifetime> lifetimes;
+  std::map<Tensor *, size_t> lifetime_index;
+  std::map<Tensor *, int> ref_counts;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    for (const auto &output : nodes[i]->output_tensors()) {
+      if (output == nullptr || lifetime_index.find(output) != lifetime_index.end()) {
+        continue;
+      }
+      lifetime_index[output] = lifetimes.size();
+      ref_counts[output] = output->ref_count();
+      // the tensor which isn't released by the nodes is live until the end, such as the graph output.
+      lifetimes.push_back({output, AlignMemorySize(output->Size()), i, nodes.size()});
+    }
+    for (const auto &input : nodes[i]->input_tensors()) {
+      if (input == nullptr || (input->category() != Category::VAR && input->data() != nullptr)) {
+        continue;
+      }
+      auto iter = lifetime_index.find(input);
+      if (iter == lifetime_index.end()) {
+        continue;
+      }
+      auto &lifetime = lifetimes[iter->second];
+      if (--ref_counts[input] <= 0) {
+        lifetime.end_ = lifetime.end_ == nodes.size() ? i : std::max(lifetime.end_, i);
+      }
+    }
+  }
+  return lifetimes;
+}
+
+size_t MemoryManager::PlanByLifetime(const std::vector<TensorLifetime> &lifetimes,
+                                     std::map<Tensor *, size_t> *offsets) const {
+  // greedy by size: the larger tensors are placed first, each into the smallest gap among the placed tensors whose
+  // lifetime overlaps with it.
+  std::vector<size_t> order(lifetimes.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&lifetimes](size_t a, size_t b) { return lifetimes[a].size_ > lifetimes[b].size_; });
+  std::vector<std::pair<size_t, size_t>> placed;  // index of lifetime, offset
+  size_t total_size = 0;
+  for (auto index : order) {
+    const auto &lifetime = lifetimes[index];
+    std::vector<std::pair<size_t, size_t>> conflicts;  // offset, end of offset
+    for (const auto &item : placed) {
+      const auto &other = lifetimes[item.first];
+      if (other.begin_ <= lifetime.end_ && lifetime.begin_ <= other.end_) {
+        conflicts.emplace_back(item.second, item.second + other.size_);
+      }
+    }
+    std::sort(conflicts.begin(), conflicts.end());
+    size_t best_offset = 0;
+    size_t best_gap = SIZE_MAX;
+    size_t prev_end = 0;
+    for (const auto &conflict : conflicts) {
+      if (conflict.first > prev_end) {
+        size_t gap = conflict.first - prev_end;
+        if (gap >= lifetime.size_ && gap < best_gap) {
+          best_gap = gap;
+          best_offset = prev_end;
+        }
+      }
+      prev_end = std::max(prev_end, conflict.second);
+    }
+    if (best_gap == SIZE_MAX) {
+      best_offset = prev_end;
+    }
+    placed.emplace_back(index, best_offset);
+    (void)offsets->insert(std::make_pair(lifetime.tensor_, best_offset));
+    total_size = std::max(total_size, best_offset + lifetime.size_);
+  }
+  return total_size;
+}
+
 void MemoryManager::StoreMembufListInfo(const std::unique_ptr<OperatorCoder> &node) {
   std::vector<MembufPtr> temp;
   for (const auto &membuf : membuf_list_) {
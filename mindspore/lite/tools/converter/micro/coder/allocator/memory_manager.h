@@ -41,6 +41,14 @@ class Membuf {
 };
 using MembufPtr = std::shared_ptr<Membuf>;
 
+// the tensor is live from the node which outputs it to the last node which uses it.
+struct TensorLifetime {
+  Tensor *tensor_;
+  size_t size_;
+  size_t begin_;
+  size_t end_;
+};
+
 class MemoryManager {
  public:
   MemoryManager() = default;
@@ -48,6 +56,8 @@ class MemoryManager {
 
   int AssignMemory(const std::vector<std::unique_ptr<OperatorCoder>> &nodes);
   size_t GetAllocatedSize() const;
+  // the size of the chosen plan, the smaller one of the greedy plan and the lifetime plan.
+  size_t total_size() const { return total_size_; }
   std::map<Tensor *, size_t> variables_offset() { return variables_offset_; }
 
  private:
@@ -64,10 +74,14 @@ class MemoryManager {
 
   void StoreMembufListInfo(const std::unique_ptr<OperatorCoder> &node);
 
+  std::vector<TensorLifetime> CollectLifetimes(const std::vector<std::unique_ptr<OperatorCoder>> &nodes) const;
+  size_t PlanByLifetime(const std::vector<TensorLifetime> &lifetimes, std::map<Tensor *, size_t> *offsets) const;
+
  private:
   std::vector<MembufPtr> membuf_list_;
   std::vector<std::pair<size_t, std::vector<MembufPtr>>> all_membuf_list_info_;
   std::map<Tensor *, size_t> variables_offset_;
+  size_t total_size_{0};
 };
 }  // namespace mindspore::lite::micro
 #endif  // MINDSPORE_LITE_MICRO_CODER_MEMORY_MANAGER_H_
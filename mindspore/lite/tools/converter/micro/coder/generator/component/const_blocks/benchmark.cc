@@ -48,6 +48,9 @@ const char benchmark_source[] = R"RAW(
 
 #define kMaxThreadNum 4
 
+// the size of the runtime buffer, which holds all the tensors and workspaces of the inference.
+int GetBufferSize();
+
 void usage() {
   printf(
     "-- mindspore benchmark params usage:\n"
@@ -131,6 +134,7 @@ int main(int argc, const char **argv) {
     return -1;
   }
   printf("=======run benchmark======\n");
+  printf("runtime buffer size: %d bytes\n", GetBufferSize());
 
   MSContextHandle ms_context_handle = NULL;
   if (argc >= 7) {
@@ -205,17 +209,22 @@ int main(int argc, const char **argv) {
     int loop_count = atoi(argv[3]);
     printf("\nloop count: %d\n", loop_count);
     uint64_t start_time = GetTimeUs();
+    uint64_t min_time = UINT64_MAX;
     for (int i = 0; i < loop_count; ++i) {
+      uint64_t loop_start = GetTimeUs();
       ret = MSModelPredict(model_handle, inputs_handle, &outputs_handle, NULL, NULL);
       if (ret != kMSStatusSuccess) {
         MSModelDestroy(&model_handle);
         printf("MSModelPredict failed, ret: %d", kMSStatusSuccess);
         return ret;
       }
+      uint64_t loop_time = GetTimeUs() - loop_start;
+      min_time = loop_time < min_time ? loop_time : min_time;
     }
     uint64_t end_time = GetTimeUs();
     float total_time = (float)(end_time - start_time) / 1000.0f;
-    printf("total time: %.5fms, per time: %.5fms\n", total_time, total_time / loop_count);
+    printf("total time: %.5fms, per time: %.5fms, min time: %.5fms\n", total_time, total_time / loop_count,
+           (float)min_time / 1000.0f);
   }
   ret = MSModelPredict(model_handle, inputs_handle, &outputs_handle, NULL, NULL);
   if (ret != kMSStatusSuccess) {
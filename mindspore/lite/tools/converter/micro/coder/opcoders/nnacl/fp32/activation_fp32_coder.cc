@@ -29,42 +29,52 @@ int ActivationFP32Coder::DoCode(CoderContext *const context) {
   auto *activation_parameter = reinterpret_cast<ActivationParameter *>(parameter_);
   int length = input_tensor_->ElementsNum();
   MS_CHECK_TRUE(thread_num_ > 0, "thread_num_ <= 0");
-  int stride = UP_DIV(length, thread_num_);
-  int count = MSMIN(stride, length - stride * kDefaultTaskId);
   Collect(context,
           {
             "nnacl/fp32/activation_fp32.h",
+            "wrapper/fp32/activation_fp32_wrapper.h",
           },
           {
             "activation_fp32.c",
+            "activation_fp32_wrapper.c",
           });
-  NNaclFp32Serializer code;
+  std::string act_type;
   switch (activation_parameter->type_) {
     case schema::ActivationType_RELU:
-      code.CodeFunction("Fp32Relu", input_tensor_, count, output_tensor_);
+      act_type = "ActFp32_Relu";
       break;
     case schema::ActivationType_RELU6:
-      code.CodeFunction("Fp32Relu6", input_tensor_, count, output_tensor_);
+      act_type = "ActFp32_Relu6";
       break;
     case schema::ActivationType_LEAKY_RELU:
-      code.CodeFunction("LRelu", input_tensor_, count, output_tensor_, activation_parameter->alpha_);
+      act_type = "ActFp32_LRelu";
       break;
     case schema::ActivationType_SIGMOID:
-      code.CodeFunction("Sigmoid", input_tensor_, count, output_tensor_);
+      act_type = "ActFp32_Sigmoid";
       break;
     case schema::ActivationType_TANH:
-      code.CodeFunction("Tanh", input_tensor_, count, output_tensor_);
+      act_type = "ActFp32_Tanh";
       break;
     case schema::ActivationType_HSWISH:
-      code.CodeFunction("HSwish", input_tensor_, count, output_tensor_);
+      act_type = "ActFp32_HSwish";
       break;
     case schema::ActivationType_HSIGMOID:
-      code.CodeFunction("HSigmoid", input_tensor_, count, output_tensor_);
+      act_type = "ActFp32_HSigmoid";
       break;
     default:
       MS_LOG(ERROR) << "Activation type error";
       return RET_ERROR;
   }
+  NNaclFp32Serializer code;
+  // the elements are split by the thread number of runtime, which may be less than the one of code generation.
+  std::string thread_num = support_parallel_ ? gThreadNum : "1";
+  code.CodeBaseStruct("ActivationFp32Args", kRunArgs, input_tensor_, output_tensor_, activation_parameter->alpha_,
+                      length, act_type, thread_num);
+  if (!support_parallel_) {
+    code.CodeFunction("DoActivationFp32", kRunArgsAddr, kDefaultTaskId, kLhsScale, kRhsScale);
+  } else {
+    code.CodeFunction(kParallelLaunch, "DoActivationFp32", kRunArgsAddr, gThreadNum);
+  }
   MS_LOG(DEBUG) << "ActivationFP32Code has been called";
   context->AppendCode(code.str());
   return lite::RET_OK;
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "wrapper/fp32/activation_fp32_wrapper.h"
+#include "nnacl/fp32/activation_fp32.h"
+#include "nnacl/op_base.h"
+
+int DoActivationFp32(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+  ActivationFp32Args *args = (ActivationFp32Args *)cdata;
+  if (args->thread_num_ <= 0) {
+    return NNACL_ERR;
+  }
+  int stride = UP_DIV(args->length_, args->thread_num_);
+  int count = MSMIN(stride, args->length_ - stride * task_id);
+  if (count <= 0) {
+    return NNACL_OK;
+  }
+  const float *input = args->input_ + stride * task_id;
+  float *output = args->output_ + stride * task_id;
+  switch (args->type_) {
+    case ActFp32_Relu:
+      return Fp32Relu(input, count, output);
+    case ActFp32_Relu6:
+      return Fp32Relu6(input, count, output);
+    case ActFp32_LRelu:
+      return LRelu(input, count, output, args->alpha_);
+    case ActFp32_Sigmoid:
+      return Sigmoid(input, count, output);
+    case ActFp32_Tanh:
+      return Tanh(input, count, output);
+    case ActFp32_HSwish:
+      return HSwish(input, count, output);
+    case ActFp32_HSigmoid:
+      return HSigmoid(input, count, output);
+    default:
+      return NNACL_ERR;
+  }
+}
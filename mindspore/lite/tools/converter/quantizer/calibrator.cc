@@ -27,9 +27,9 @@ namespace mindspore::lite::quant {
 namespace {
 constexpr int kDefaultBinNumber = 2048;
 }  // namespace
-int Calibrator::RecordMaxMinValue(const std::vector<float> &data,
+int Calibrator::RecordMaxMinValue(const float *data, size_t size,
                                   const std::unique_ptr<DataDistribution> &diverg_info) {
-  auto ret = diverg_info->RecordMaxMinValueArray(data);
+  auto ret = diverg_info->RecordMaxMinValueArray(data, size);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "Record max min value array failed.";
     return ret;
@@ -102,10 +102,10 @@ int Calibrator::UpdateDivergInterval() {
   return RET_OK;
 }
 
-int Calibrator::UpdateDataFrequency(const std::vector<float> &data,
+int Calibrator::UpdateDataFrequency(const float *data, size_t size,
                                     const std::unique_ptr<DataDistribution> &diverg_info) {
   MS_ASSERT(diverg_info != nullptr);
-  return diverg_info->UpdateHistogram(data);
+  return diverg_info->UpdateHistogram(data, size);
 }
 
 int Calibrator::AddQuantizedOp(const CNodePtr &cnode) {
@@ -180,17 +180,16 @@ int Calibrator::CollectDataDistribution(
     }
     size_t elem_count = tensor.ElementNum();
     MS_CHECK_GT(elem_count, 0, RET_ERROR);
-    std::vector<float> data(tensor_data, tensor_data + elem_count);
     if (collect_type == MIN_MAX) {
       MS_CHECK_LT(i, (*diverg_info_map)[node_name].size(), RET_ERROR);
-      auto ret = RecordMaxMinValue(data, (*diverg_info_map)[node_name][i]);
+      auto ret = RecordMaxMinValue(tensor_data, elem_count, (*diverg_info_map)[node_name][i]);
       if (ret != RET_OK) {
         MS_LOG(ERROR) << tensor.Name() << " record max min value failed.";
         return RET_ERROR;
       }
     } else if (collect_type == KL_BIN) {
       MS_CHECK_LT(i, (*diverg_info_map)[node_name].size(), RET_ERROR);
-      auto ret = UpdateDataFrequency(data, (*diverg_info_map)[node_name][i]);
+      auto ret = UpdateDataFrequency(tensor_data, elem_count, (*diverg_info_map)[node_name][i]);
       if (ret != RET_OK) {
         MS_LOG(ERROR) << tensor.Name() << " update data frequency failed.";
         return RET_ERROR;
@@ -199,4 +198,63 @@ int Calibrator::CollectDataDistribution(
   }
   return RET_OK;
 }
+
+namespace {
+int CloneDivergInfoMap(const DivergInfoMap &src, DivergInfoMap *dst) {
+  dst->clear();
+  for (const auto &kv : src) {
+    auto &infos = (*dst)[kv.first];
+    for (const auto &info : kv.second) {
+      auto clone = std::make_unique<DataDistribution>(*info.second);
+      MS_CHECK_TRUE_MSG(clone != nullptr, RET_NULL_PTR, "clone is nullptr.");
+      clone->ClearStatistics();
+      infos.insert({info.first, std::move(clone)});
+    }
+  }
+  return RET_OK;
+}
+
+int MergeDivergInfoMap(const DivergInfoMap &src, DivergInfoMap *dst) {
+  for (const auto &kv : src) {
+    auto iter = dst->find(kv.first);
+    if (iter == dst->end()) {
+      MS_LOG(ERROR) << "Can not find the diverg info of node " << kv.first;
+      return RET_ERROR;
+    }
+    for (const auto &info : kv.second) {
+      auto dst_info = iter->second.find(info.first);
+      if (dst_info == iter->second.end()) {
+        MS_LOG(ERROR) << "Can not find the diverg info of node " << kv.first << " tensor " << info.first;
+        return RET_ERROR;
+      }
+      dst_info->second->MergeStatistics(*info.second);
+    }
+  }
+  return RET_OK;
+}
+}  // namespace
+
+int Calibrator::CloneDivergInfo(DivergInfoMap *inputs_diverg_info, DivergInfoMap *outputs_diverg_info) const {
+  MS_CHECK_TRUE_MSG(inputs_diverg_info != nullptr && outputs_diverg_info != nullptr, RET_NULL_PTR,
+                    "diverg_info is nullptr.");
+  auto ret = CloneDivergInfoMap(inputs_diverg_info_, inputs_diverg_info);
+  if (ret != RET_OK) {
+    return ret;
+  }
+  return CloneDivergInfoMap(outputs_diverg_info_, outputs_diverg_info);
+}
+
+int Calibrator::MergeDivergInfo(const DivergInfoMap &inputs_diverg_info, const DivergInfoMap &outputs_diverg_info) {
+  auto ret = MergeDivergInfoMap(inputs_diverg_info, &inputs_diverg_info_);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Merge input diverg info failed.";
+    return ret;
+  }
+  ret = MergeDivergInfoMap(outputs_diverg_info, &outputs_diverg_info_);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Merge output diverg info failed.";
+    return ret;
+  }
+  return RET_OK;
+}
 }  // namespace mindspore::lite::quant
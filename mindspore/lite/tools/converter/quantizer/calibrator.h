@@ -30,6 +30,9 @@ enum CollectType {
   MIN_MAX,
   KL_BIN,
 };
+// {node_name,{tensor_index,DataDistribution}}
+using DivergInfoMap = std::unordered_map<std::string, std::map<int, std::unique_ptr<DataDistribution>>>;
+
 class Calibrator {
  public:
   Calibrator(size_t bit_num, int quant_max, int quant_min, ActivationQuantizedMethod activation_quant_method,
@@ -47,11 +50,11 @@ class Calibrator {
 
   int AddQuantizedOp(const CNodePtr &cnode);
 
-  int RecordMaxMinValue(const std::vector<float> &data, const std::unique_ptr<DataDistribution> &diverg_info);
+  int RecordMaxMinValue(const float *data, size_t size, const std::unique_ptr<DataDistribution> &diverg_info);
 
   int UpdateDivergInterval();
 
-  int UpdateDataFrequency(const std::vector<float> &data, const std::unique_ptr<DataDistribution> &diverg_info);
+  int UpdateDataFrequency(const float *data, size_t size, const std::unique_ptr<DataDistribution> &diverg_info);
 
   int ComputeThreshold();
 
@@ -72,6 +75,12 @@ class Calibrator {
     std::unordered_map<std::string, std::map<int, std::unique_ptr<DataDistribution>>> *diverg_info_map,
     CollectType collect_type);
 
+  // copy the distributions without the collected data, for one thread of the calibration to collect data into.
+  int CloneDivergInfo(DivergInfoMap *inputs_diverg_info, DivergInfoMap *outputs_diverg_info) const;
+
+  // merge the data collected by one thread of the calibration.
+  int MergeDivergInfo(const DivergInfoMap &inputs_diverg_info, const DivergInfoMap &outputs_diverg_info);
+
  private:
   // {node_name,{tensor_index,DataDistribution}}
   std::unordered_map<std::string, std::map<int, std::unique_ptr<DataDistribution>>> inputs_diverg_info_;
@@ -21,22 +21,16 @@
 #include <utility>
 #include <set>
 #include "tools/common/statistic_utils.h"
+#include "nnacl/fp32/calibration_fp32.h"
 
 namespace mindspore::lite::quant {
-int DataDistribution::RecordMaxMinValueArray(const std::vector<float> &data) {
-  if (data.empty()) {
+int DataDistribution::RecordMaxMinValueArray(const float *data, size_t size) {
+  if (data == nullptr || size == 0 || size > INT32_MAX) {
     return RET_ERROR;
   }
-  float min_num = data.at(0);
-  float max_num = data.at(0);
-  for (float val : data) {
-    min_num = std::min(val, min_num);
-    max_num = std::max(val, max_num);
-  }
-  real_min_ = std::min(min_num, real_min_);
-  real_max_ = std::max(max_num, real_max_);
+  CalibrationMinMaxFp32(data, static_cast<int>(size), &real_min_, &real_max_);
   if (activation_quant_method_ == REMOVAL_OUTLIER) {
-    auto bak_data(data);
+    std::vector<float> bak_data(data, data + size);
     const float min_percentage = 0.0001;
     const float max_percentage = 0.9999;
     auto const quantile_min_index = static_cast<int>(min_percentage * bak_data.size());
@@ -59,21 +53,41 @@ void DataDistribution::UpdateInterval() {
   this->interval_ = max_value / static_cast<float>(bin_num_);
 }
 
-int DataDistribution::UpdateHistogram(const std::vector<float> &data) {
-  for (auto value : data) {
-    if (value == 0) {
-      continue;
-    }
-    if (this->interval_ == 0) {
+int DataDistribution::UpdateHistogram(const float *data, size_t size) {
+  if (data == nullptr || size > INT32_MAX) {
+    return RET_ERROR;
+  }
+  if (this->interval_ == 0) {
+    // all values are 0 when the interval is 0, which are not counted.
+    if (std::any_of(data, data + size, [](float value) { return value != 0; })) {
       MS_LOG(ERROR) << "divisor 'interval' cannot be 0.";
       return RET_ERROR;
     }
-    int bin_index = std::min(static_cast<int>(std::fabs(value) / this->interval_), bin_num_ - 1);
-    this->histogram_[bin_index]++;
+    return RET_OK;
   }
+  CalibrationHistogramFp32(data, static_cast<int>(size), this->interval_, this->histogram_.data(), bin_num_);
   return RET_OK;
 }
 
+void DataDistribution::ClearStatistics() {
+  real_max_ = -FLT_MAX;
+  real_min_ = FLT_MAX;
+  std::fill(histogram_.begin(), histogram_.end(), 0.0f);
+  min_datas_.clear();
+  max_datas_.clear();
+}
+
+void DataDistribution::MergeStatistics(const DataDistribution &other) {
+  MS_ASSERT(histogram_.size() == other.histogram_.size());
+  real_min_ = std::min(real_min_, other.real_min_);
+  real_max_ = std::max(real_max_, other.real_max_);
+  for (size_t i = 0; i < histogram_.size(); ++i) {
+    histogram_[i] += other.histogram_[i];
+  }
+  min_datas_.insert(min_datas_.end(), other.min_datas_.begin(), other.min_datas_.end());
+  max_datas_.insert(max_datas_.end(), other.max_datas_.begin(), other.max_datas_.end());
+}
+
 void DataDistribution::DumpHistogram() {
   MS_LOG(INFO) << "Print node " << cnode_->fullname_with_scope() << " histogram";
   for (float item : this->histogram_) {
@@ -43,11 +43,16 @@ class DataDistribution {
     }
   }
 
-  int RecordMaxMinValueArray(const std::vector<float> &data);
+  int RecordMaxMinValueArray(const float *data, size_t size);
 
   void UpdateInterval();
 
-  int UpdateHistogram(const std::vector<float> &data);
+  int UpdateHistogram(const float *data, size_t size);
+
+  // clear the collected statistics of a copy, which collects the data of another thread and is merged back.
+  void ClearStatistics();
+
+  void MergeStatistics(const DataDistribution &other);
 
   void DumpHistogram();
 
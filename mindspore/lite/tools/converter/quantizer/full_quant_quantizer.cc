@@ -18,7 +18,11 @@
 
 #include "tools/converter/quantizer/full_quant_quantizer.h"
 #include <dirent.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <set>
+#include <thread>
 #include <memory>
 #include <unordered_map>
 #include <string>
@@ -47,6 +51,8 @@ namespace {
 static const std::set<PrimitivePtr> has_bias_operator = {prim::kPrimConv2DFusion, prim::kPrimConv2dTransposeFusion,
                                                          prim::kPrimMatMulFusion, prim::kPrimFullConnection,
                                                          prim::kPrimLayerNormFusion};
+constexpr size_t kMaxCalibrateThreadNum = 4;
+constexpr size_t kCalibrateCpuPerThread = 2;
 }  // namespace
 FullQuantQuantizer::~FullQuantQuantizer() {}
 
@@ -525,52 +531,147 @@ int FullQuantQuantizer::InitDeviceConfig(const FuncGraphPtr &func_graph) {
   return RET_OK;
 }
 
-int FullQuantQuantizer::DoInference(CollectType collect_type) {
+int FullQuantQuantizer::InitCalibrationModels(const FuncGraphPtr &func_graph) {
+  calibration_models_.clear();
+  size_t batch_num = calibrator_->GetBatchNum();
+  size_t cpu_num = std::max(1u, std::thread::hardware_concurrency());
+  size_t worker_num = static_cast<size_t>(flags_.fullQuantParam.calibrate_thread_num);
+  if (worker_num == 0) {
+    worker_num = std::min(kMaxCalibrateThreadNum, std::max<size_t>(1, cpu_num / kCalibrateCpuPerThread));
+  }
+  worker_num = std::max<size_t>(1, std::min(worker_num, batch_num));
+  if (worker_num == 1) {
+    return RET_OK;
+  }
+  // the sessions share the cores, and they are not bound to the cores which the others may run on. All of them are
+  // built with the same context, fp32_ms_model_ keeps its default context for the bias correction.
+  int inter_op_thread_num = static_cast<int>(std::max<size_t>(1, cpu_num / worker_num));
+  for (size_t i = 0; i < worker_num; i++) {
+    auto context = std::make_shared<mindspore::Context>();
+    CHECK_NULL_RETURN(context);
+    context->SetThreadNum(inter_op_thread_num);
+    context->SetThreadAffinity(0);
+    auto device_info = std::make_shared<CPUDeviceInfo>();
+    CHECK_NULL_RETURN(device_info);
+    context->MutableDeviceInfo().push_back(device_info);
+    auto model = std::make_shared<mindspore::Model>();
+    CHECK_NULL_RETURN(model);
+    int size = 0;
+    auto ret = BuildModelByFuncGraph(model, func_graph, flags_, context, &size);
+    if (ret != mindspore::kSuccess) {
+      MS_LOG(ERROR) << "Build calibration model " << i << " failed.";
+      return RET_ERROR;
+    }
+    calibration_models_.push_back(model);
+  }
+  MS_LOG(INFO) << "Calibrate with " << worker_num << " sessions, each session runs with " << inter_op_thread_num
+               << " threads.";
+  return RET_OK;
+}
+
+int FullQuantQuantizer::DoInferenceOnModel(const std::shared_ptr<mindspore::Model> &model, CollectType collect_type,
+                                           std::atomic<size_t> *next_index, DivergInfoMap *inputs_diverg_info,
+                                           DivergInfoMap *outputs_diverg_info) {
   // get input tensor
-  vector<mindspore::MSTensor> inputs = fp32_ms_model_->GetInputs();
+  vector<mindspore::MSTensor> inputs = model->GetInputs();
   if (inputs.size() != calibrator_->GetInputNum()) {
     MS_LOG(ERROR) << "model's input tensor count: " << inputs.size() << " != "
                   << " calibrator count:" << calibrator_->GetInputNum();
     return RET_ERROR;
   }
-
-  for (size_t calib_index = 0; calib_index < calibrator_->GetBatchNum(); calib_index++) {
+  MSKernelCallBack beforeCallBack = [&](const std::vector<mindspore::MSTensor> &beforeInputs,
+                                        const std::vector<mindspore::MSTensor> &beforeOutputs,
+                                        const MSCallBackParam &callParam) -> bool {
+    auto ret =
+      calibrator_->CollectDataDistribution(callParam.node_name, beforeInputs, inputs_diverg_info, collect_type);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "CollectDataDistribution failed.";
+      return false;
+    }
+    return true;
+  };
+  // func
+  MSKernelCallBack afterCallBack = [&](const std::vector<mindspore::MSTensor> &afterInputs,
+                                       const std::vector<mindspore::MSTensor> &afterOutputs,
+                                       const MSCallBackParam &callParam) -> bool {
+    auto ret =
+      calibrator_->CollectDataDistribution(callParam.node_name, afterOutputs, outputs_diverg_info, collect_type);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "CollectDataDistribution failed.";
+      return false;
+    }
+    return true;
+  };
+  for (auto calib_index = next_index->fetch_add(1); calib_index < calibrator_->GetBatchNum();
+       calib_index = next_index->fetch_add(1)) {
     MS_LOG(INFO) << "Do inference round: " << calib_index;
     // set multi-input data
     for (auto tensor : inputs) {
       int status = calibrator_->GenerateInputData(tensor.Name(), calib_index, &tensor);
       MS_CHECK_TRUE_MSG(status == RET_OK, RET_ERROR, "generate input data from images failed!");
     }
-    MSKernelCallBack beforeCallBack = [&](const std::vector<mindspore::MSTensor> &beforeInputs,
-                                          const std::vector<mindspore::MSTensor> &beforeOutputs,
-                                          const MSCallBackParam &callParam) -> bool {
-      auto diverg_info_map = calibrator_->GetInputDivergInfo();
-      auto ret = calibrator_->CollectDataDistribution(callParam.node_name, beforeInputs, diverg_info_map, collect_type);
+    auto outputs = model->GetOutputs();
+    auto status = model->Predict(inputs, &outputs, beforeCallBack, afterCallBack);
+    if (status != mindspore::kSuccess) {
+      MS_LOG(ERROR) << "run model failed!";
+      return RET_ERROR;
+    }
+  }
+  return RET_OK;
+}
+
+int FullQuantQuantizer::DoInference(CollectType collect_type) {
+  auto start = std::chrono::steady_clock::now();
+  std::atomic<size_t> next_index{0};
+  size_t worker_num = calibration_models_.size();
+  if (worker_num <= 1) {
+    auto ret = DoInferenceOnModel(fp32_ms_model_, collect_type, &next_index, calibrator_->GetInputDivergInfo(),
+                                  calibrator_->GetOutputDivergInfo());
+    if (ret != RET_OK) {
+      return ret;
+    }
+  } else {
+    // every session collects the data distribution of its samples by itself, which are merged at the end.
+    std::vector<DivergInfoMap> inputs_diverg_infos(worker_num);
+    std::vector<DivergInfoMap> outputs_diverg_infos(worker_num);
+    for (size_t i = 0; i < worker_num; i++) {
+      auto ret = calibrator_->CloneDivergInfo(&inputs_diverg_infos[i], &outputs_diverg_infos[i]);
       if (ret != RET_OK) {
-        MS_LOG(ERROR) << "CollectDataDistribution failed.";
-        return false;
+        MS_LOG(ERROR) << "Clone diverg info failed.";
+        return ret;
+      }
+    }
+    std::vector<int> status(worker_num, RET_OK);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < worker_num; i++) {
+      threads.emplace_back([&, i]() {
+        status[i] = DoInferenceOnModel(calibration_models_[i], collect_type, &next_index, &inputs_diverg_infos[i],
+                                       &outputs_diverg_infos[i]);
+      });
+    }
+    status[0] = DoInferenceOnModel(calibration_models_[0], collect_type, &next_index, &inputs_diverg_infos[0],
+                                   &outputs_diverg_infos[0]);
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    for (size_t i = 0; i < worker_num; i++) {
+      if (status[i] != RET_OK) {
+        MS_LOG(ERROR) << "Do inference on session " << i << " failed.";
+        return status[i];
       }
-      return true;
-    };
-    // func
-    MSKernelCallBack afterCallBack = [&](const std::vector<mindspore::MSTensor> &afterInputs,
-                                         const std::vector<mindspore::MSTensor> &afterOutputs,
-                                         const MSCallBackParam &callParam) -> bool {
-      auto diverg_info_map = calibrator_->GetOutputDivergInfo();
-      auto ret = calibrator_->CollectDataDistribution(callParam.node_name, afterOutputs, diverg_info_map, collect_type);
+      auto ret = calibrator_->MergeDivergInfo(inputs_diverg_infos[i], outputs_diverg_infos[i]);
       if (ret != RET_OK) {
-        MS_LOG(ERROR) << "CollectDataDistribution failed.";
-        return false;
+        MS_LOG(ERROR) << "Merge diverg info failed.";
+        return ret;
       }
-      return true;
-    };
-    auto outputs = fp32_ms_model_->GetOutputs();
-    auto status = fp32_ms_model_->Predict(inputs, &outputs, beforeCallBack, afterCallBack);
-    if (status != mindspore::kSuccess) {
-      MS_LOG(ERROR) << "run model failed!";
-      return RET_ERROR;
     }
   }
+  auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  auto batch_num = calibrator_->GetBatchNum();
+  auto samples_per_second = cost > 0 ? batch_num / cost : 0;
+  MS_LOG(INFO) << "Calibrate (" << (collect_type == MIN_MAX ? "MIN_MAX" : "KL_BIN") << ") " << batch_num
+               << " samples with " << std::max<size_t>(1, worker_num)
+               << " sessions cost " << cost << "s, " << samples_per_second << " samples/s.";
   return RET_OK;
 }
 
@@ -609,6 +710,11 @@ int FullQuantQuantizer::DoQuantize(FuncGraphPtr func_graph) {
     MS_LOG(ERROR) << "Build model failed.";
     return RET_ERROR;
   }
+  status = InitCalibrationModels(func_graph);
+  if (status != RET_OK) {
+    MS_LOG(ERROR) << "Init calibration models failed.";
+    return status;
+  }
   MS_LOG(INFO) << "start to update divergence's max value";
   status = DoInference(MIN_MAX);
   if (status != RET_OK) {
@@ -624,6 +730,9 @@ int FullQuantQuantizer::DoQuantize(FuncGraphPtr func_graph) {
     }
   }
 
+  // the calibration is done, release the sessions of it.
+  calibration_models_.clear();
+
   MS_LOG(INFO) << "start to generate quant param and quantize tensor's data";
   status = QuantNode(func_graph);
   if (status != RET_OK) {
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_LITE_TOOLS_CONVERTER_QUANTIZER_FULL_QUANT_QUANTIZER_H
 #define MINDSPORE_LITE_TOOLS_CONVERTER_QUANTIZER_FULL_QUANT_QUANTIZER_H
 
+#include <atomic>
 #include <string>
 #include <memory>
 #include <unordered_map>
@@ -51,6 +52,12 @@ class FullQuantQuantizer : public Quantizer {
  private:
   int InitDeviceConfig(const FuncGraphPtr &func_graph);
 
+  int InitCalibrationModels(const FuncGraphPtr &func_graph);
+
+  int DoInferenceOnModel(const std::shared_ptr<mindspore::Model> &model, CollectType collect_type,
+                         std::atomic<size_t> *next_index, DivergInfoMap *inputs_diverg_info,
+                         DivergInfoMap *outputs_diverg_info);
+
   int DoInference(CollectType collect_type);
 
   int UpdateDivergeInterval();
@@ -107,6 +114,8 @@ class FullQuantQuantizer : public Quantizer {
   std::shared_ptr<Calibrator> calibrator_{nullptr};
   std::shared_ptr<QuantStrategy> quant_strategy_{nullptr};
   std::shared_ptr<mindspore::Model> fp32_ms_model_{nullptr};
+  // the sessions which run the calibration dataset in parallel, empty if fp32_ms_model_ runs it alone.
+  std::vector<std::shared_ptr<mindspore::Model>> calibration_models_;
 
   // key is tensor_name
   std::map<std::string, std::vector<schema::QuantParamT>> weight_quant_params_bak;
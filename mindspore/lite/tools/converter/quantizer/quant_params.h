@@ -56,6 +56,8 @@ struct FullQuantParam {
   bool cle = false;
   bool per_channel = true;
   TargetDevice target_device = CPU;
+  // the number of sessions which run the calibration dataset in parallel, 0 means decided by the cpu cores.
+  int calibrate_thread_num = 0;
 };
 }  // namespace mindspore::lite::quant
 
@@ -262,6 +262,21 @@ Status BuildModelByFuncGraph(const std::shared_ptr<mindspore::Model> &model, con
 
 Status BuildModelByFuncGraph(const std::shared_ptr<mindspore::Model> &model, const FuncGraphPtr &func_graph,
                              const converter::Flags &flags, int *size) {
+  auto context = std::make_shared<mindspore::Context>();
+  if (context == nullptr) {
+    MS_LOG(ERROR) << "New context failed while running.";
+    return kLiteNullptr;
+  }
+  context->SetThreadAffinity(kCpuBindMode);
+  std::shared_ptr<CPUDeviceInfo> device_info = std::make_shared<CPUDeviceInfo>();
+  auto &device_list = context->MutableDeviceInfo();
+  device_list.push_back(device_info);
+  return BuildModelByFuncGraph(model, func_graph, flags, context, size);
+}
+
+Status BuildModelByFuncGraph(const std::shared_ptr<mindspore::Model> &model, const FuncGraphPtr &func_graph,
+                             const converter::Flags &flags, const std::shared_ptr<mindspore::Context> &context,
+                             int *size) {
   auto meta_graph = Export(func_graph, true, true);
   if (meta_graph == nullptr) {
     MS_LOG(ERROR) << "Export to meta_graph failed";
@@ -290,16 +305,6 @@ Status BuildModelByFuncGraph(const std::shared_ptr<mindspore::Model> &model, con
     delete meta_graph;
     return kLiteNullptr;
   }
-  auto context = std::make_shared<mindspore::Context>();
-  context->SetThreadAffinity(kCpuBindMode);
-  if (context == nullptr) {
-    MS_LOG(ERROR) << "New context failed while running.";
-    delete meta_graph;
-    return kLiteNullptr;
-  }
-  std::shared_ptr<CPUDeviceInfo> device_info = std::make_shared<CPUDeviceInfo>();
-  auto &device_list = context->MutableDeviceInfo();
-  device_list.push_back(device_info);
   auto ret = model->Build(content, *size, kMindIR, context);
   delete meta_graph;
   return ret;
@@ -193,6 +193,10 @@ Status BuildModelByFuncGraph(const std::shared_ptr<mindspore::Model> &model, con
 Status BuildModelByFuncGraph(const std::shared_ptr<mindspore::Model> &model, const FuncGraphPtr &func_graph,
                              const converter::Flags &flags, int *size);
 
+Status BuildModelByFuncGraph(const std::shared_ptr<mindspore::Model> &model, const FuncGraphPtr &func_graph,
+                             const converter::Flags &flags, const std::shared_ptr<mindspore::Context> &context,
+                             int *size);
+
 mindspore::lite::Tensor *MSTensorToLiteTensor(const mindspore::MSTensor &tensor);
 
 std::vector<mindspore::lite::Tensor *> MSTensorToLiteTensors(const std::vector<mindspore::MSTensor> &srcTensors);
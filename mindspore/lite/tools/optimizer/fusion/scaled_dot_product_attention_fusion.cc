@@ -0,0 +1,276 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USE_DEPRECATED_API
+#include "tools/optimizer/fusion/scaled_dot_product_attention_fusion.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include "ops/scaled_dot_product_attention.h"
+#include "ops/op_utils.h"
+#include "tools/optimizer/common/gllo_utils.h"
+#include "nnacl/op_base.h"
+
+namespace mindspore::opt {
+namespace {
+constexpr auto kAttentionPattern = "AttentionPattern";
+constexpr auto kAttentionWithScalePattern = "AttentionWithScalePattern";
+constexpr auto kAttentionWithMaskPattern = "AttentionWithMaskPattern";
+constexpr auto kAttentionWithScaleMaskPattern = "AttentionWithScaleMaskPattern";
+
+bool IsMulOrDivNode(const BaseRef &n) {
+  return IsSpecifiedNode<&prim::kPrimMulFusion>(n) || IsSpecifiedNode<&prim::kPrimDivFusion>(n);
+}
+
+bool HasActivation(const PrimitivePtr &prim) {
+  auto act_attr = prim->GetAttr(ops::kActivationType);
+  return act_attr != nullptr && GetValue<int64_t>(act_attr) != static_cast<int64_t>(ActivationType::NO_ACTIVATION);
+}
+
+bool GetBoolAttr(const PrimitivePtr &prim, const std::string &name) {
+  auto attr = prim->GetAttr(name);
+  return attr != nullptr && GetValue<bool>(attr);
+}
+
+// the MatMul without bias and activation, whose transpose attributes are as expected.
+bool CheckMatMul(const CNodePtr &matmul, bool transpose_b) {
+  auto prim = GetValueNode<PrimitivePtr>(matmul->input(0));
+  MS_CHECK_TRUE_RET(prim != nullptr, false);
+  return matmul->size() == kInputSizeThree && !HasActivation(prim) && !GetBoolAttr(prim, ops::kTransposeA) &&
+         GetBoolAttr(prim, ops::kTransposeB) == transpose_b;
+}
+}  // namespace
+
+bool ScaledDotProductAttentionFusion::Init() const {
+  q_ = std::make_shared<Var>();
+  MS_CHECK_TRUE_RET(q_ != nullptr, false);
+  k_ = std::make_shared<Var>();
+  MS_CHECK_TRUE_RET(k_ != nullptr, false);
+  v_ = std::make_shared<Var>();
+  MS_CHECK_TRUE_RET(v_ != nullptr, false);
+  mask_ = std::make_shared<Var>();
+  MS_CHECK_TRUE_RET(mask_ != nullptr, false);
+  scale_ = std::make_shared<CondVar>(IsParamOrValueNodeWithData);
+  MS_CHECK_TRUE_RET(scale_ != nullptr, false);
+  return true;
+}
+
+VectorRef ScaledDotProductAttentionFusion::DefinePattern(bool with_scale, bool with_mask) const {
+  auto is_matmul_qk = std::make_shared<CondVar>(IsSpecifiedNode<&prim::kPrimMatMulFusion>);
+  MS_CHECK_TRUE_RET(is_matmul_qk != nullptr, {});
+  auto logits = VectorRef({is_matmul_qk, q_, k_});
+  if (with_scale) {
+    auto is_scale = std::make_shared<CondVar>(IsMulOrDivNode);
+    MS_CHECK_TRUE_RET(is_scale != nullptr, {});
+    logits = VectorRef({is_scale, logits, scale_});
+  }
+  if (with_mask) {
+    auto is_add = std::make_shared<CondVar>(IsSpecifiedNode<&prim::kPrimAddFusion>);
+    MS_CHECK_TRUE_RET(is_add != nullptr, {});
+    logits = VectorRef({is_add, logits, mask_});
+  }
+  auto is_softmax = std::make_shared<CondVar>(IsSpecifiedNode<&prim::kPrimSoftmax>);
+  MS_CHECK_TRUE_RET(is_softmax != nullptr, {});
+  auto softmax = VectorRef({is_softmax, logits});
+  auto is_matmul_v = std::make_shared<CondVar>(IsSpecifiedNode<&prim::kPrimMatMulFusion>);
+  MS_CHECK_TRUE_RET(is_matmul_v != nullptr, {});
+  return VectorRef({is_matmul_v, softmax, v_});
+}
+
+std::unordered_map<std::string, VectorRef> ScaledDotProductAttentionFusion::DefinePatterns() const {
+  std::unordered_map<std::string, VectorRef> patterns;
+  if (!Init()) {
+    MS_LOG(ERROR) << "initial member failed.";
+    return patterns;
+  }
+  patterns[kAttentionPattern] = DefinePattern(false, false);
+  patterns[kAttentionWithScalePattern] = DefinePattern(true, false);
+  patterns[kAttentionWithMaskPattern] = DefinePattern(false, true);
+  patterns[kAttentionWithScaleMaskPattern] = DefinePattern(true, true);
+  return patterns;
+}
+
+bool ScaledDotProductAttentionFusion::CheckAttentionNodes(const FuncGraphPtr &func_graph, const CNodePtr &cnode,
+                                                          bool with_scale, bool with_mask, float *scale) const {
+  MS_ASSERT(func_graph != nullptr && cnode != nullptr && scale != nullptr);
+  if (IsMarkedTrainOp(cnode) || !CheckMatMul(cnode, false)) {
+    return false;
+  }
+  // walk from MatMul(softmax, v) back to MatMul(q, k), the intermediate results must not be used by others.
+  auto softmax = cnode->input(1)->cast<CNodePtr>();
+  MS_CHECK_TRUE_RET(softmax != nullptr, false);
+  std::vector<CNodePtr> inner_nodes = {softmax};
+  auto logits = softmax->input(1)->cast<CNodePtr>();
+  MS_CHECK_TRUE_RET(logits != nullptr, false);
+  if (with_mask) {
+    inner_nodes.push_back(logits);
+    logits = logits->input(1)->cast<CNodePtr>();
+    MS_CHECK_TRUE_RET(logits != nullptr, false);
+  }
+  *scale = 1.0f;
+  if (with_scale) {
+    inner_nodes.push_back(logits);
+    auto scale_tensor = GetTensorInfo(logits->input(kInputIndexTwo));
+    if (scale_tensor == nullptr || scale_tensor->data_type() != kNumberTypeFloat32 ||
+        scale_tensor->DataSize() != 1 || scale_tensor->data_c() == nullptr) {
+      return false;
+    }
+    auto value = *reinterpret_cast<float *>(scale_tensor->data_c());
+    *scale = CheckPrimitiveType(logits, prim::kPrimDivFusion) ? 1.0f / value : value;
+    // the kernel takes the non-positive scale as 1 / sqrt(head_size).
+    if (!(*scale > 0.0f)) {
+      return false;
+    }
+    logits = logits->input(1)->cast<CNodePtr>();
+    MS_CHECK_TRUE_RET(logits != nullptr, false);
+  }
+  if (!CheckMatMul(logits, true)) {
+    return false;
+  }
+  inner_nodes.push_back(logits);
+  for (auto &node : inner_nodes) {
+    auto prim = GetValueNode<PrimitivePtr>(node->input(0));
+    MS_CHECK_TRUE_RET(prim != nullptr, false);
+    if (IsMarkedTrainOp(node) || IsMultiOutputTensors(func_graph, node) || HasActivation(prim)) {
+      return false;
+    }
+  }
+
+  // the softmax must be on the last axis.
+  auto softmax_prim = GetValueNode<PrimitivePtr>(softmax->input(0));
+  MS_CHECK_TRUE_RET(softmax_prim != nullptr, false);
+  auto axis_attr = softmax_prim->GetAttr(ops::kAxis);
+  if (axis_attr == nullptr) {
+    return false;
+  }
+  auto axis = GetValue<std::vector<int64_t>>(axis_attr);
+  if (axis.size() != 1) {
+    return false;
+  }
+  if (axis.front() != -1) {
+    ShapeVector logits_shape;
+    if (FetchShapeFromAbstract(logits->abstract(), &logits_shape) != lite::RET_OK ||
+        axis.front() != static_cast<int64_t>(logits_shape.size()) - 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ScaledDotProductAttentionFusion::CheckInputShapes(const AnfNodePtr &q, const AnfNodePtr &k,
+                                                       const AnfNodePtr &v) const {
+  ShapeVector q_shape;
+  ShapeVector k_shape;
+  ShapeVector v_shape;
+  if (FetchShapeFromAbstract(q->abstract(), &q_shape) != lite::RET_OK ||
+      FetchShapeFromAbstract(k->abstract(), &k_shape) != lite::RET_OK ||
+      FetchShapeFromAbstract(v->abstract(), &v_shape) != lite::RET_OK) {
+    return false;
+  }
+  // the MatMul may broadcast, while the attention needs q: [..., q_seq, d], k and v: [..., kv_seq, d].
+  if (q_shape.size() < DIMENSION_2D || k_shape != v_shape || q_shape.size() != k_shape.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < q_shape.size(); ++i) {
+    if (i != q_shape.size() - DIMENSION_2D && q_shape[i] != k_shape[i]) {
+      return false;
+    }
+  }
+  // the kernel attends the queries to the bottom right of the keys, so it needs kv_seq >= q_seq.
+  auto q_seq = q_shape[q_shape.size() - DIMENSION_2D];
+  auto kv_seq = k_shape[k_shape.size() - DIMENSION_2D];
+  return q_seq > 0 && kv_seq >= q_seq;
+}
+
+bool ScaledDotProductAttentionFusion::CheckMaskShape(const AnfNodePtr &q, const AnfNodePtr &k,
+                                                     const AnfNodePtr &mask) const {
+  TypeId mask_type = kTypeUnknown;
+  if (GetDataTypeFromAnfNode(mask, &mask_type) != RET_OK || mask_type != kNumberTypeFloat32) {
+    return false;
+  }
+  ShapeVector q_shape;
+  ShapeVector k_shape;
+  ShapeVector mask_shape;
+  if (FetchShapeFromAbstract(q->abstract(), &q_shape) != lite::RET_OK ||
+      FetchShapeFromAbstract(k->abstract(), &k_shape) != lite::RET_OK ||
+      FetchShapeFromAbstract(mask->abstract(), &mask_shape) != lite::RET_OK) {
+    return false;
+  }
+  // the Add may broadcast the mask to the logits in any dim, while the kernel only broadcasts the leading dims, the
+  // last two dims of the mask must be [q_seq, kv_seq], e.g. a [B, 1, 1, kv_seq] padding mask can not be fused.
+  auto mask_rank = mask_shape.size();
+  if (mask_rank < DIMENSION_2D || mask_rank > q_shape.size()) {
+    return false;
+  }
+  if (mask_shape[mask_rank - DIMENSION_2D] != q_shape[q_shape.size() - DIMENSION_2D] ||
+      mask_shape[mask_rank - 1] != k_shape[k_shape.size() - DIMENSION_2D]) {
+    return false;
+  }
+  for (size_t i = DIMENSION_2D + 1; i <= mask_rank; ++i) {
+    auto mask_dim = mask_shape[mask_rank - i];
+    if (mask_dim != 1 && (mask_dim <= 0 || mask_dim != q_shape[q_shape.size() - i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+AnfNodePtr ScaledDotProductAttentionFusion::Process(const std::string &pattern_name, const FuncGraphPtr &func_graph,
+                                                    const AnfNodePtr &node, const EquivPtr &equiv) const {
+  if (func_graph == nullptr || node == nullptr || equiv == nullptr) {
+    return nullptr;
+  }
+  if (!utils::isa<CNodePtr>(node)) {
+    return nullptr;
+  }
+  bool with_scale = pattern_name == kAttentionWithScalePattern || pattern_name == kAttentionWithScaleMaskPattern;
+  bool with_mask = pattern_name == kAttentionWithMaskPattern || pattern_name == kAttentionWithScaleMaskPattern;
+  float scale = 1.0f;
+  if (!CheckAttentionNodes(func_graph, node->cast<CNodePtr>(), with_scale, with_mask, &scale)) {
+    return nullptr;
+  }
+  auto q = utils::cast<AnfNodePtr>((*equiv)[q_]);
+  auto k = utils::cast<AnfNodePtr>((*equiv)[k_]);
+  auto v = utils::cast<AnfNodePtr>((*equiv)[v_]);
+  MS_CHECK_TRUE_RET(q != nullptr && k != nullptr && v != nullptr, nullptr);
+  if (!CheckInputShapes(q, k, v)) {
+    return nullptr;
+  }
+  std::vector<AnfNodePtr> inputs = {q, k, v};
+  if (with_mask) {
+    auto mask = utils::cast<AnfNodePtr>((*equiv)[mask_]);
+    MS_CHECK_TRUE_RET(mask != nullptr, nullptr);
+    if (!CheckMaskShape(q, k, mask)) {
+      return nullptr;
+    }
+    inputs.push_back(mask);
+  }
+
+  auto attention_prim = std::make_shared<ops::ScaledDotProductAttention>();
+  MS_CHECK_TRUE_RET(attention_prim != nullptr, nullptr);
+  attention_prim->Init(scale, false);
+  auto attention_prim_c = attention_prim->GetPrim();
+  MS_CHECK_TRUE_RET(attention_prim_c != nullptr, nullptr);
+  auto attention_cnode = func_graph->NewCNode(attention_prim_c, inputs);
+  MS_CHECK_TRUE_RET(attention_cnode != nullptr, nullptr);
+  attention_cnode->set_fullname_with_scope(node->fullname_with_scope() + "_attention");
+  if (node->abstract() != nullptr) {
+    attention_cnode->set_abstract(node->abstract()->Clone());
+  }
+  MS_LOG(INFO) << "fuse " << pattern_name << " into " << attention_cnode->fullname_with_scope();
+  return attention_cnode;
+}
+}  // namespace mindspore::opt
@@ -0,0 +1,57 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_TOOLS_OPTIMIZER_FUSION_SCALED_DOT_PRODUCT_ATTENTION_FUSION_H_
+#define MINDSPORE_LITE_TOOLS_OPTIMIZER_FUSION_SCALED_DOT_PRODUCT_ATTENTION_FUSION_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "tools/optimizer/common/multiple_pattern_process_pass.h"
+
+namespace mindspore {
+namespace opt {
+/// \brief Fuse MatMul(Softmax(MatMul(q, k^T) * scale + mask), v) into ScaledDotProductAttention, the scale and the mask
+/// are optional.
+class ScaledDotProductAttentionFusion : public MultiplePatternProcessPass {
+ public:
+  explicit ScaledDotProductAttentionFusion(const std::string &name = "ScaledDotProductAttentionFusion",
+                                           bool multigraph = true)
+      : MultiplePatternProcessPass(name, multigraph) {}
+
+  ~ScaledDotProductAttentionFusion() override = default;
+
+ private:
+  bool Init() const;
+  std::unordered_map<std::string, VectorRef> DefinePatterns() const override;
+  VectorRef DefinePattern(bool with_scale, bool with_mask) const;
+  AnfNodePtr Process(const std::string &pattern_name, const FuncGraphPtr &, const AnfNodePtr &,
+                     const EquivPtr &) const override;
+  bool CheckAttentionNodes(const FuncGraphPtr &func_graph, const CNodePtr &cnode, bool with_scale, bool with_mask,
+                           float *scale) const;
+  bool CheckInputShapes(const AnfNodePtr &q, const AnfNodePtr &k, const AnfNodePtr &v) const;
+  bool CheckMaskShape(const AnfNodePtr &q, const AnfNodePtr &k, const AnfNodePtr &mask) const;
+
+ protected:
+  mutable VarPtr q_ = nullptr;
+  mutable VarPtr k_ = nullptr;
+  mutable VarPtr v_ = nullptr;
+  mutable VarPtr mask_ = nullptr;
+  mutable VarPtr scale_ = nullptr;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_LITE_TOOLS_OPTIMIZER_FUSION_SCALED_DOT_PRODUCT_ATTENTION_FUSION_H_
@@ -80,6 +80,10 @@ _set_ps_context_func_map = {
     "sign_global_lr": ps_context().set_sign_global_lr,
     "sign_dim_out": ps_context().set_sign_dim_out,
     "checkpoint_dir": ps_context().set_checkpoint_dir,
+    "consistency_mode": ps_context().set_consistency_mode,
+    "staleness_threshold": ps_context().set_staleness_threshold,
+    "push_compress_type": ps_context().set_push_compress_type,
+    "push_topk_ratio": ps_context().set_push_topk_ratio,
     "upload_compress_type": ps_context().set_upload_compress_type,
     "upload_sparse_rate": ps_context().set_upload_sparse_rate,
     "download_compress_type": ps_context().set_download_compress_type,
@@ -131,6 +135,10 @@ _get_ps_context_func_map = {
     "sign_global_lr": ps_context().sign_global_lr,
     "sign_dim_out": ps_context().sign_dim_out,
     "checkpoint_dir": ps_context().checkpoint_dir,
+    "consistency_mode": ps_context().consistency_mode,
+    "staleness_threshold": ps_context().staleness_threshold,
+    "push_compress_type": ps_context().push_compress_type,
+    "push_topk_ratio": ps_context().push_topk_ratio,
     "upload_compress_type": ps_context().upload_compress_type,
     "upload_sparse_rate": ps_context().upload_sparse_rate,
     "download_compress_type": ps_context().download_compress_type,
@@ -141,7 +149,7 @@ _check_positive_int_keys = ["server_num", "scheduler_port", "fl_server_port",
                             "fl_iteration_num", "client_epoch_num", "client_batch_size", "cipher_time_window",
                             "reconstruct_secrets_threshold"]
 
-_check_non_negative_int_keys = ["worker_num"]
+_check_non_negative_int_keys = ["worker_num", "staleness_threshold"]
 
 _check_positive_float_keys = ["update_model_ratio", "client_learning_rate"]
 
@@ -150,10 +158,13 @@ _check_port_keys = ["scheduler_port", "fl_server_port"]
 _check_string_keys = {
     "upload_compress_type": ["NO_COMPRESS", "DIFF_SPARSE_QUANT"],
     "download_compress_type": ["NO_COMPRESS", "QUANT"],
+    "consistency_mode": ["SYNC", "STALE_SYNC", "ASYNC"],
+    "push_compress_type": ["NO_COMPRESS", "FP16", "BF16", "TOP_K"],
 }
 
 _check_float_range_keys = {
     "upload_sparse_rate": {"lower_limit": 0.0, "upper_limit": 1.0, "rel": Rel.INC_RIGHT},
+    "push_topk_ratio": {"lower_limit": 0.0, "upper_limit": 1.0, "rel": Rel.INC_RIGHT},
 }
 
 def _get_ps_mode_rank():
@@ -192,6 +203,15 @@ def _set_ps_context(**kwargs):
         enable_ssl (bool): Set PS SSL mode enabled or disabled. Default: False.
         client_password (str): Password to decrypt the secret key stored in the client certificate. Default: ''.
         server_password (str): Password to decrypt the secret key stored in the server certificate. Default: ''.
+        consistency_mode (str): How the parameter servers apply the gradients pushed by workers. 'SYNC' applies them
+                                after all the workers pushed, 'STALE_SYNC' applies each push immediately but keeps
+                                the fastest worker at most `staleness_threshold` steps ahead of the slowest one, and
+                                'ASYNC' applies each push immediately without waiting. Default: 'SYNC'.
+        staleness_threshold (int): The max step gap between workers in 'STALE_SYNC' mode. Default: 0.
+        push_compress_type (str): The compression of the dense gradients pushed by workers, which could be
+                                  'NO_COMPRESS', 'FP16', 'BF16' and 'TOP_K'. The lossy compression error is added
+                                  back to the gradient of the next step. Default: 'NO_COMPRESS'.
+        push_topk_ratio (float): The ratio of the gradient elements pushed in 'TOP_K' mode. Default: 0.01.
 
     Raises:
         ValueError: If input key is not the attribute in parameter server training mode context.
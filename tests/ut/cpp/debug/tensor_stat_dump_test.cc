@@ -0,0 +1,179 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "debug/data_dump/tensor_stat_dump.h"
+#include "debug/debugger/tensor_summary.h"
+
+namespace mindspore {
+namespace {
+constexpr auto kHeader = "a,b\n";
+
+std::vector<std::string> ReadLines(const std::string &path) {
+  std::ifstream file(path);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(file, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+}  // namespace
+
+class TestTensorStatDump : public UT::Common {
+ public:
+  TestTensorStatDump() {}
+
+  void SetUp() override {
+    dir_ = "/tmp/tensor_stat_dump_test_" + std::to_string(getpid());
+    (void)mkdir(dir_.c_str(), S_IRWXU);
+  }
+
+  void TearDown() override {
+    for (const auto &file : {"first.csv", "second.csv", "fifo.csv", "rows.csv", "not_dir"}) {
+      auto path = dir_ + "/" + file;
+      (void)chmod(path.c_str(), S_IRWXU);
+      (void)unlink(path.c_str());
+    }
+    (void)rmdir(dir_.c_str());
+  }
+
+  std::string dir_;
+};
+
+/// Feature: Statistics dump writer.
+/// Description: queue the rows of two files with async flushes and closes in between, then wait for the writer.
+/// Expectation: the file operations run in the order they are queued, so each file has its header and all its rows.
+TEST_F(TestTensorStatDump, test_flush_and_close_order) {
+  auto first = dir_ + "/first.csv";
+  auto second = dir_ + "/second.csv";
+  CsvWriter writer;
+  writer.OpenFileAsync(first, kHeader);
+  for (int i = 0; i < 100; ++i) {
+    writer.WriteRowAsync(first, kHeader, std::to_string(i) + ",first");
+  }
+  writer.FlushAsync();
+  writer.WriteRowAsync(first, kHeader, "100,first");
+  writer.CloseFileAsync();
+  for (int i = 0; i < 10; ++i) {
+    writer.WriteRowAsync(second, kHeader, std::to_string(i) + ",second");
+  }
+  ASSERT_TRUE(writer.Flush());
+  // the second file is still open but all its rows have been flushed.
+  auto second_lines = ReadLines(second);
+  ASSERT_EQ(second_lines.size(), 11U);
+  ASSERT_TRUE(writer.CloseFile());
+
+  auto first_lines = ReadLines(first);
+  ASSERT_EQ(first_lines.size(), 102U);
+  EXPECT_EQ(first_lines[0], "a,b");
+  for (int i = 0; i <= 100; ++i) {
+    EXPECT_EQ(first_lines[i + 1], std::to_string(i) + ",first");
+  }
+  EXPECT_EQ(second_lines[0], "a,b");
+  EXPECT_EQ(second_lines[10], "9,second");
+}
+
+/// Feature: Statistics dump writer.
+/// Description: write a row to a path whose directory is a regular file, then flush twice.
+/// Expectation: the first flush reports the failed row, the second one starts over and succeeds.
+TEST_F(TestTensorStatDump, test_flush_reports_failure) {
+  auto not_dir = dir_ + "/not_dir";
+  std::ofstream(not_dir) << "x";
+  CsvWriter writer;
+  writer.WriteRowAsync(not_dir + "/statistic.csv", kHeader, "0,0");
+  EXPECT_FALSE(writer.Flush());
+  EXPECT_TRUE(writer.Flush());
+}
+
+/// Feature: Statistics dump writer.
+/// Description: stall the writer thread on opening a fifo nobody reads, and queue rows from another thread.
+/// Expectation: the producer blocks once the queue is full, and goes on once the writer thread drains the queue.
+TEST_F(TestTensorStatDump, test_bounded_queue) {
+  constexpr size_t kMaxPending = 4;
+  constexpr size_t kRowNum = 20;
+  auto fifo = dir_ + "/fifo.csv";
+  ASSERT_EQ(mkfifo(fifo.c_str(), S_IRUSR | S_IWUSR), 0);
+  CsvWriter writer(kMaxPending);
+  writer.OpenFileAsync(fifo, kHeader);
+  std::atomic<size_t> queued{0};
+  std::thread producer([&writer, &queued, this]() {
+    for (size_t i = 0; i < kRowNum; ++i) {
+      writer.WriteRowAsync(dir_ + "/rows.csv", kHeader, std::to_string(i) + ",row");
+      ++queued;
+    }
+  });
+  // the writer thread is blocked in opening the fifo, so the producer can only fill the queue.
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (queued < kMaxPending && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(queued.load(), kMaxPending);
+  EXPECT_EQ(writer.pending_tasks(), kMaxPending);
+
+  // read the fifo to let the writer thread go on, the writer made it write only before it blocked in opening it.
+  ASSERT_EQ(chmod(fifo.c_str(), S_IRUSR | S_IWUSR), 0);
+  int fd = open(fifo.c_str(), O_RDONLY);
+  ASSERT_GE(fd, 0);
+  producer.join();
+  EXPECT_EQ(queued.load(), kRowNum);
+  ASSERT_TRUE(writer.CloseFile());
+  std::string content(64, '\0');
+  auto size = read(fd, &content[0], content.size());
+  (void)close(fd);
+  EXPECT_EQ(std::string(content.data(), size > 0 ? size : 0), kHeader);
+  auto lines = ReadLines(dir_ + "/rows.csv");
+  ASSERT_EQ(lines.size(), kRowNum + 1);
+  EXPECT_EQ(lines[kRowNum], std::to_string(kRowNum - 1) + ",row");
+}
+
+/// Feature: Tensor statistics.
+/// Description: summarize a small tensor with nan and inf, and a tensor large enough to be chunked over threads.
+/// Expectation: the l2 norm only counts the finite elements, and the chunks add up to the norm of the whole tensor.
+TEST_F(TestTensorStatDump, test_l2_norm) {
+  std::vector<float> small = {3.0f, -4.0f, std::numeric_limits<float>::quiet_NaN(),
+                              std::numeric_limits<float>::infinity(), 0.0f};
+  TensorSummary<float> small_summary(small.data(), nullptr, small.size(), 0);
+  small_summary.TensorStatistics(DbgDataType::DT_FLOAT32);
+  EXPECT_DOUBLE_EQ(small_summary.l2_norm_value(), 5.0);
+  EXPECT_EQ(small_summary.nan_count(), 1U);
+  EXPECT_EQ(small_summary.pos_inf_count(), 1U);
+
+  constexpr size_t kLargeSize = 100000;
+  std::vector<float> large(kLargeSize);
+  double square_sum = 0.0;
+  for (size_t i = 0; i < kLargeSize; ++i) {
+    large[i] = static_cast<float>(static_cast<int>(i % 7) - 3);
+    square_sum += static_cast<double>(large[i]) * large[i];
+  }
+  TensorSummary<float> large_summary(large.data(), nullptr, large.size(), 0);
+  large_summary.TensorStatistics(DbgDataType::DT_FLOAT32);
+  EXPECT_DOUBLE_EQ(large_summary.l2_norm_value(), std::sqrt(square_sum));
+  EXPECT_EQ(large_summary.count(), kLargeSize);
+}
+}  // namespace mindspore
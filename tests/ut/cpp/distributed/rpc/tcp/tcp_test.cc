@@ -19,6 +19,7 @@
 #include <dirent.h>
 #include <atomic>
 #include <string>
+#include <vector>
 #include <thread>
 #include <csignal>
 
@@ -226,6 +227,65 @@ TEST_F(TCPTest, SendTwoMessages) {
   server->Finalize();
 }
 
+/// Feature: test sending a message whose body is an external buffer.
+/// Description: send a message built from an external buffer to a server which registers its receiving buffer.
+/// Expectation: the body is received into the registered buffer and both buffers are released after use.
+TEST_F(TCPTest, SendExternalDataMessage) {
+  Init();
+
+  // Start the tcp server with the receiving buffer callbacks.
+  auto server_url = "127.0.0.1:8081";
+  std::unique_ptr<TCPServer> server = std::make_unique<TCPServer>();
+  bool ret = server->Initialize(server_url);
+  ASSERT_TRUE(ret);
+
+  const size_t data_size = 1024;
+  std::vector<char> recv_buffer(data_size);
+  std::atomic<bool> recv_buffer_released(false);
+  server->SetRecvBufferCallback([&recv_buffer](size_t size) -> void * { return recv_buffer.data(); },
+                                [&recv_buffer_released](void *, size_t) { recv_buffer_released = true; });
+  std::atomic<bool> body_checked(false);
+  server->SetMessageHandler([&recv_buffer, &body_checked](MessageBase *const message) -> MessageBase *const {
+    body_checked = message->HasExternalData() && message->external_data == recv_buffer.data() &&
+                   message->external_size == recv_buffer.size() && recv_buffer.front() == 'B' &&
+                   recv_buffer.back() == 'B';
+    delete message;
+    IncrDataMsgNum(1);
+    return NULL_MSG;
+  });
+
+  // Start the tcp client.
+  auto client_url = "127.0.0.1:1234";
+  std::unique_ptr<TCPClient> client = std::make_unique<TCPClient>();
+  ret = client->Initialize();
+  ASSERT_TRUE(ret);
+
+  // Create the message which is sent from the external buffer.
+  std::vector<char> send_buffer(data_size, 'B');
+  std::atomic<bool> send_buffer_released(false);
+  auto message = CreateMessage(server_url, client_url, 0);
+  message->SetExternalData(send_buffer.data(), send_buffer.size(),
+                           [&send_buffer_released](void *, size_t) { send_buffer_released = true; });
+
+  // Send the message.
+  client->Connect(server_url);
+  client->SendAsync(std::move(message));
+
+  // Wait timeout: 5s
+  WaitForDataMsg(1, 5);
+
+  // Check result
+  EXPECT_EQ(1, GetDataMsgNum());
+  EXPECT_TRUE(body_checked);
+  EXPECT_TRUE(recv_buffer_released);
+  EXPECT_TRUE(send_buffer_released);
+
+  // Destroy
+  client->Disconnect(server_url);
+  client->Finalize();
+  server->Finalize();
+}
+
 /// Feature: test start the tcp server with random port.
 /// Description: start a socket server without specified fixed port.
 /// Expectation: the server started successfully.
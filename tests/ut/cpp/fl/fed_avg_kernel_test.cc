@@ -0,0 +1,153 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <random>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "fl/server/kernel/fed_avg_kernel.h"
+
+namespace mindspore {
+namespace fl {
+namespace server {
+namespace kernel {
+class TestFedAvgKernel : public UT::Common {
+ public:
+  TestFedAvgKernel() = default;
+  virtual ~TestFedAvgKernel() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+namespace {
+// The uploads of the clients, which are multiplied by their data sizes already.
+std::vector<std::vector<float>> GenerateUploads(const std::vector<size_t> &data_sizes, size_t elem_num) {
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<float> dist(-1.0, 1.0);
+  std::vector<std::vector<float>> uploads;
+  for (auto data_size : data_sizes) {
+    std::vector<float> upload(elem_num);
+    for (auto &value : upload) {
+      value = dist(gen) * data_size;
+    }
+    uploads.push_back(upload);
+  }
+  return uploads;
+}
+
+// The weighted average which sums the uploads one by one.
+std::vector<float> ReferenceAverage(const std::vector<std::vector<float>> &uploads,
+                                    const std::vector<size_t> &data_sizes, size_t elem_num) {
+  std::vector<float> weight(elem_num, 0);
+  size_t total_data_size = 0;
+  for (size_t i = 0; i < uploads.size(); i++) {
+    for (size_t j = 0; j < elem_num; j++) {
+      weight[j] += uploads[i][j];
+    }
+    total_data_size += data_sizes[i];
+  }
+  for (auto &value : weight) {
+    value /= total_data_size;
+  }
+  return weight;
+}
+
+// The weighted average which accumulates the uploads on weight shards concurrently.
+std::vector<float> ShardAverage(const std::vector<std::vector<float>> &uploads, const std::vector<size_t> &data_sizes,
+                                size_t elem_num) {
+  WeightShardAccumulator<float> accumulator;
+  accumulator.Init(elem_num);
+  std::vector<float> weight(elem_num, 0);
+  std::vector<std::thread> threads;
+  for (const auto &upload : uploads) {
+    threads.emplace_back([&accumulator, &weight, &upload, elem_num]() {
+      EXPECT_TRUE(accumulator.Accumulate(weight.data(), upload.data(), elem_num));
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  size_t total_data_size = 0;
+  for (auto data_size : data_sizes) {
+    total_data_size += data_size;
+  }
+  for (auto &value : weight) {
+    value /= total_data_size;
+  }
+  return weight;
+}
+
+void ExpectNear(const std::vector<float> &actual, const std::vector<float> &expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); i++) {
+    ASSERT_NEAR(actual[i], expected[i], 1e-5) << "index " << i;
+  }
+}
+}  // namespace
+
+/// Feature: federated average aggregation.
+/// Description: accumulate the uploads of several clients on weight shards concurrently.
+/// Expectation: the average is the same as the weighted average which sums the uploads one by one.
+TEST_F(TestFedAvgKernel, ShardAccumulateMultiClients) {
+  constexpr size_t kElemNum = kFedAvgShardElemNum * 3 + 7;
+  std::vector<size_t> data_sizes = {3, 10, 1, 7, 20, 2, 5, 8};
+  auto uploads = GenerateUploads(data_sizes, kElemNum);
+  ExpectNear(ShardAverage(uploads, data_sizes, kElemNum), ReferenceAverage(uploads, data_sizes, kElemNum));
+}
+
+/// Feature: federated average aggregation.
+/// Description: accumulate the uploads with a client whose data size is 0.
+/// Expectation: the client with zero weight doesn't change the average.
+TEST_F(TestFedAvgKernel, ShardAccumulateZeroWeight) {
+  constexpr size_t kElemNum = kFedAvgShardElemNum + 1;
+  std::vector<size_t> data_sizes = {4, 0, 6};
+  auto uploads = GenerateUploads(data_sizes, kElemNum);
+  auto average = ShardAverage(uploads, data_sizes, kElemNum);
+  ExpectNear(average, ReferenceAverage(uploads, data_sizes, kElemNum));
+
+  std::vector<std::vector<float>> non_zero_uploads = {uploads[0], uploads[2]};
+  ExpectNear(average, ReferenceAverage(non_zero_uploads, {4, 6}, kElemNum));
+}
+
+/// Feature: federated average aggregation.
+/// Description: accumulate the upload of a single client.
+/// Expectation: the average is the weight of the client.
+TEST_F(TestFedAvgKernel, ShardAccumulateSingleClient) {
+  constexpr size_t kElemNum = 100;
+  std::vector<size_t> data_sizes = {5};
+  auto uploads = GenerateUploads(data_sizes, kElemNum);
+  std::vector<float> client_weight(uploads[0]);
+  for (auto &value : client_weight) {
+    value /= data_sizes[0];
+  }
+  ExpectNear(ShardAverage(uploads, data_sizes, kElemNum), client_weight);
+}
+
+/// Feature: federated average aggregation.
+/// Description: accumulate an upload which is larger than the weight.
+/// Expectation: accumulating fails.
+TEST_F(TestFedAvgKernel, ShardAccumulateOversizedUpload) {
+  WeightShardAccumulator<float> accumulator;
+  accumulator.Init(kFedAvgShardElemNum);
+  std::vector<float> weight(kFedAvgShardElemNum + 1, 0);
+  std::vector<float> upload(kFedAvgShardElemNum + 1, 1);
+  EXPECT_FALSE(accumulator.Accumulate(weight.data(), upload.data(), upload.size()));
+}
+}  // namespace kernel
+}  // namespace server
+}  // namespace fl
+}  // namespace mindspore
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <set>
 
 #include "common/common_test.h"
 #include "common/py_func_graph_fetcher.h"
@@ -274,4 +275,47 @@ TEST_F(TestCloner, test_clone_total) {
   ASSERT_TRUE(idx0.GetFirstFuncGraph("clone_total_sub") == idx2.GetFirstFuncGraph("clone_total_sub"));
 }
 
+/// Feature: clone several graphs in parallel.
+/// Description: clone the independent graphs on 4 threads, one of which is managed and is cloned alone.
+/// Expectation: every clone has the same structure as its graph, and the cloned nodes get unique debug ids.
+TEST_F(TestCloner, test_parallel_basic_clone) {
+  constexpr size_t kGraphNum = 32;
+  constexpr size_t kNodeNum = 200;
+  FuncGraphVector gs;
+  for (size_t i = 0; i < kGraphNum; ++i) {
+    auto fg = std::make_shared<FuncGraph>();
+    auto x = fg->add_parameter();
+    AnfNodePtr node = x;
+    for (size_t j = 0; j < kNodeNum; ++j) {
+      node = fg->NewCNode({NewValueNode(prim::kPrimScalarAdd), node, x});
+    }
+    fg->set_output(node);
+    (void)gs.emplace_back(fg);
+  }
+  auto manager = Manage(gs.back(), true);
+
+  auto clones = ParallelBasicClone(gs, false, 4);
+  ASSERT_EQ(clones.size(), kGraphNum);
+  std::set<int64_t> unique_ids;
+  for (size_t i = 0; i < kGraphNum; ++i) {
+    auto fg2 = clones[i];
+    ASSERT_TRUE(fg2 != nullptr);
+    ASSERT_TRUE(fg2 != gs[i]);
+    ASSERT_EQ(fg2->parameters().size(), (size_t)1);
+    auto x2 = fg2->parameters()[0];
+    auto new_node = fg2->output();
+    for (size_t j = 0; j < kNodeNum; ++j) {
+      auto cnode = new_node->cast<CNodePtr>();
+      ASSERT_TRUE(cnode != nullptr);
+      ASSERT_EQ(cnode->size(), (size_t)3);
+      ASSERT_EQ(cnode->func_graph(), fg2);
+      ASSERT_EQ(cnode->input(2), x2);
+      (void)unique_ids.insert(cnode->debug_info()->unique_id());
+      new_node = cnode->input(1);
+    }
+    ASSERT_EQ(new_node, x2);
+  }
+  ASSERT_EQ(unique_ids.size(), kGraphNum * kNodeNum);
+}
+
 }  // namespace mindspore
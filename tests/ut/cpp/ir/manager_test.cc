@@ -762,4 +762,51 @@ TEST_F(TestManager, test_set_edge) {
   ASSERT_EQ(mgr->node_users()[t].front().first, get_item);
 }
 
+TEST_F(TestManager, test_free_variable_change) {
+  // fg(x):
+  //    return g(x)
+  // g(y):
+  //    return scalar_add(x, y)
+  FuncGraphPtr fg = std::make_shared<FuncGraph>();
+  auto x = fg->add_parameter();
+  FuncGraphPtr g = std::make_shared<FuncGraph>();
+  auto y = g->add_parameter();
+  auto add = g->NewCNode({NewValueNode(prim::kPrimScalarAdd), x, y});
+  g->set_output(add);
+  auto call = fg->NewCNode({NewValueNode(g), x});
+  fg->set_output(call);
+
+  // Create manager.
+  auto mgr = Manage(fg);
+  ASSERT_NE(mgr, nullptr);
+  ASSERT_EQ(mgr->parent(g), fg);
+  ASSERT_TRUE(mgr->children(fg).contains(g));
+  ASSERT_TRUE(mgr->func_graphs_used_total(fg).contains(g));
+  // a graph nobody uses, it stays in the analysis only as long as the analysis is not recomputed.
+  auto sentinel = std::make_shared<FuncGraph>();
+  (void)mgr->func_graphs_used_total(fg).insert(sentinel);
+
+  // g doesn't use the free variable x after SetEdge, and the graphs used are not changed.
+  mgr->SetEdge(add, 1, y);
+  ASSERT_EQ(mgr->parent(g), nullptr);
+  ASSERT_TRUE(mgr->children(fg).empty());
+  ASSERT_TRUE(mgr->func_graphs_used_total(fg).contains(g));
+  ASSERT_TRUE(mgr->func_graphs_used_total(fg).contains(sentinel));
+  ASSERT_FALSE(mgr->recursive(fg));
+
+  // g uses the free variable x again.
+  mgr->SetEdge(add, 2, x);
+  ASSERT_EQ(mgr->parent(g), fg);
+  ASSERT_TRUE(mgr->children(fg).contains(g));
+  ASSERT_TRUE(mgr->func_graphs_used_total(fg).contains(sentinel));
+
+  // fg calls h instead of g, which changes the graphs used and recomputes the analysis.
+  FuncGraphPtr h = std::make_shared<FuncGraph>();
+  h->set_output(h->add_parameter());
+  mgr->SetEdge(call, 0, NewValueNode(h));
+  ASSERT_TRUE(mgr->func_graphs_used_total(fg).contains(h));
+  ASSERT_FALSE(mgr->func_graphs_used_total(fg).contains(g));
+  ASSERT_FALSE(mgr->func_graphs_used_total(fg).contains(sentinel));
+}
+
 }  // namespace mindspore
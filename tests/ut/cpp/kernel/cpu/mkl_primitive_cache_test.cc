@@ -0,0 +1,145 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "plugin/device/cpu/kernel/mkldnn/mkl_cpu_kernel.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr int64_t kM = 2;
+constexpr int64_t kK = 3;
+constexpr int64_t kN = 2;
+constexpr float kOutputScale = 2.0f;
+
+// a [kM, kK] x [kK, kN] MatMul with the given attr, whose primitive comes from the process-wide cache.
+class MatMulTestKernelMod : public MKLCpuKernelMod {
+ public:
+  MatMulTestKernelMod() = default;
+  ~MatMulTestKernelMod() override = default;
+
+  void InitKernel(const CNodePtr &) override {}
+
+  void InitPrimitive(const dnnl::primitive_attr &attr) {
+    auto src_md = formatted_md({kM, kK}, dnnl::memory::format_tag::ab);
+    auto weights_md = formatted_md({kK, kN}, dnnl::memory::format_tag::ab);
+    auto dst_md = formatted_md({kM, kN}, dnnl::memory::format_tag::ab);
+    auto desc = CreateDesc<dnnl::matmul::desc>(src_md, weights_md, dst_md);
+    (void)CreateCachedPrimitive<dnnl::matmul>(desc, attr, &primitive_);
+    AddArgument(DNNL_ARG_SRC, src_md);
+    AddArgument(DNNL_ARG_WEIGHTS, weights_md);
+    AddArgument(DNNL_ARG_DST, dst_md);
+  }
+
+  bool Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &,
+              const std::vector<AddressPtr> &outputs) override {
+    SetArgumentHandle(DNNL_ARG_SRC, inputs[0]->addr);
+    SetArgumentHandle(DNNL_ARG_WEIGHTS, inputs[1]->addr);
+    SetArgumentHandle(DNNL_ARG_DST, outputs[0]->addr);
+    ExecutePrimitive();
+    return true;
+  }
+
+  const std::shared_ptr<dnnl::primitive> &primitive() const { return primitive_; }
+};
+
+dnnl::primitive_attr ReluAttr() {
+  dnnl::post_ops post_ops;
+  post_ops.append_eltwise(1.0f, dnnl::algorithm::eltwise_relu, 0.0f, 0.0f);
+  dnnl::primitive_attr attr;
+  attr.set_post_ops(post_ops);
+  return attr;
+}
+
+dnnl::primitive_attr ScaleAttr() {
+  dnnl::primitive_attr attr;
+  attr.set_output_scales(0, {kOutputScale});
+  return attr;
+}
+}  // namespace
+
+class MKLPrimitiveCacheTest : public UT::Common {
+ public:
+  MKLPrimitiveCacheTest() = default;
+
+  void SetUp() override { MKLPrimitiveCache::GetInstance().Clear(); }
+
+  void TearDown() override { MKLPrimitiveCache::GetInstance().Clear(); }
+
+  AddressPtr CreateKernelAddress(void *addr, size_t size) {
+    auto kernel_addr = std::make_shared<Address>();
+    kernel_addr->addr = addr;
+    kernel_addr->size = size;
+    return kernel_addr;
+  }
+
+  std::vector<float> Run(const std::shared_ptr<MatMulTestKernelMod> &kernel) {
+    std::vector<float> y(kM * kN, 0.0f);
+    std::vector<AddressPtr> inputs = {CreateKernelAddress(x_.data(), x_.size() * sizeof(float)),
+                                      CreateKernelAddress(w_.data(), w_.size() * sizeof(float))};
+    std::vector<AddressPtr> outputs = {CreateKernelAddress(y.data(), y.size() * sizeof(float))};
+    (void)kernel->Launch(inputs, {}, outputs);
+    return y;
+  }
+
+  std::vector<float> x_ = {1, -2, 3, -4, 5, -6};
+  std::vector<float> w_ = {1, 2, 3, 4, 5, 6};
+  // x * w = {10, 12, -19, -24}
+  std::vector<float> expect_relu_ = {10, 12, 0, 0};
+  std::vector<float> expect_scale_ = {20, 24, -38, -48};
+};
+
+/// Feature: the process-wide cache of the onednn primitives.
+/// Description: two MatMul kernels with the same op descriptor but different attrs, one with a relu post op and the
+/// other with output scales, then a third kernel with the relu post op.
+/// Expectation: the attrs are keyed apart so each kernel gets its own primitive and output, and the third kernel hits
+/// the cached relu primitive.
+TEST_F(MKLPrimitiveCacheTest, DifferentAttrs) {
+  auto &cache = MKLPrimitiveCache::GetInstance();
+  auto relu_kernel = std::make_shared<MatMulTestKernelMod>();
+  relu_kernel->InitPrimitive(ReluAttr());
+  auto scale_kernel = std::make_shared<MatMulTestKernelMod>();
+  scale_kernel->InitPrimitive(ScaleAttr());
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_NE(relu_kernel->primitive(), scale_kernel->primitive());
+
+  auto another_relu_kernel = std::make_shared<MatMulTestKernelMod>();
+  another_relu_kernel->InitPrimitive(ReluAttr());
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(another_relu_kernel->primitive(), relu_kernel->primitive());
+
+  EXPECT_EQ(Run(relu_kernel), expect_relu_);
+  EXPECT_EQ(Run(scale_kernel), expect_scale_);
+  EXPECT_EQ(Run(another_relu_kernel), expect_relu_);
+}
+
+/// Feature: the process-wide cache of the onednn primitives.
+/// Description: key an attr that has a depthwise convolution post op.
+/// Expectation: the post op can not be keyed, so the key is empty and the primitive will not be cached.
+TEST_F(MKLPrimitiveCacheTest, UnknownPostOpNotCached) {
+  dnnl::post_ops post_ops;
+  post_ops.append_dw_k3s1p1(dnnl::memory::data_type::f32, dnnl::memory::data_type::f32, dnnl::memory::data_type::f32,
+                            0, {});
+  dnnl::primitive_attr attr;
+  attr.set_post_ops(post_ops);
+  std::string key = PrimitiveCacheKey(attr);
+  EXPECT_TRUE(key.empty());
+}
+}  // namespace kernel
+}  // namespace mindspore
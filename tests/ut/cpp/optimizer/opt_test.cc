@@ -161,6 +161,19 @@ TEST_F(TestOptOpt, ElimR) {
   ASSERT_TRUE(CheckOpt(before, after, std::vector<SubstitutionPtr>({elim_R})));
 }
 
+/// Feature: primitive indexed substitution dispatch.
+/// Description: substitutions of other primitives are listed before the matching one.
+/// Expectation: the substitution of the node's primitive is still applied.
+TEST_F(TestOptOpt, ElimRWithOtherPrimSubstitutions) {
+  FuncGraphPtr before = getPyFun.CallAndParseRet("test_elim_r", "before_1");
+  FuncGraphPtr after = getPyFun.CallAndParseRet("test_elim_r", "after");
+
+  ASSERT_TRUE(nullptr != before);
+  ASSERT_TRUE(nullptr != after);
+  ASSERT_EQ(elim_R->prims_.size(), 1);
+  ASSERT_TRUE(CheckOpt(before, after, std::vector<SubstitutionPtr>({elim_Z, idempotent_P, Qct_to_P, elim_R})));
+}
+
 TEST_F(TestOptOpt, idempotent) {
   FuncGraphPtr before_2 = getPyFun.CallAndParseRet("test_idempotent", "before_2");
   FuncGraphPtr before_1 = getPyFun.CallAndParseRet("test_idempotent", "before_1");
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <cstdint>
+#include <iterator>
 #include "common/common_test.h"
 #include "ir/dtype/number.h"
 #include "frontend/parallel/device_manager.h"
@@ -115,6 +117,85 @@ TEST_F(TestEdgeCostModel, test_InitEdgeCost) {
   ASSERT_EQ(edge_m1_m2->InitEdgeCost(), SUCCESS);
 }
 
+namespace {
+void ExpectSameCost(const CostPtr &expect, const CostPtr &actual) {
+  ASSERT_NE(expect, nullptr);
+  ASSERT_NE(actual, nullptr);
+  EXPECT_DOUBLE_EQ(expect->computation_cost_, actual->computation_cost_);
+  EXPECT_DOUBLE_EQ(expect->communication_cost_, actual->communication_cost_);
+  EXPECT_DOUBLE_EQ(expect->communication_without_parameter_, actual->communication_without_parameter_);
+  EXPECT_DOUBLE_EQ(expect->communication_with_partial_para_, actual->communication_with_partial_para_);
+  EXPECT_DOUBLE_EQ(expect->communication_forward_, actual->communication_forward_);
+  EXPECT_DOUBLE_EQ(expect->memory_with_reuse_, actual->memory_with_reuse_);
+}
+}  // namespace
+
+/// Feature: Redistribution costs of the edges in auto parallel.
+/// Description: compute the costs of an edge serially and on the thread pool, and compute each strategy pair
+/// directly without deduplicating the layouts.
+/// Expectation: every strategy pair gets its own cost, and the three ways produce the same cost lists.
+TEST_F(TestEdgeCostModel, test_InitEdgeCostParallel) {
+  matmul1->GenerateStrategies(0);
+  matmul2->GenerateStrategies(0);
+  std::shared_ptr<Edge> serial_edge = std::make_shared<Edge>("MatMul-MatMul", matmul1, matmul2, 0, 0, false);
+  serial_edge->set_parallel_cost_threshold(SIZE_MAX);
+  ASSERT_EQ(serial_edge->InitEdgeCost(), SUCCESS);
+  std::shared_ptr<Edge> parallel_edge = std::make_shared<Edge>("MatMul-MatMul", matmul1, matmul2, 0, 0, false);
+  parallel_edge->set_parallel_cost_threshold(0);
+  ASSERT_EQ(parallel_edge->InitEdgeCost(), SUCCESS);
+
+  auto serial_costs = serial_edge->GetCostMap();
+  auto parallel_costs = parallel_edge->GetCostMap();
+  auto prev_output = serial_edge->prev_op_output();
+  auto next_input = serial_edge->next_op_input();
+  ASSERT_GT(prev_output.size(), 1U);
+  ASSERT_GT(next_input.size(), 1U);
+  ASSERT_EQ(serial_costs.size(), prev_output.size() * next_input.size());
+  ASSERT_EQ(parallel_costs.size(), serial_costs.size());
+  auto type = matmul1->outputs_type()[0];
+  auto type_length = matmul1->GetOutputTypeLengths()[0];
+  for (const auto &output : prev_output) {
+    for (const auto &input : next_input) {
+      CostPtrKey key = {output.first, input.first};
+      ASSERT_EQ(serial_costs[key].size(), 1U);
+      ASSERT_EQ(parallel_costs[key].size(), 1U);
+      CostPtr expect;
+      ASSERT_EQ(serial_edge->GetRedistributionCost(output.second[0].tensor_layout(), input.second[0].tensor_layout(),
+                                                   type_length, type, &expect),
+                SUCCESS);
+      RefineForPracticalCost(expect, true);
+      expect->communication_forward_ = expect->communication_redis_forward_;
+      ExpectSameCost(expect, serial_costs[key][0]);
+      ExpectSameCost(expect, parallel_costs[key][0]);
+    }
+  }
+  // the pairs share the computation of equal layouts, but each one owns its cost object which is modified later.
+  ASSERT_NE(serial_costs.begin()->second[0], std::next(serial_costs.begin())->second[0]);
+}
+
+/// Feature: Redistribution costs of the edges in auto parallel.
+/// Description: connect a 3-D output to a 2-D input, so that the redistribution cost fails on the thread pool.
+/// Expectation: the exception raised in the workers is rethrown to the caller, and a later edge is computed well.
+TEST_F(TestEdgeCostModel, test_InitEdgeCostParallelException) {
+  ValuePtr transpose_a = MakeValue(false);
+  ValuePtr transpose_b = MakeValue(false);
+  mindspore::HashMap<std::string, ValuePtr> attr = {{"transpose_a", transpose_a}, {"transpose_b", transpose_b}};
+  Shapes inputs_shape = {{2, 8, 16}, {2, 16, 32}};
+  Shapes outputs_shape = {{2, 8, 32}};
+  auto batch_matmul = std::make_shared<MatMulInfo>("matmul_info", inputs_shape, outputs_shape, attr);
+  batch_matmul->set_outputs_type({kFloat32});
+  batch_matmul->GenerateStrategies(0);
+  matmul1->GenerateStrategies(0);
+  matmul2->GenerateStrategies(0);
+  std::shared_ptr<Edge> bad_edge = std::make_shared<Edge>("MatMul-MatMul", batch_matmul, matmul2, 0, 0, false);
+  bad_edge->set_parallel_cost_threshold(0);
+  EXPECT_ANY_THROW(bad_edge->InitEdgeCost());
+
+  std::shared_ptr<Edge> edge = std::make_shared<Edge>("MatMul-MatMul", matmul1, matmul2, 0, 0, false);
+  edge->set_parallel_cost_threshold(0);
+  ASSERT_EQ(edge->InitEdgeCost(), SUCCESS);
+}
+
 TEST_F(TestEdgeCostModel, test_OpEliminationSetNewCost) {
   std::string edge_name = "MatMul-MatMul";
   std::shared_ptr<Edge> edge_m1_m2 = std::make_shared<Edge>(edge_name, matmul1, matmul2, 0, 0, false);
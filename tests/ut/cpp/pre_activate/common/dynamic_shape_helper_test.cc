@@ -0,0 +1,136 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/backend_common_test.h"
+#include "backend/common/optimizer/dynamic_shape/dynamic_shape_helper.h"
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "include/common/utils/anfalgo.h"
+#include "include/common/utils/utils.h"
+#include "kernel/kernel.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+// a kernel mod which only reports its type, the helper never launches it.
+class TestKernelMod : public kernel::KernelMod {
+ public:
+  TestKernelMod(kernel::KernelModType type, bool is_compute_depend) : type_(type) {
+    is_need_retrieve_output_shape = is_compute_depend;
+  }
+  ~TestKernelMod() override = default;
+
+  bool Launch(const std::vector<kernel::AddressPtr> &, const std::vector<kernel::AddressPtr> &,
+              const std::vector<kernel::AddressPtr> &, void *) override {
+    return true;
+  }
+  kernel::KernelModType GetKernelModType() const override { return type_; }
+
+ private:
+  kernel::KernelModType type_;
+};
+
+abstract::AbstractTensorPtr TestCreateTensor(const ShapeVector &shape) {
+  return std::make_shared<abstract::AbstractTensor>(kFloat32, shape);
+}
+}  // namespace
+
+class TestDynamicShapeHelper : public BackendCommon {
+ public:
+  TestDynamicShapeHelper() {}
+  ~TestDynamicShapeHelper() override = default;
+
+  // p -> Abs(p), the Abs is marked dynamic shape and has the kernel mod.
+  CNodePtr CreateAbs(const kernel::KernelModPtr &kernel_mod) {
+    graph_ = std::make_shared<session::KernelGraph>();
+    param_ = graph_->AddWeightParameter("p");
+    param_->set_abstract(TestCreateTensor({2, 3}));
+    param_->set_kernel_info(std::make_shared<device::KernelInfo>());
+    auto abs = graph_->NewCNode({NewValueNode(std::make_shared<Primitive>(prim::kPrimAbs->name())), param_});
+    MS_EXCEPTION_IF_NULL(abs);
+    abs->set_abstract(TestCreateTensor({-1, 3}));
+    common::AnfAlgo::SetNodeAttr(kAttrInputIsDynamicShape, MakeValue(true), abs);
+    auto kernel_info = std::make_shared<device::KernelInfo>();
+    kernel_info->set_kernel_mod(kernel_mod);
+    abs->set_kernel_info(kernel_info);
+    graph_->set_output(abs);
+    return abs;
+  }
+
+  // run the infer of the node with the parameter in the given shape, and return the inferred shape.
+  std::vector<size_t> InferWithInput(const CNodePtr &node, const ShapeVector &input_shape) {
+    param_->set_abstract(TestCreateTensor(input_shape));
+    dynamic_shape::InferOp(node);
+    return common::AnfAlgo::GetOutputInferShape(node, 0);
+  }
+
+  KernelGraphPtr graph_;
+  ParameterPtr param_;
+};
+
+/// Feature: Dynamic shape infer cache.
+/// Description: infer a dynamic shape Abs with the input shapes A, B and then A again.
+/// Expectation: A and B miss the cache, the second A hits it and gets the same output shape as the first one.
+TEST_F(TestDynamicShapeHelper, test_infer_shape_cache_hit_and_miss) {
+  // the native kernel mods build their args from the operator, which the test kernel mod doesn't have.
+  auto kernel_mod = std::make_shared<TestKernelMod>(kernel::KernelModType::KernelMod, false);
+  auto abs = CreateAbs(kernel_mod);
+  auto shape_a = InferWithInput(abs, {2, 3});
+  auto cache = abs->user_data<dynamic_shape::InferShapeCache>();
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(cache->miss_count(), 1);
+  EXPECT_EQ(cache->hit_count(), 0);
+
+  auto shape_b = InferWithInput(abs, {4, 3});
+  EXPECT_EQ(cache->miss_count(), 2);
+  EXPECT_EQ(cache->hit_count(), 0);
+  EXPECT_NE(shape_a, shape_b);
+
+  EXPECT_EQ(InferWithInput(abs, {2, 3}), shape_a);
+  EXPECT_EQ(cache->miss_count(), 2);
+  EXPECT_EQ(cache->hit_count(), 1);
+}
+
+/// Feature: Dynamic shape resize skip.
+/// Description: mark the kernel mod of a node resized, then check it with the same and with another input key.
+/// Expectation: Resize is skipped only for the same key and only for the native kernel mods which don't retrieve
+/// their output shapes after launch, the aicpu-like and compute depend kernel mods always resize.
+TEST_F(TestDynamicShapeHelper, test_resize_skipped_for_idempotent_kernel_mod) {
+  auto mark_resized = [](const CNodePtr &node, const std::string &key) {
+    auto cache = std::make_shared<dynamic_shape::InferShapeCache>();
+    node->set_user_data<dynamic_shape::InferShapeCache>(cache);
+    cache->set_current_key(key);
+    dynamic_shape::SetKernelModResized(node);
+    return cache;
+  };
+
+  auto native = CreateAbs(std::make_shared<TestKernelMod>(kernel::KernelModType::NativeCpuKernelMod, false));
+  auto native_cache = mark_resized(native, "a");
+  EXPECT_TRUE(dynamic_shape::IsKernelModResized(native));
+  native_cache->set_current_key("b");
+  EXPECT_FALSE(dynamic_shape::IsKernelModResized(native));
+
+  auto aicpu = CreateAbs(std::make_shared<TestKernelMod>(kernel::KernelModType::KernelMod, false));
+  (void)mark_resized(aicpu, "a");
+  EXPECT_FALSE(dynamic_shape::IsKernelModResized(aicpu));
+
+  auto compute_depend = CreateAbs(std::make_shared<TestKernelMod>(kernel::KernelModType::NativeGpuKernelMod, true));
+  (void)mark_resized(compute_depend, "a");
+  EXPECT_FALSE(dynamic_shape::IsKernelModResized(compute_depend));
+}
+}  // namespace opt
+}  // namespace mindspore
@@ -0,0 +1,117 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include "common/common_test.h"
+#include "ps/gradient_compressor.h"
+
+namespace mindspore {
+namespace ps {
+class TestGradientCompressor : public UT::Common {
+ public:
+  TestGradientCompressor() = default;
+  virtual ~TestGradientCompressor() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: binary push message of parameter server.
+/// Description: encode the values without compression and decode them.
+/// Expectation: the decoded keys, values and lens are the same as the encoded ones.
+TEST_F(TestGradientCompressor, NoCompress) {
+  std::vector<float> values = {0.1, 1.0, 2.0, -3.0, 0.5, 0.9};
+  std::vector<int> lens = {1, 4, 1};
+  std::string msg = GradientCompressor::Encode(7, values, lens, 1, GradCompressType::kNoCompress, 1.0, nullptr);
+
+  Keys keys;
+  Values decode_values;
+  Lengths decode_lens;
+  EXPECT_TRUE(GradientCompressor::Decode(msg.data(), msg.size(), &keys, &decode_values, &decode_lens));
+  EXPECT_EQ(keys, Keys({7}));
+  EXPECT_EQ(decode_values, values);
+  EXPECT_EQ(decode_lens, lens);
+}
+
+/// Feature: binary push message of parameter server.
+/// Description: compress the gradient to bf16 and keep the error in residual.
+/// Expectation: the decoded gradient plus the residual is the original gradient.
+TEST_F(TestGradientCompressor, Bf16WithErrorFeedback) {
+  std::vector<float> values = {0.1, 1.001, 2.0003, -3.0007};
+  std::vector<int> lens = {1, 3};
+  std::vector<float> residual;
+  std::string msg = GradientCompressor::Encode(0, values, lens, 1, GradCompressType::kBf16, 1.0, &residual);
+
+  Keys keys;
+  Values decode_values;
+  Lengths decode_lens;
+  EXPECT_TRUE(GradientCompressor::Decode(msg.data(), msg.size(), &keys, &decode_values, &decode_lens));
+  ASSERT_EQ(decode_values.size(), values.size());
+  ASSERT_EQ(residual.size(), 3);
+  EXPECT_EQ(decode_values[0], values[0]);
+  for (size_t i = 0; i < residual.size(); i++) {
+    EXPECT_FLOAT_EQ(decode_values[i + 1] + residual[i], values[i + 1]);
+  }
+}
+
+/// Feature: binary push message of parameter server.
+/// Description: push only the largest gradient elements in top-k mode.
+/// Expectation: the unselected elements are zero in decoded gradient and are kept in residual.
+TEST_F(TestGradientCompressor, TopKWithErrorFeedback) {
+  std::vector<float> values = {0.5, -4.0, 0.1, 3.0};
+  std::vector<int> lens = {4};
+  std::vector<float> residual;
+  std::string msg = GradientCompressor::Encode(1, values, lens, 0, GradCompressType::kTopK, 0.5, &residual);
+
+  Keys keys;
+  Values decode_values;
+  Lengths decode_lens;
+  EXPECT_TRUE(GradientCompressor::Decode(msg.data(), msg.size(), &keys, &decode_values, &decode_lens));
+  EXPECT_EQ(decode_values, Values({0.0, -4.0, 0.0, 3.0}));
+  EXPECT_EQ(residual, std::vector<float>({0.5, 0.0, 0.1, 0.0}));
+
+  // The residual is added to the gradient of next push.
+  msg = GradientCompressor::Encode(1, {0.0, 0.0, 0.0, 0.0}, lens, 0, GradCompressType::kTopK, 0.25, &residual);
+  EXPECT_TRUE(GradientCompressor::Decode(msg.data(), msg.size(), &keys, &decode_values, &decode_lens));
+  EXPECT_EQ(decode_values, Values({0.5, 0.0, 0.0, 0.0}));
+}
+
+/// Feature: binary push message of parameter server.
+/// Description: decode a truncated message.
+/// Expectation: decoding fails.
+TEST_F(TestGradientCompressor, TruncatedMessage) {
+  std::vector<float> values = {1.0, 2.0};
+  std::string msg = GradientCompressor::Encode(0, values, {2}, 0, GradCompressType::kFp16, 1.0, nullptr);
+  Keys keys;
+  Values decode_values;
+  Lengths decode_lens;
+  EXPECT_FALSE(GradientCompressor::Decode(msg.data(), msg.size() - 1, &keys, &decode_values, &decode_lens));
+}
+
+/// Feature: binary push message of parameter server.
+/// Description: get the gradient index of the pushes of the dense and the sparse optimizers.
+/// Expectation: only the dense push of momentum is compressed, on its gradient segment.
+TEST_F(TestGradientCompressor, CompressGradIndex) {
+  size_t grad_index = 0;
+  EXPECT_TRUE(GradientCompressor::GetCompressGradIndex(kApplyMomentum, false, &grad_index));
+  EXPECT_EQ(grad_index, kMomentumPSSendIdx.at("grad"));
+  EXPECT_FALSE(GradientCompressor::GetCompressGradIndex(kApplyMomentum, true, &grad_index));
+  EXPECT_FALSE(GradientCompressor::GetCompressGradIndex(kSparseAdam, true, &grad_index));
+  EXPECT_FALSE(GradientCompressor::GetCompressGradIndex(kSparseFtrl, true, &grad_index));
+  EXPECT_FALSE(GradientCompressor::GetCompressGradIndex("UnknownOptimizer", false, &grad_index));
+}
+}  // namespace ps
+}  // namespace mindspore
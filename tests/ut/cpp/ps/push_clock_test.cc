@@ -0,0 +1,133 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "ps/push_clock.h"
+
+namespace mindspore {
+namespace ps {
+namespace {
+constexpr Key kKey = 3;
+constexpr size_t kWorkerNum = 4;
+}  // namespace
+
+class TestPushClock : public UT::Common {
+ public:
+  TestPushClock() = default;
+  virtual ~TestPushClock() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: STALE_SYNC mode of parameter server.
+/// Description: let worker 0 push a key while the other workers push nothing, then let the slowest worker push.
+/// Expectation: worker 0 is blocked once it is staleness_threshold pushes ahead, and goes on after the others catch up.
+TEST_F(TestPushClock, StalenessBound) {
+  constexpr uint32_t kThreshold = 2;
+  PushClock push_clock(kStaleSyncConsistencyMode, kThreshold);
+  EXPECT_FALSE(push_clock.IsSyncMode());
+  push_clock.InitKey(kKey, kWorkerNum);
+  for (uint32_t i = 0; i <= kThreshold; ++i) {
+    ASSERT_TRUE(push_clock.ReadyForPush(kKey, 0));
+    push_clock.Tick(kKey, 0);
+  }
+  EXPECT_FALSE(push_clock.ReadyForPush(kKey, 0));
+  EXPECT_EQ(push_clock.clock(kKey, 0), kThreshold + 1);
+  // the other workers are never blocked since they are the slowest ones.
+  for (uint32_t rank = 1; rank < kWorkerNum - 1; ++rank) {
+    ASSERT_TRUE(push_clock.ReadyForPush(kKey, rank));
+    push_clock.Tick(kKey, rank);
+  }
+  EXPECT_FALSE(push_clock.ReadyForPush(kKey, 0));
+  push_clock.Tick(kKey, kWorkerNum - 1);
+  EXPECT_TRUE(push_clock.ReadyForPush(kKey, 0));
+}
+
+/// Feature: STALE_SYNC mode of parameter server.
+/// Description: several workers push concurrently under one mutex, and wait whenever they are not ready to push.
+/// Expectation: all the pushes go through and no worker gets more than staleness_threshold + 1 pushes ahead.
+TEST_F(TestPushClock, ConcurrentStalenessBound) {
+  constexpr uint32_t kThreshold = 1;
+  constexpr uint64_t kPushNum = 200;
+  PushClock push_clock(kStaleSyncConsistencyMode, kThreshold);
+  push_clock.InitKey(kKey, kWorkerNum);
+  std::mutex mutex;
+  std::atomic<uint64_t> max_gap{0};
+  std::vector<std::thread> workers;
+  for (uint32_t rank = 0; rank < kWorkerNum; ++rank) {
+    workers.emplace_back([&, rank]() {
+      for (uint64_t i = 0; i < kPushNum;) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!push_clock.ReadyForPush(kKey, rank)) {
+          lock.unlock();
+          std::this_thread::yield();
+          continue;
+        }
+        push_clock.Tick(kKey, rank);
+        ++i;
+        std::vector<uint64_t> clocks;
+        for (uint32_t j = 0; j < kWorkerNum; ++j) {
+          clocks.push_back(push_clock.clock(kKey, j));
+        }
+        auto gap = *std::max_element(clocks.begin(), clocks.end()) - *std::min_element(clocks.begin(), clocks.end());
+        max_gap = std::max(max_gap.load(), gap);
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  EXPECT_LE(max_gap.load(), kThreshold + 1);
+  for (uint32_t rank = 0; rank < kWorkerNum; ++rank) {
+    EXPECT_EQ(push_clock.clock(kKey, rank), kPushNum);
+  }
+}
+
+/// Feature: ASYNC mode of parameter server.
+/// Description: let worker 0 push a key many times while the other workers push nothing.
+/// Expectation: the pushes are applied at once without ever waiting for the other workers.
+TEST_F(TestPushClock, AsyncNeverBlocks) {
+  constexpr uint64_t kPushNum = 100;
+  PushClock push_clock(kAsyncConsistencyMode, 0);
+  EXPECT_FALSE(push_clock.IsSyncMode());
+  push_clock.InitKey(kKey, kWorkerNum);
+  for (uint64_t i = 0; i < kPushNum; ++i) {
+    ASSERT_TRUE(push_clock.ReadyForPush(kKey, 0));
+    push_clock.Tick(kKey, 0);
+  }
+  EXPECT_EQ(push_clock.clock(kKey, 0), kPushNum);
+  EXPECT_EQ(push_clock.clock(kKey, 1), 0U);
+}
+
+/// Feature: consistency modes of parameter server.
+/// Description: create the clocks with an invalid mode, and push an unknown key or from an unknown worker.
+/// Expectation: an exception is thrown in each case, and the default mode is SYNC.
+TEST_F(TestPushClock, InvalidPush) {
+  EXPECT_TRUE(PushClock().IsSyncMode());
+  EXPECT_ANY_THROW(PushClock("BSP", 0));
+  PushClock push_clock(kStaleSyncConsistencyMode, 0);
+  push_clock.InitKey(kKey, kWorkerNum);
+  EXPECT_ANY_THROW(push_clock.Tick(kKey + 1, 0));
+  EXPECT_ANY_THROW(push_clock.ReadyForPush(kKey, kWorkerNum));
+}
+}  // namespace ps
+}  // namespace mindspore
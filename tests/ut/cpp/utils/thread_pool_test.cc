@@ -0,0 +1,136 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <cmath>
+#include <vector>
+#include "common/common_test.h"
+#include "actor/actormgr.h"
+#define private public
+#include "include/common/thread_pool.h"
+#undef private
+
+namespace mindspore {
+namespace common {
+namespace {
+constexpr size_t kActorThreadNum = 2;
+constexpr size_t kAllThreadNum = 6;
+
+ActorThreadPool *InitActorThreadPool() {
+  auto actor_manager = ActorMgr::GetActorMgrRef();
+  (void)actor_manager->Initialize(true, kActorThreadNum, kAllThreadNum);
+  return actor_manager->GetActorThreadPool();
+}
+
+std::vector<Task> CreateTasks(size_t task_num, std::vector<int> *results) {
+  results->assign(task_num, 0);
+  std::vector<Task> tasks;
+  for (size_t i = 0; i < task_num; ++i) {
+    tasks.emplace_back([i, results]() {
+      (*results)[i] = static_cast<int>(i) + 1;
+      return SUCCESS;
+    });
+  }
+  return tasks;
+}
+
+// a kernel of the step, which runs SyncRun inside the tasks launched on the actor thread pool. run_count counts the
+// tasks of SyncRun which are run.
+void RunStep(ActorThreadPool *pool, size_t kernel_num, size_t task_num, std::atomic<size_t> *run_count) {
+  auto kernel = [task_num, run_count](void *, int, float, float) {
+    std::vector<Task> tasks;
+    std::vector<float> sums(task_num, 0.0f);
+    for (size_t i = 0; i < task_num; ++i) {
+      tasks.emplace_back([i, &sums, run_count]() {
+        for (int j = 0; j < 10000; ++j) {
+          sums[i] += std::sqrt(static_cast<float>(j));
+        }
+        ++(*run_count);
+        return SUCCESS;
+      });
+    }
+    (void)ThreadPool::GetInstance().SyncRun(tasks);
+    return 0;
+  };
+  for (size_t i = 0; i < kernel_num; ++i) {
+    (void)pool->ParallelLaunch(kernel, nullptr, static_cast<int>(kActorThreadNum));
+  }
+}
+}  // namespace
+
+class TestThreadPool : public UT::Common {
+ public:
+  TestThreadPool() = default;
+};
+
+/// Feature: SyncRun of common::ThreadPool.
+/// Description: run the tasks on the thread pool of the actor runtime and on the threads of its own.
+/// Expectation: all tasks are run once.
+TEST_F(TestThreadPool, TestSyncRun) {
+  auto &thread_pool = ThreadPool::GetInstance();
+  (void)InitActorThreadPool();
+  for (bool use_shared_pool : {true, false}) {
+    thread_pool.use_shared_pool_ = use_shared_pool;
+    for (size_t task_num : {2, 7, 100}) {
+      std::vector<int> results;
+      auto tasks = CreateTasks(task_num, &results);
+      ASSERT_TRUE(thread_pool.SyncRun(tasks));
+      for (size_t i = 0; i < task_num; ++i) {
+        ASSERT_EQ(results[i], static_cast<int>(i) + 1);
+      }
+    }
+  }
+  thread_pool.use_shared_pool_ = true;
+}
+
+/// Feature: SyncRun of common::ThreadPool nested in the kernel tasks of the actor thread pool.
+/// Description: run the steps with SyncRun on the shared pool and on the threads of its own.
+/// Expectation: the nested SyncRun does not dead lock and runs every task once.
+TEST_F(TestThreadPool, TestNestedSyncRun) {
+  constexpr size_t kKernelNum = 20;
+  constexpr size_t kStepNum = 10;
+  auto pool = InitActorThreadPool();
+  ASSERT_NE(pool, nullptr);
+  auto &thread_pool = ThreadPool::GetInstance();
+  for (bool use_shared_pool : {false, true}) {
+    thread_pool.use_shared_pool_ = use_shared_pool;
+    size_t task_num = thread_pool.GetSyncRunThreadNum();
+    std::atomic<size_t> run_count{0};
+    for (size_t step = 0; step < kStepNum; ++step) {
+      RunStep(pool, kKernelNum, task_num, &run_count);
+    }
+    ASSERT_EQ(run_count.load(), kStepNum * kKernelNum * kActorThreadNum * task_num);
+  }
+  thread_pool.use_shared_pool_ = true;
+}
+
+/// Feature: SyncRun of common::ThreadPool.
+/// Description: create the threads of its own by a SyncRun before the shared pool is used, then run on the shared pool.
+/// Expectation: the SyncRun on the shared pool doesn't tear down the threads, which are only cleared at shutdown.
+TEST_F(TestThreadPool, TestSharedSyncRunKeepsThreads) {
+  auto &thread_pool = ThreadPool::GetInstance();
+  (void)InitActorThreadPool();
+  std::vector<int> results;
+  thread_pool.use_shared_pool_ = false;
+  ASSERT_TRUE(thread_pool.SyncRun(CreateTasks(kAllThreadNum, &results)));
+  auto thread_num = thread_pool.sync_run_threads_.size();
+  ASSERT_GT(thread_num, 0U);
+  thread_pool.use_shared_pool_ = true;
+  ASSERT_TRUE(thread_pool.SyncRun(CreateTasks(kAllThreadNum, &results)));
+  ASSERT_EQ(thread_pool.sync_run_threads_.size(), thread_num);
+  ASSERT_FALSE(thread_pool.exit_run_);
+}
+}  // namespace common
+}  // namespace mindspore